@@ -38,8 +38,10 @@ class OhOsTargetMultiEntryBuilder(private val isMainModule: Boolean, private val
                 addImport("com.tencent.kuikly.core.manager", "KotlinMethod")
                 addImport("kotlinx.cinterop", "staticCFunction")
                 addImport("ohos", "com_tencent_kuikly_SetCallKotlin")
+                addImport("com.tencent.kuikly.core.nvi", "NativeCommandBatch")
 
                 addFunction(createCallNativeFunc())
+                addFunction(createCallNativeBatchFunc())
                 addFunction(createInitKuiklyMethod(pagesAnnotations))
             }
         }
@@ -74,17 +76,22 @@ class OhOsTargetMultiEntryBuilder(private val isMainModule: Boolean, private val
                                     nativeBridge.callNativeCallback = { methodId, arg0, arg1, arg2, arg3, arg4, arg5 ->
                                         callNative(methodId, arg0, arg1, arg2, arg3, arg4, arg5)
                                     }
+                                    nativeBridge.callNativeBatchCallback = { pagerId, buffer, length ->
+                                        callNativeBatch(pagerId, buffer, length)
+                                    }
                                     BridgeManager.registerNativeBridge(arg0.asString(), nativeBridge)
                                 }
-                                BridgeManager.callKotlinMethod(
-                                     methodId,
-                                     arg0.toAny(),
-                                     arg1.toAny(),
-                                     arg2.toAny(),
-                                     arg3.toAny(),
-                                     arg4.toAny(),
-                                     arg5.toAny()
-                                )
+                                NativeCommandBatch.batch {
+                                    BridgeManager.callKotlinMethod(
+                                         methodId,
+                                         arg0.toAny(),
+                                         arg1.toAny(),
+                                         arg2.toAny(),
+                                         arg3.toAny(),
+                                         arg4.toAny(),
+                                         arg5.toAny()
+                                    )
+                                }
                             } catch(t: Throwable){
                                 ExceptionTracker.notifyKuiklyException(t)
                             }
@@ -167,4 +174,32 @@ class OhOsTargetMultiEntryBuilder(private val isMainModule: Boolean, private val
             .build()
     }
 
+    private fun createCallNativeBatchFunc(): FunSpec {
+        val optInAnnotation = ClassName("kotlin", "OptIn")
+        val experimentalForeignApi = ClassName("kotlinx.cinterop", "ExperimentalForeignApi")
+        val usePinned = ClassName("kotlinx.cinterop", "usePinned")
+        val addressOf = ClassName("kotlinx.cinterop", "addressOf")
+        val reinterpret = ClassName("kotlinx.cinterop", "reinterpret")
+
+        return FunSpec.builder("callNativeBatch")
+            .addModifiers(KModifier.PRIVATE)
+            .addAnnotation(AnnotationSpec.builder(optInAnnotation).apply {
+                addMember("%T::class", experimentalForeignApi)
+            }.build())
+            .addParameter("pagerId", String::class)
+            .addParameter("buffer", ByteArray::class)
+            .addParameter("length", Int::class)
+            .addCode(
+                """
+            |buffer.%T { pinned ->
+            |    ohos.com_tencent_kuikly_CallNativeBatch(pagerId, pinned.%T(0).%T(), length)
+            |}
+        """.trimMargin(),
+                usePinned,
+                addressOf,
+                reinterpret
+            )
+            .build()
+    }
+
 }
\ No newline at end of file
@@ -68,6 +68,10 @@ class ICallNativeCallback {
                  std::shared_ptr<KRRenderValue> &arg1, std::shared_ptr<KRRenderValue> &arg2,
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5) = 0;
+    /**
+     * Kotlin侧批量下发的二进制指令（格式见KRRenderCommandBuffer.h），调用方在返回后即释放data
+     */
+    virtual void OnCallNativeBatch(const uint8_t *data, size_t length) {}
 };
 
 class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRenderNativeContextHandler> {
@@ -78,6 +82,8 @@ class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRen
                                              const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                              const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                              const KRRenderCValue &arg5);
+
+    static void DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data, size_t length);
     
     static void SetContextHandlerCreator(const KRRenderContextHandlerCreator &creator);
 
@@ -92,6 +98,8 @@ class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRen
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5);
 
+    void OnCallNativeBatch(const uint8_t *data, size_t length);
+
     void Init(const std::shared_ptr<KRRenderContextParams> context_params);
 
     virtual void InitContext();  //  初始化通信上下文
@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_KRRENDERCONTEXTPARAMS_H
 #define CORE_RENDER_OHOS_KRRENDERCONTEXTPARAMS_H
 
+#include <atomic>
 #include <string>
 #include "libohos_render/context/KRRenderNativeMode.h"
 #include "libohos_render/foundation/KRConfig.h"
@@ -69,6 +70,15 @@ class KRRenderContextParams {
     const std::shared_ptr<KRConfig> &Config() const {
         return config_;
     }
+    /**
+     * 页面内最近一次文本测量的约束宽度，作为文本预排版的约束宽度
+     */
+    double TextConstraintWidthHint() const {
+        return text_constraint_width_hint_.load(std::memory_order_relaxed);
+    }
+    void SetTextConstraintWidthHint(double width) {
+        text_constraint_width_hint_.store(width, std::memory_order_relaxed);
+    }
 
     KRRenderContextParams(const KRRenderContextParams &) = delete;
     KRRenderContextParams &operator=(const KRRenderContextParams &) = delete;
@@ -88,5 +98,7 @@ class KRRenderContextParams {
     std::shared_ptr<KRRenderValue> page_data_;
     /** 配置数据 */
     std::shared_ptr<KRConfig> config_;
+    /** 文本预排版约束宽度，Context 线程写、后台排版线程读 */
+    std::atomic<double> text_constraint_width_hint_{0};
 };
 #endif  // CORE_RENDER_OHOS_KRRENDERCONTEXTPARAMS_H
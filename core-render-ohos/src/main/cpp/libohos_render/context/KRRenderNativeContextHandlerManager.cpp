@@ -51,49 +51,89 @@ std::shared_ptr<IKRRenderNativeContextHandler> KRRenderNativeContextHandlerManag
 
 void KRRenderNativeContextHandlerManager::RegisterContextHandler(
     const std::string &instanceId, const std::shared_ptr<IKRRenderNativeContextHandler> &contextHandler) {
+    std::unique_lock<std::shared_mutex> lock(context_handler_mutex_);
     context_handler_map_[instanceId] = contextHandler;
 }
 
 void KRRenderNativeContextHandlerManager::UnregisterContextHandler(const std::string &instanceId) {
-    context_handler_map_.erase(instanceId);
+    {
+        std::unique_lock<std::shared_mutex> lock(context_handler_mutex_);
+        context_handler_map_.erase(instanceId);
+    }
+    std::vector<std::shared_ptr<KRRenderValue>> values;
+    {
+        KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
+        auto it = pending_dealloc_render_values_.find(instanceId);
+        if (it != pending_dealloc_render_values_.end()) {
+            values.swap(it->second);
+            pending_dealloc_render_values_.erase(it);
+        }
+    }
+    // values 在锁外析构
+}
+
+std::shared_ptr<IKRRenderNativeContextHandler>
+KRRenderNativeContextHandlerManager::FindContextHandler(const std::string &instanceId) {
+    std::shared_lock<std::shared_mutex> lock(context_handler_mutex_);
+    auto it = context_handler_map_.find(instanceId);
+    return it != context_handler_map_.end() ? it->second : nullptr;
 }
 
 void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
-    std::shared_ptr<KRRenderValue> will_dealloc_render_value) {
+    const std::string &instanceId, std::shared_ptr<KRRenderValue> will_dealloc_render_value) {
+    bool need_schedule = false;
     {
         KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
-        pending_dealloc_render_values_.push_back(will_dealloc_render_value);
+        auto it = pending_dealloc_render_values_.find(instanceId);
+        if (it == pending_dealloc_render_values_.end()) {
+            it = pending_dealloc_render_values_.emplace(instanceId, std::vector<std::shared_ptr<KRRenderValue>>()).first;
+            need_schedule = true;
+        }
+        it->second.push_back(std::move(will_dealloc_render_value));
     }
-    if (!scheduling_dealloc_render_values_) {
-        scheduling_dealloc_render_values_ = true;
-        KRContextScheduler::ScheduleTask(false, 16, [this]() {
-            // `this` is safe to be captured in the closure, because it is an singleton.
-            decltype(pending_dealloc_render_values_) values;
-            {
-                KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
-                values.swap(pending_dealloc_render_values_);
+    if (!need_schedule) {
+        return;
+    }
+    KRContextScheduler::ScheduleTask(instanceId, false, 16, [this, instanceId]() {
+        // `this` is safe to be captured in the closure, because it is an singleton.
+        std::vector<std::shared_ptr<KRRenderValue>> values;
+        {
+            KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
+            auto it = pending_dealloc_render_values_.find(instanceId);
+            if (it != pending_dealloc_render_values_.end()) {
+                values.swap(it->second);
+                pending_dealloc_render_values_.erase(it);
             }
-            
-            KRRenderNativeContextHandlerManager::GetInstance().scheduling_dealloc_render_values_ = false;
-        });
+        }
+    }, KRTaskPriority::kIdle);
+}
+
+/**
+ * 构造callNative参数，未使用的参数位（NULL_VALUE）共享同一个只读空值，其余参数从内存块池分配
+ */
+static std::shared_ptr<KRRenderValue> MakeCallNativeArg(const KRRenderCValue &arg) {
+    if (arg.type == KRRenderCValue::NULL_VALUE) {
+        static const auto kNullArg = std::make_shared<KRRenderValue>();
+        return kNullArg;
     }
+    return KRRenderValue::Make(arg);
 }
 
 KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
     const std::string &instanceId, int methodId, const KRRenderCValue &arg0, const KRRenderCValue &arg1,
     const KRRenderCValue &arg2, const KRRenderCValue &arg3, const KRRenderCValue &arg4, const KRRenderCValue &arg5) {
-    auto handler = context_handler_map_[instanceId];
+    auto handler = FindContextHandler(instanceId);
     if (!handler || nullptr == KRRenderManager::GetInstance().GetRenderView(instanceId)) {
         auto cv = KRRenderCValue();
         cv.type = KRRenderCValue::NULL_VALUE;
         return cv;
     }
-    auto cv0 = std::make_shared<KRRenderValue>(arg0);
-    auto cv1 = std::make_shared<KRRenderValue>(arg1);
-    auto cv2 = std::make_shared<KRRenderValue>(arg2);
-    auto cv3 = std::make_shared<KRRenderValue>(arg3);
-    auto cv4 = std::make_shared<KRRenderValue>(arg4);
-    auto cv5 = std::make_shared<KRRenderValue>(arg5);
+    auto cv0 = MakeCallNativeArg(arg0);
+    auto cv1 = MakeCallNativeArg(arg1);
+    auto cv2 = MakeCallNativeArg(arg2);
+    auto cv3 = MakeCallNativeArg(arg3);
+    auto cv4 = MakeCallNativeArg(arg4);
+    auto cv5 = MakeCallNativeArg(arg5);
 
     auto return_value =
         handler->OnCallNative(static_cast<KuiklyRenderNativeMethod>(methodId), cv0, cv1, cv2, cv3, cv4, cv5);
@@ -102,6 +142,15 @@ KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
         null_return_value.type = KRRenderCValue::NULL_VALUE;
         return null_return_value;
     }
-    ScheduleDeallocRenderValues(return_value);
+    ScheduleDeallocRenderValues(instanceId, return_value);
     return return_value->toCValue();
 }
+
+void KRRenderNativeContextHandlerManager::DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data,
+                                                                  size_t length) {
+    auto handler = FindContextHandler(instanceId);
+    if (!handler || nullptr == KRRenderManager::GetInstance().GetRenderView(instanceId)) {
+        return;
+    }
+    handler->OnCallNativeBatch(data, length);
+}
@@ -17,6 +17,7 @@
 #define CORE_RENDER_OHOS_KRRENDERNATIVECONTEXTHANDLERMANAGER_H
 
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
@@ -40,6 +41,7 @@ class KRRenderNativeContextHandlerManager {
                                       const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                       const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                       const KRRenderCValue &arg5);
+    void DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data, size_t length);
     static KRRenderNativeContextHandlerManager &GetInstance() {
         static KRRenderNativeContextHandlerManager m_instance;  // 局部静态变量
         return m_instance;
@@ -55,13 +57,17 @@ class KRRenderNativeContextHandlerManager {
 
  private:
     KRRenderNativeContextHandlerManager() {}
-    void ScheduleDeallocRenderValues(std::shared_ptr<KRRenderValue> will_dealloc_render_value);
+    std::shared_ptr<IKRRenderNativeContextHandler> FindContextHandler(const std::string &instanceId);
+    void ScheduleDeallocRenderValues(const std::string &instanceId,
+                                     std::shared_ptr<KRRenderValue> will_dealloc_render_value);
 
  private:
+    // 注册与注销在主线程，callNative 在各页面的 Context 线程，用读写锁保护
     std::unordered_map<std::string, std::shared_ptr<IKRRenderNativeContextHandler>> context_handler_map_;
+    std::shared_mutex context_handler_mutex_;
     KRRenderContextHandlerCreator creator_;
-    bool scheduling_dealloc_render_values_ = false;
-    std::vector<std::shared_ptr<KRRenderValue>> pending_dealloc_render_values_;
+    // 按页面暂存 callNative 返回值，延迟到该页面的 Context 线程释放；存在条目即表示释放任务已调度
+    std::unordered_map<std::string, std::vector<std::shared_ptr<KRRenderValue>>> pending_dealloc_render_values_;
     KRSpinLock pending_dealloc_render_values_lock_;
 
     static KRRenderNativeContextHandlerManager *instance_;
@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+#define CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "libohos_render/foundation/type/KRRenderCValue.h"
+
+/**
+ * Kotlin 侧批量下发的二进制指令缓冲区（com_tencent_kuikly_CallNativeBatch）
+ *
+ * 缓冲区由若干条指令顺序拼接而成，所有数值均为小端序：
+ *   | uint16 opcode | uint16 flags | uint32 payload_length | payload... |
+ * opcode 取值与 KuiklyRenderNativeMethod 保持一致，另外保留 kDefinePropKey 用于属性名驻留。
+ * 各指令 payload 布局：
+ *   CreateRenderView     : int32 tag, str view_name
+ *   RemoveRenderView     : int32 tag
+ *   InsertSubRenderView  : int32 parent_tag, int32 child_tag, int32 index
+ *   SetViewProp          : int32 tag, uint16 prop_id, value
+ *   SetRenderViewFrame   : int32 tag, float x, float y, float width, float height
+ *   DefinePropKey        : uint16 prop_id, str prop_key
+ * str   : uint32 length + 字节内容（无结束符）
+ * value : uint8 KRRenderCValue::Type + 对应内容（INT/LONG/FLOAT/DOUBLE 为定长，BOOL 为 uint8，STRING 为 str，NULL 无内容）
+ * payload_length 允许解码端跳过未识别的指令，便于协议向后兼容。
+ */
+enum class KRRenderCommandOpcode : uint16_t {
+    kCreateRenderView = 1,
+    kRemoveRenderView = 2,
+    kInsertSubRenderView = 3,
+    kSetViewProp = 4,
+    kSetRenderViewFrame = 5,
+    kDefinePropKey = 0xF0,
+};
+
+/**
+ * 指令缓冲区的只读游标，所有读取均做越界检查且不产生堆分配
+ */
+class KRRenderCommandReader {
+ public:
+    KRRenderCommandReader() = default;
+    KRRenderCommandReader(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+
+    bool IsValid() const {
+        return valid_;
+    }
+
+    size_t Length() const {
+        return length_;
+    }
+
+    bool AtEnd() const {
+        return offset_ >= length_;
+    }
+
+    int32_t ReadInt32() {
+        return ReadScalar<int32_t>();
+    }
+
+    int64_t ReadInt64() {
+        return ReadScalar<int64_t>();
+    }
+
+    uint16_t ReadUInt16() {
+        return ReadScalar<uint16_t>();
+    }
+
+    uint8_t ReadUInt8() {
+        return ReadScalar<uint8_t>();
+    }
+
+    float ReadFloat() {
+        return ReadScalar<float>();
+    }
+
+    double ReadDouble() {
+        return ReadScalar<double>();
+    }
+
+    /** 返回的 string_view 指向缓冲区内部，生命周期与缓冲区一致 */
+    std::string_view ReadString() {
+        auto length = ReadScalar<uint32_t>();
+        if (!Require(length)) {
+            return std::string_view();
+        }
+        std::string_view result(reinterpret_cast<const char *>(data_ + offset_), length);
+        offset_ += length;
+        return result;
+    }
+
+    /**
+     * 读取下一条指令
+     * @param opcode 指令码
+     * @param payload 指令内容游标
+     * @return 是否读取成功，缓冲区结束或数据损坏时返回false
+     */
+    bool NextCommand(KRRenderCommandOpcode &opcode, KRRenderCommandReader &payload) {
+        if (AtEnd() || !valid_) {
+            return false;
+        }
+        opcode = static_cast<KRRenderCommandOpcode>(ReadScalar<uint16_t>());
+        ReadScalar<uint16_t>();  // flags，预留
+        auto payload_length = ReadScalar<uint32_t>();
+        if (!Require(payload_length)) {
+            return false;
+        }
+        payload = KRRenderCommandReader(data_ + offset_, payload_length);
+        offset_ += payload_length;
+        return true;
+    }
+
+ private:
+    template <typename T> T ReadScalar() {
+        T value{};
+        if (Require(sizeof(T))) {
+            memcpy(&value, data_ + offset_, sizeof(T));  // 缓冲区不保证对齐
+            offset_ += sizeof(T);
+        }
+        return value;
+    }
+
+    bool Require(size_t size) {
+        if (!valid_ || offset_ > length_ || length_ - offset_ < size) {
+            valid_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t *data_ = nullptr;
+    size_t length_ = 0;
+    size_t offset_ = 0;
+    bool valid_ = true;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
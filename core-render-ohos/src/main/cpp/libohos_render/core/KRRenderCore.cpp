@@ -15,9 +15,12 @@
 
 #include "libohos_render/core/KRRenderCore.h"
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
@@ -33,6 +36,13 @@ const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue
                                                              arg2, arg3, arg4, arg5);
 }
 
+void com_tencent_kuikly_CallNativeBatch(const char *pagerId, const uint8_t *buffer, int32_t length) {
+    if (pagerId == nullptr || buffer == nullptr || length <= 0) {
+        return;
+    }
+    IKRRenderNativeContextHandler::DispatchCallNativeBatch(std::string(pagerId), buffer, static_cast<size_t>(length));
+}
+
 CallKotlin callKotlin_;
 int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin) {
     callKotlin_ = callKotlin;
@@ -40,12 +50,12 @@ int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin) {
 }
 
 void com_tencent_kuikly_ScheduleContextTask(const char *pagerId, void (*onSchedule)(const char *pagerId)) {
-    KRContextScheduler::ScheduleTask(
-        false, 0, [instanceId = std::string(pagerId), onSchedule]() { onSchedule(instanceId.c_str()); });
+    std::string instanceId(pagerId ? pagerId : "");
+    KRContextScheduler::ScheduleTask(instanceId, false, 0, [instanceId, onSchedule]() { onSchedule(instanceId.c_str()); });
 }
 
 bool com_tencent_kuikly_IsCurrentOnContextThread(const char *pagerId) {
-    return KRContextScheduler::IsCurrentOnContextThread();
+    return KRContextScheduler::IsCurrentOnContextThread(pagerId ? pagerId : "");
 }
 EXTERN_C_END
 
@@ -57,18 +67,74 @@ static constexpr int kSyncCallbackMask = 1;
  * callback是否为keep alive Mask
  */
 static constexpr int kCallbackKeepAliveMask = 2;
+/**
+ * frame属性名，避免每次设置frame构造临时字符串
+ */
+static const std::string kFramePropKey = "frame";
 
-/** 任务在context线程中执行 */
-static void PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task) {
-    KRContextScheduler::ScheduleTask(isSync, delayMs, task);
+/**
+ * 触摸、手势与滚动事件走输入通道，先于已排队的回调与定时任务派发；其余事件保持在默认通道内按序派发
+ */
+static KRTaskPriority ViewEventPriority(KRPropKey event_key) {
+    switch (event_key) {
+    case KRPropKey::kClick:
+    case KRPropKey::kDoubleClick:
+    case KRPropKey::kLongPress:
+    case KRPropKey::kPan:
+    case KRPropKey::kPinch:
+    case KRPropKey::kTouchDown:
+    case KRPropKey::kTouchMove:
+    case KRPropKey::kTouchUp:
+    case KRPropKey::kScroll:
+    case KRPropKey::kDragBegin:
+    case KRPropKey::kWillDragEnd:
+    case KRPropKey::kDragEnd:
+    case KRPropKey::kScrollEnd:
+        return KRTaskPriority::kInput;
+    default:
+        return KRTaskPriority::kCallback;
+    }
 }
 
+/**
+ * 作用域结束时记录一次Native调用的耗时
+ */
+class KRBridgeCallRecorder {
+ public:
+    KRBridgeCallRecorder(KRBridgeStats *stats, int method, bool sync, size_t payload_bytes)
+        : stats_(stats), method_(method), sync_(sync), payload_bytes_(payload_bytes),
+          start_(std::chrono::steady_clock::now()) {}
+
+    ~KRBridgeCallRecorder() {
+        if (stats_) {
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+            stats_->RecordNativeMethod(method_, sync_, latency.count(), payload_bytes_);
+        }
+    }
+
+ private:
+    KRBridgeStats *stats_;
+    int method_;
+    bool sync_;
+    size_t payload_bytes_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+
 KRRenderCore::KRRenderCore(std::weak_ptr<IKRRenderView> renderView, std::shared_ptr<KRRenderContextParams> context)
     : ICallNativeCallback() {
     renderView_ = renderView;
     context_ = context;
+    // 先分配Context线程，页面的所有调度都落在该线程上
+    contextShard_ = KRContextScheduler::RegisterInstance(context->InstanceId());
+    if (auto view = renderView.lock()) {
+        if (auto performance_manager = view->GetPerformanceManager()) {
+            bridgeStats_ = performance_manager->GetBridgeStats();
+        }
+    }
     defaultNullValue_ = std::make_shared<KRRenderValue>();
-    uiScheduler_ = std::make_shared<KRUIScheduler>(this);
+    uiScheduler_ = std::make_shared<KRUIScheduler>(this, context->InstanceId());
+    uiScheduler_->SetFrameBudgetMs(context->Config()->GetUITaskFrameBudgetMs());
     contextHandler_ = IKRRenderNativeContextHandler::CreateContextHandler(context);
     // 注册kotlin call native回调（走onCallNative接口）
     contextHandler_->RegisterCallNative(this);
@@ -97,7 +163,7 @@ void KRRenderCore::DidInit() {
     auto strongSelf = shared_from_this();
     // createInstance to kotlin
     auto sync = context_->ExecuteMode()->IsContextSyncInit();
-    KRContextScheduler::DirectRunOnMainThread(sync, [strongSelf, sync] {
+    KRContextScheduler::DirectRunOnMainThread(context_->InstanceId(), contextShard_, sync, [strongSelf, sync] {
         auto page_name = std::make_shared<KRRenderValue>(strongSelf->context_->PageName());
         auto page_data = std::make_shared<KRRenderValue>(strongSelf->context_->PageData()->toString());
         auto null_arg = strongSelf->defaultNullValue_;
@@ -131,6 +197,7 @@ void KRRenderCore::SendEvent(std::string event_name, const std::string &json_dat
                                nullValue, nullValue);
     };
 
+    // 页面生命周期与尺寸变化事件需与 createInstance、destroyInstance 保持先后顺序，走默认通道
     PerformTaskOnContextQueue(needSync, 0, task);
 }
 
@@ -152,21 +219,36 @@ void KRRenderCore::WillDealloc(const std::string &instanceId) {
     auto self = shared_from_this();
     std::string id = instanceId;
     PerformTaskOnContextQueue(false, 0, [self, id] {
+        self->CancelPendingTimers();
         auto nullValue = self->defaultNullValue_;
         self->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodDestroyInstance, nullValue, nullValue,
                                nullValue, nullValue, nullValue);
         self->contextHandler_->OnDestroy();
         self->uiScheduler_->AddTaskToMainQueueWithTask([self, id] {
             self->OnDestroy();
+            KRContextScheduler::ReleaseInstance(self->context_->InstanceId());
             KRRenderManager::GetInstance().DestroyRenderViewCallBack(id);
         });
     });
 }
 
+/** 任务在页面所属的context线程中执行 */
+void KRRenderCore::PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task,
+                                             KRTaskPriority priority) {
+    KRContextScheduler::ScheduleTask(context_->InstanceId(), contextShard_, isSync, delayMs, task, priority);
+}
+
 void KRRenderCore::OnDestroy() {
     renderLayerHandler_->OnDestroy();
 }
 
+void KRRenderCore::CancelPendingTimers() {
+    for (auto &timer : pendingTimers_) {
+        KRContextScheduler::CancelTask(timer.second);
+    }
+    pendingTimers_.clear();
+}
+
 void KRRenderCore::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
     uiScheduler_->AddTaskToMainQueueWithTask(task);
 }
@@ -206,6 +288,120 @@ KRRenderCore::OnCallNative(const KuiklyRenderNativeMethod &method, std::shared_p
     return defaultNullValue_;
 }
 
+void KRRenderCore::OnCallNativeBatch(const uint8_t *data, size_t length) {
+    if (!uiScheduler_) {
+        return;
+    }
+    // Kotlin侧缓冲区在调用返回后即被复用，这里整体拷贝一次，替代逐条调用的参数装箱与任务闭包
+    auto buffer = std::make_shared<std::vector<uint8_t>>(data, data + length);
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    uiScheduler_->AddTaskToMainQueueWithTask([weakSelf, buffer] {
+        if (auto locked = weakSelf.lock()) {
+            locked->PerformNativeCommandBuffer(buffer->data(), buffer->size());
+        }
+    });
+}
+
+template <typename T> const KRAnyValue &KRRenderCore::ReuseCommandValue(T value) {
+    // 指令逐条消费，SetProp后未被组件持有（引用计数为1）时直接复用，避免每个属性值一次堆分配
+    if (!commandValue_ || commandValue_.use_count() != 1) {
+        commandValue_ = std::make_shared<KRRenderValue>();
+    }
+    commandValue_->Reset(value);
+    return commandValue_;
+}
+
+void KRRenderCore::PerformNativeCommandBuffer(const uint8_t *data, size_t length) {
+    KRRenderCommandReader reader(data, length);
+    KRRenderCommandOpcode opcode;
+    KRRenderCommandReader payload;
+    while (reader.NextCommand(opcode, payload)) {
+        // 批量指令码与 KuiklyRenderNativeMethod 取值一致
+        KRBridgeCallRecorder recorder(opcode == KRRenderCommandOpcode::kDefinePropKey ? nullptr : bridgeStats_.get(),
+                                      static_cast<int>(opcode), false, payload.Length());
+        switch (opcode) {
+        case KRRenderCommandOpcode::kCreateRenderView: {
+            auto tag = payload.ReadInt32();
+            auto view_name = payload.ReadString();
+            commandViewName_.assign(view_name.data(), view_name.size());
+            renderLayerHandler_->CreateRenderView(tag, commandViewName_);
+            break;
+        }
+        case KRRenderCommandOpcode::kRemoveRenderView: {
+            renderLayerHandler_->RemoveRenderView(payload.ReadInt32());
+            break;
+        }
+        case KRRenderCommandOpcode::kInsertSubRenderView: {
+            auto parent_tag = payload.ReadInt32();
+            auto child_tag = payload.ReadInt32();
+            auto index = payload.ReadInt32();
+            renderLayerHandler_->InsertSubRenderView(parent_tag, child_tag, index);
+            break;
+        }
+        case KRRenderCommandOpcode::kSetViewProp: {
+            auto tag = payload.ReadInt32();
+            auto prop_id = payload.ReadUInt16();
+            if (prop_id >= commandPropKeys_.size()) {
+                KR_LOG_ERROR << "CallNativeBatch undefined prop id:" << prop_id;
+                break;
+            }
+            auto &value = ReadCommandValue(payload);
+            if (payload.IsValid()) {
+                renderLayerHandler_->SetProp(tag, commandPropKeyIds_[prop_id], commandPropKeys_[prop_id], value);
+            }
+            break;
+        }
+        case KRRenderCommandOpcode::kSetRenderViewFrame: {
+            auto tag = payload.ReadInt32();
+            auto x = payload.ReadFloat();
+            auto y = payload.ReadFloat();
+            auto width = payload.ReadFloat();
+            auto height = payload.ReadFloat();
+            auto rect = KRRect(x, y, width, height);
+            renderLayerHandler_->SetProp(tag, KRPropKey::kFrame, kFramePropKey,
+                                         ReuseCommandValue(std::string_view((const char *)&rect, sizeof(KRRect))));
+            break;
+        }
+        case KRRenderCommandOpcode::kDefinePropKey: {
+            auto prop_id = payload.ReadUInt16();
+            auto prop_key = payload.ReadString();
+            if (prop_id >= commandPropKeys_.size()) {
+                commandPropKeys_.resize(prop_id + 1);
+                commandPropKeyIds_.resize(prop_id + 1, KRPropKey::kUnknown);
+            }
+            commandPropKeys_[prop_id].assign(prop_key.data(), prop_key.size());
+            commandPropKeyIds_[prop_id] = KRPropKeyFromString(prop_key);  // 属性名驻留时解析一次，后续按ID下发
+            break;
+        }
+        default:
+            // 未识别的指令直接跳过，payload_length保证后续指令仍可正确解析
+            break;
+        }
+    }
+    if (!reader.IsValid()) {
+        KR_LOG_ERROR << "CallNativeBatch malformed command buffer, length:" << length;
+    }
+}
+
+const KRAnyValue &KRRenderCore::ReadCommandValue(KRRenderCommandReader &reader) {
+    switch (static_cast<KRRenderCValue::Type>(reader.ReadUInt8())) {
+    case KRRenderCValue::Type::INT:
+        return ReuseCommandValue(reader.ReadInt32());
+    case KRRenderCValue::Type::LONG:
+        return ReuseCommandValue(reader.ReadInt64());
+    case KRRenderCValue::Type::FLOAT:
+        return ReuseCommandValue(reader.ReadFloat());
+    case KRRenderCValue::Type::DOUBLE:
+        return ReuseCommandValue(reader.ReadDouble());
+    case KRRenderCValue::Type::BOOL:
+        return ReuseCommandValue(reader.ReadUInt8() != 0);
+    case KRRenderCValue::Type::STRING:
+        return ReuseCommandValue(reader.ReadString());
+    default:
+        return defaultNullValue_;
+    }
+}
+
 // 判断事件是否需要同步调用
 bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5) {
     if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod) {
@@ -225,6 +421,15 @@ bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method,
 KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1,
                                                const KRAnyValue &arg2, const KRAnyValue &arg3, const KRAnyValue &arg4,
                                                const KRAnyValue &arg5, bool sync) {
+    KRTraceScope trace("NativeCallback", sync ? "sync" : "async", &context_->InstanceId());
+    trace.SetArg("method", static_cast<int64_t>(method));
+    size_t payload_bytes = 0;
+    if (bridgeStats_) {
+        payload_bytes = KRBridgeStats::PayloadBytes(arg1) + KRBridgeStats::PayloadBytes(arg2) +
+                        KRBridgeStats::PayloadBytes(arg3) + KRBridgeStats::PayloadBytes(arg4) +
+                        KRBridgeStats::PayloadBytes(arg5);
+    }
+    KRBridgeCallRecorder recorder(bridgeStats_.get(), static_cast<int>(method), sync, payload_bytes);
     switch (method) {
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateRenderView: {
         renderLayerHandler_->CreateRenderView(arg1->toInt(), arg2->toString());
@@ -240,12 +445,19 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp: {
         bool isEvent = arg4->toInt() == 1;
+        auto &prop_key = arg2->toString();
+        auto prop_id = KRPropKeyFromString(prop_key);
         if (isEvent) {
             bool sync = IsSyncCallback(arg5);
+            auto priority = ViewEventPriority(prop_id);
             std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-            KRRenderCallback callback = [weakSelf, arg1, arg2, arg3, arg4, arg5, sync](KRAnyValue res) {
+            KRRenderCallback callback = [weakSelf, arg1, arg2, arg3, arg4, arg5, sync, priority](KRAnyValue res) {
                 auto shouldSync = sync;
-                PerformTaskOnContextQueue(shouldSync, 0, [weakSelf, shouldSync, res, arg1, arg2, arg3, arg4, arg5] {
+                auto core = weakSelf.lock();
+                if (!core) {
+                    return;
+                }
+                core->PerformTaskOnContextQueue(shouldSync, 0, [weakSelf, shouldSync, res, arg1, arg2, arg3, arg4, arg5] {
                     if (auto locked = weakSelf.lock()) {
                         locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireViewEvent, arg1, arg2,
                                                  res, locked->defaultNullValue_, locked->defaultNullValue_);
@@ -253,16 +465,16 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
                             locked->uiScheduler_->PerformSyncMainQueueTasksBlockIfNeed(true);
                         }
                     }
-                });
+                }, priority);
                 if (shouldSync) {
                     if (auto locked = weakSelf.lock()) {
                         locked->uiScheduler_->PerformMainThreadTaskWaitToSyncBlockIfNeed();
                     }
                 }
             };
-            renderLayerHandler_->SetEvent(arg1->toInt(), arg2->toString(), callback);
+            renderLayerHandler_->SetEvent(arg1->toInt(), prop_id, prop_key, callback);
         } else {
-            renderLayerHandler_->SetProp(arg1->toInt(), arg2->toString(), arg3);
+            renderLayerHandler_->SetProp(arg1->toInt(), prop_id, prop_key, arg3);
         }
         break;
     }
@@ -271,7 +483,7 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         auto rect = KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat());
         std::string rectData((const char *)&rect, sizeof(KRRect));
         auto value = std::make_shared<KRRenderValue>(rectData);
-        renderLayerHandler_->SetProp(arg1->toInt(), "frame", value);
+        renderLayerHandler_->SetProp(arg1->toInt(), KRPropKey::kFrame, kFramePropKey, value);
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSize: {
@@ -285,7 +497,7 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
             std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
             callback = [weakSelf, arg4](KRAnyValue res) {
                 if (auto locked = weakSelf.lock()) {
-                    PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
+                    locked->PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
                         if (auto locked = weakSelf.lock()) {
                             locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg4,
                                                      res, locked->defaultNullValue_, locked->defaultNullValue_,
@@ -307,7 +519,7 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
             std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
             callback = [weakSelf, arg4](KRAnyValue res) {
                 if (auto locked = weakSelf.lock()) {
-                    PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
+                    locked->PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
                         if (auto locked = weakSelf.lock()) {
                             locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg4,
                                                      res, locked->defaultNullValue_, locked->defaultNullValue_,
@@ -354,13 +566,21 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout: {
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        PerformTaskOnContextQueue(false, arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2] {
-            if (auto lock = weakSelf.lock()) {
-                auto nullValue = lock->defaultNullValue_;
-                lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2, nullValue,
-                                       nullValue, nullValue, nullValue);
-            }
-        });
+        auto seq = ++timerSeq_;
+        auto timerId = KRContextScheduler::ScheduleTask(
+            context_->InstanceId(), contextShard_, false, arg1->toInt() > 0 ? arg1->toInt() : 1,
+            [weakSelf, arg2, seq] {
+                if (auto lock = weakSelf.lock()) {
+                    if (lock->pendingTimers_.erase(seq) == 0) {
+                        return;  // 已随页面销毁取消
+                    }
+                    auto nullValue = lock->defaultNullValue_;
+                    lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2,
+                                           nullValue, nullValue, nullValue, nullValue);
+                }
+            },
+            KRTaskPriority::kTimer);
+        pendingTimers_[seq] = timerId;
         break;
     }
 
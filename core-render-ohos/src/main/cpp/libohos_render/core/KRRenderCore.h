@@ -19,9 +19,14 @@
 /**
  * 负责渲染流程核心逻辑模块。
  */
+#include <unordered_map>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/performance/KRBridgeStats.h"
+#include "libohos_render/scheduler/KRInstanceShards.h"
 #include "libohos_render/scheduler/KRUIScheduler.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -60,6 +65,8 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
                  std::shared_ptr<KRRenderValue> &arg1, std::shared_ptr<KRRenderValue> &arg2,
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5) override;
+    /** ICallNativeCallback interface override, 运行在 context 线程 */
+    void OnCallNativeBatch(const uint8_t *data, size_t length) override;
     /** KRRenderUISchedulerDelegate interface override */
     void WillPerformUITasksWithScheduler() override;
     /** core初始化之后必须调用该DidInit进行初始化 */
@@ -123,6 +130,8 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     std::weak_ptr<IKRRenderView> renderView_;
     /** 页面上下文，包含page_name, page_data, 执行模式*/
     std::shared_ptr<KRRenderContextParams> context_;
+    /** 页面所属Context线程分片，调度时免去按instanceId查表；所有页面共用一条Context线程时为空 */
+    std::shared_ptr<KRInstanceShard> contextShard_;
     /** Kotlin产物侧协议的实现者 */
     std::shared_ptr<IKRRenderNativeContextHandler> contextHandler_;
     /** C-API渲染层协议的实现者 */
@@ -131,6 +140,19 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     std::shared_ptr<KRRenderValue> defaultNullValue_;
     /** 正在从主线程同步任务到context线程 */
     bool syncingPerformTaskMainThreadToContextThread = false;
+    /** 批量指令驻留的属性名，下标为prop_id（仅主线程访问） */
+    std::vector<std::string> commandPropKeys_;
+    /** 与commandPropKeys_一一对应的内置属性ID */
+    std::vector<KRPropKey> commandPropKeyIds_;
+    /** 批量指令解码时复用的viewName缓冲（仅主线程访问） */
+    std::string commandViewName_;
+    /** 批量指令解码复用的属性值（仅主线程访问） */
+    KRAnyValue commandValue_;
+    /** 未触发的setTimeout定时器，key为页面内序号（仅context线程访问），页面销毁时统一取消 */
+    std::unordered_map<uint64_t, KRTimerId> pendingTimers_;
+    uint64_t timerSeq_ = 0;
+    /** Kotlin调用Native统计，由页面性能管理器持有 */
+    std::shared_ptr<KRBridgeStats> bridgeStats_;
 
     /** callback 是否为同步方法 */
     bool IsSyncCallback(const KRAnyValue &params);
@@ -142,9 +164,19 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     /** 执行kotlin call native方法*/
     KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                                      const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
+    /** 在主线程解码并执行批量指令 */
+    void PerformNativeCommandBuffer(const uint8_t *data, size_t length);
+    /** 批量指令中的属性值转换为KRRenderValue，返回的引用在下一次解码前有效 */
+    const KRAnyValue &ReadCommandValue(KRRenderCommandReader &reader);
+    template <typename T> const KRAnyValue &ReuseCommandValue(T value);
     bool ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5);
 
     void OnDestroy();
+    /** 任务在页面所属的context线程中执行 */
+    void PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task,
+                                   KRTaskPriority priority = KRTaskPriority::kCallback);
+    /** 取消页面所有未触发的setTimeout定时器 */
+    void CancelPendingTimers();
 };
 
 #endif  // CORE_RENDER_OHOS_KRRenderCore_H
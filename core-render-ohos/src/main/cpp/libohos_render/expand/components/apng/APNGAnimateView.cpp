@@ -17,6 +17,7 @@
 
 #include "libohos_render/expand/components/apng/APNGCache.h"
 #include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 /**
  * 实例初始化构造器
@@ -49,19 +50,25 @@ void APNGAnimateView::Init(std::string &filePath, ArkUI_NodeHandle parentNode, b
 
 void APNGAnimateView::Destroy() {
     Stop();
+    if (frame_stream_) {
+        frame_stream_->Cancel();
+    }
     if (parent_node_) {
         kuikly::util::GetNodeApi()->removeChild(parent_node_, image_node_);
         kuikly::util::GetNodeApi()->disposeNode(image_node_);
         image_node_ = nullptr;
         parent_node_ = nullptr;
     }
+    current_drawable_ = nullptr;
 }
 
 APNGAnimateView::~APNGAnimateView() {
     Destroy();
-    KRGCDQueue::GetInstance().DispatchAsync([apng = apng_] {
-        apng->width;  // sub thread gc
-    });
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [apng = apng_, frame_stream = frame_stream_] {
+            // sub thread gc
+        },
+        KRQoS::kBackground);
 }
 
 void APNGAnimateView::SetAutoPlay(bool auto_play) {
@@ -109,6 +116,9 @@ void APNGAnimateView::SetFrame(KRRect parent_frame) {
 void APNGAnimateView::LoadSuccess(std::shared_ptr<APNG> apng) {
     // 开始播放
     apng_ = apng;
+    if (apng_->IsStreaming()) {
+        frame_stream_ = std::make_shared<APNGFrameStream>(apng_);
+    }
     SyncAutoPlayIfNeed();
     if (animation_start_callback_) {
         animation_start_callback_();
@@ -122,27 +132,33 @@ void APNGAnimateView::LoadFailure() {
     }
 }
 
+std::shared_ptr<APNGDrawable> APNGAnimateView::GetDrawable(int index) {
+    if (frame_stream_) {
+        return frame_stream_->GetDrawable(index);
+    }
+    return apng_->GetDrawable(index);
+}
+
 void APNGAnimateView::PlayNextFrame() {
     if (apng_->frames.size() == 0) {
         return;
     }
     bool need_play_next_frame = true;
 
-    std::shared_ptr<APNGDrawable> apngDrawable = apng_->GetDrawable(current_frame_index_ + 1);
-    if (apngDrawable == nullptr) {
-        if (!(apng_->IsParsing())) {  // 说明最后一个了
-            did_play_loop_count_ += 1;
-            if (did_play_loop_count_ < repeat_count_) {
-                current_frame_index_ = 0;
-                apngDrawable = apng_->GetDrawable(current_frame_index_);
-            } else {
-                need_play_next_frame = false;
-            }
-        } else {  // 还在解析 延迟等待
-            need_play_next_frame = true;
+    int next_index = current_frame_index_ + 1;
+    if (!apng_->IsParsing() && next_index >= apng_->DrawableCount()) {  // 说明最后一个了
+        did_play_loop_count_ += 1;
+        if (apng_->DrawableCount() > 0 && did_play_loop_count_ < repeat_count_) {
+            next_index = 0;
+        } else {
+            need_play_next_frame = false;
         }
-    } else {
-        current_frame_index_ += 1;
+    }
+    std::shared_ptr<APNGDrawable> apngDrawable = nullptr;
+    if (need_play_next_frame) {
+        apngDrawable = GetDrawable(next_index);
+        // 未取到时（还在解析或流式解码未完成）停留在上一帧，延迟后重试
+        current_frame_index_ = apngDrawable ? next_index : next_index - 1;
     }
     if (apngDrawable && apngDrawable->isLast && did_play_loop_count_ + 1 >= repeat_count_) {
         need_play_next_frame = false;
@@ -177,6 +193,7 @@ void APNGAnimateView::PlayNextFrame() {
 void APNGAnimateView::UpdateCurrentFrameToRender(std::shared_ptr<APNGDrawable> apngDrawable) {
     if (apngDrawable && apngDrawable->drawable) {
         kuikly::util::SetArkUIImageSrc(image_node_, apngDrawable->drawable);
+        current_drawable_ = apngDrawable;
     }
 }
 
@@ -111,6 +111,8 @@ class APNGAnimateView : public std::enable_shared_from_this<APNGAnimateView> {
     ArkUI_NodeHandle parent_node_ = nullptr;  // 父节点句柄
     ArkUI_NodeHandle image_node_ = nullptr;   // 图片节点句柄
     std::shared_ptr<APNG> apng_ = nullptr;    // APNG 动画对象
+    std::shared_ptr<APNGFrameStream> frame_stream_ = nullptr;  // 流式解码器，仅大动画使用
+    std::shared_ptr<APNGDrawable> current_drawable_ = nullptr; // 正在显示的帧，替换前需保持有效
     bool auto_play_ = true;                   // 是否自动播放
     int32_t current_frame_index_ = -1;        // 当前帧索引
     int32_t play_timeout_flag_ = -1;          // 播放超时标志
@@ -134,6 +136,11 @@ class APNGAnimateView : public std::enable_shared_from_this<APNGAnimateView> {
      */
     void LoadFailure();
 
+    /**
+     * 获取第 index 个可播放帧，流式模式下可能尚未解码完成而返回 nullptr
+     */
+    std::shared_ptr<APNGDrawable> GetDrawable(int index);
+
     /**
      * 播放下一帧
      */
@@ -0,0 +1,143 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGBlendKernels.h"
+
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// x / 255 四舍五入，x 取值范围 [0, 65535] 时结果精确
+static inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+void APNGBlendRowOverScalar(uint8_t *dst, const uint8_t *src, int pixel_count) {
+    for (int i = 0; i < pixel_count; ++i, src += 4, dst += 4) {
+        uint32_t sa = src[3];
+        if (sa == 255) {
+            memcpy(dst, src, 4);
+            continue;
+        }
+        if (sa == 0) {
+            continue;
+        }
+        uint32_t isa = 255 - sa;
+        uint32_t da = dst[3];
+        if (da == 255) {  // 目标不透明：out = src * sa + dst * (1 - sa)
+            dst[0] = Div255(src[0] * sa + dst[0] * isa);
+            dst[1] = Div255(src[1] * sa + dst[1] * isa);
+            dst[2] = Div255(src[2] * sa + dst[2] * isa);
+            continue;
+        }
+        // 通用情况，权重均以 255^2 为单位
+        uint32_t src_weight = sa * 255;
+        uint32_t dst_weight = da * isa;
+        uint32_t out_weight = src_weight + dst_weight;
+        uint32_t half = out_weight / 2;
+        dst[0] = (src[0] * src_weight + dst[0] * dst_weight + half) / out_weight;
+        dst[1] = (src[1] * src_weight + dst[1] * dst_weight + half) / out_weight;
+        dst[2] = (src[2] * src_weight + dst[2] * dst_weight + half) / out_weight;
+        dst[3] = Div255(out_weight);
+    }
+}
+
+#if defined(__aarch64__)
+
+// (src * sa + dst * isa) / 255，每通道 16 个像素
+static inline uint8x16_t BlendOpaqueChannel(uint8x16_t src, uint8x16_t dst, uint8x16_t sa, uint8x16_t isa) {
+    uint16x8_t lo = vmull_u8(vget_low_u8(src), vget_low_u8(sa));
+    lo = vmlal_u8(lo, vget_low_u8(dst), vget_low_u8(isa));
+    uint16x8_t hi = vmull_u8(vget_high_u8(src), vget_high_u8(sa));
+    hi = vmlal_u8(hi, vget_high_u8(dst), vget_high_u8(isa));
+    return vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+}
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, int pixel_count) {
+    int i = 0;
+    for (; i + 16 <= pixel_count; i += 16, src += 64, dst += 64) {
+        uint8x16x4_t s = vld4q_u8(src);
+        if (vminvq_u8(s.val[3]) == 255) {
+            memcpy(dst, src, 64);
+            continue;
+        }
+        if (vmaxvq_u8(s.val[3]) == 0) {
+            continue;
+        }
+        uint8x16x4_t d = vld4q_u8(dst);
+        if (vminvq_u8(d.val[3]) != 255) {
+            APNGBlendRowOverScalar(dst, src, 16);
+            continue;
+        }
+        uint8x16_t isa = vmvnq_u8(s.val[3]);
+        d.val[0] = BlendOpaqueChannel(s.val[0], d.val[0], s.val[3], isa);
+        d.val[1] = BlendOpaqueChannel(s.val[1], d.val[1], s.val[3], isa);
+        d.val[2] = BlendOpaqueChannel(s.val[2], d.val[2], s.val[3], isa);
+        vst4q_u8(dst, d);
+    }
+    APNGBlendRowOverScalar(dst, src, pixel_count - i);
+}
+
+#elif defined(__SSE2__)
+
+// (src * sa + dst * isa) / 255，两个像素展开为 16 位后计算
+static inline __m128i BlendOpaqueHalf(__m128i src, __m128i dst) {
+    __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+    __m128i isa = _mm_sub_epi16(_mm_set1_epi16(255), sa);
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(src, sa), _mm_mullo_epi16(dst, isa));
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, int pixel_count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    constexpr int kAlphaBits = 0x8888;  // movemask 中 4 个像素 alpha 字节对应的位
+    int i = 0;
+    for (; i + 4 <= pixel_count; i += 4, src += 16, dst += 16) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if ((_mm_movemask_epi8(_mm_cmpeq_epi8(s, ones)) & kAlphaBits) == kAlphaBits) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), s);
+            continue;
+        }
+        if ((_mm_movemask_epi8(_mm_cmpeq_epi8(s, zero)) & kAlphaBits) == kAlphaBits) {
+            continue;
+        }
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+        if ((_mm_movemask_epi8(_mm_cmpeq_epi8(d, ones)) & kAlphaBits) != kAlphaBits) {
+            APNGBlendRowOverScalar(dst, src, 4);
+            continue;
+        }
+        __m128i lo = BlendOpaqueHalf(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = BlendOpaqueHalf(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        __m128i out = _mm_or_si128(_mm_packus_epi16(lo, hi), alpha_mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), out);
+    }
+    APNGBlendRowOverScalar(dst, src, pixel_count - i);
+}
+
+#else
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, int pixel_count) {
+    APNGBlendRowOverScalar(dst, src, pixel_count);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGBLENDKERNELS_H
+#define CORE_RENDER_OHOS_APNGBLENDKERNELS_H
+
+#include <cstdint>
+
+/**
+ * 将一行 src 像素以 APNG_BLEND_OP_OVER 方式合成到 dst（非预乘 RGBA_8888）
+ * arm64 使用 NEON、x86_64 使用 SSE2 加速，其余平台使用标量实现
+ */
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, int pixel_count);
+
+/**
+ * APNGBlendRowOver 的标量实现，也用于处理向量化剩余的像素
+ */
+void APNGBlendRowOverScalar(uint8_t *dst, const uint8_t *src, int pixel_count);
+
+#endif  // CORE_RENDER_OHOS_APNGBLENDKERNELS_H
@@ -0,0 +1,199 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGCache.h"
+
+#include <cstdio>
+#include "libohos_render/expand/components/apng/APNGPixelmapCodec.h"
+#include "libohos_render/expand/components/apng/ApngParser.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRJSONCodec.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+constexpr int kMemoryLevelModerate = 0;  // AbilityConstant.MemoryLevel.MEMORY_LEVEL_MODERATE
+
+static bool ReadFileToBuffer(const std::string &filePath, std::vector<uint8_t> &buffer) {
+    FILE *file = fopen(filePath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    std::int32_t fileSize = ftell(file);
+    if (fileSize != -1) {
+        fseek(file, 0, SEEK_SET);
+        buffer.resize(fileSize);
+        fread(buffer.data(), 1, fileSize, file);
+    }
+    fclose(file);
+
+    return true;
+}
+
+APNGCache &APNGCache::GetInstance() {
+    static APNGCache *instance = new APNGCache();  // 进程级单例，不析构
+    return *instance;
+}
+
+std::shared_ptr<APNG> APNGCache::Get(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto apng = cache_.Get(key);
+    if (apng == nullptr) {
+        miss_count_++;
+        return nullptr;
+    }
+    hit_count_++;
+    return *apng;
+}
+
+void APNGCache::Put(const std::string &key, const std::shared_ptr<APNG> &apng) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.Put(key, apng, apng->MemoryCost(), evicted);  // 超过总容量的条目不缓存
+    }
+    ReleaseAsync(std::move(evicted));
+}
+
+void APNGCache::SetMaxBytes(size_t max_bytes) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.SetMaxBytes(max_bytes, evicted);
+    }
+    ReleaseAsync(std::move(evicted));
+}
+
+void APNGCache::TrimToSize(size_t max_bytes) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.TrimToSize(max_bytes, evicted);
+    }
+    ReleaseAsync(std::move(evicted));
+}
+
+void APNGCache::OnMemoryLevel(int level) {
+    size_t max_bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_bytes = level <= kMemoryLevelModerate ? cache_.MaxBytes() / 2 : 0;
+    }
+    KR_LOG_INFO << "APNGCache trim on memory level: " << level << ", trim to: " << max_bytes;
+    TrimToSize(max_bytes);
+}
+
+APNGCache::Stats APNGCache::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.hit_count = hit_count_;
+    stats.miss_count = miss_count_;
+    stats.eviction_count = cache_.EvictionCount();
+    stats.entry_count = cache_.Size();
+    stats.total_bytes = cache_.TotalBytes();
+    stats.max_bytes = cache_.MaxBytes();
+    return stats;
+}
+
+std::string APNGCache::GetStatsJson() {
+    auto stats = GetStats();
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("hitCount");
+    writer.Int(stats.hit_count);
+    writer.Key("missCount");
+    writer.Int(stats.miss_count);
+    writer.Key("evictionCount");
+    writer.Int(stats.eviction_count);
+    writer.Key("entryCount");
+    writer.Int(stats.entry_count);
+    writer.Key("totalBytes");
+    writer.Int(stats.total_bytes);
+    writer.Key("maxBytes");
+    writer.Int(stats.max_bytes);
+    writer.EndObject();
+    return json;
+}
+
+void APNGCache::ReleaseAsync(std::vector<std::shared_ptr<APNG>> &&evicted) {
+    if (evicted.empty()) {
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [evicted = std::move(evicted)] {
+            // sub thread release
+        },
+        KRQoS::kBackground);
+}
+
+void FetchAPNG(const std::string &filePath, std::function<void(std::shared_ptr<APNG>)> completion) {
+    // 仅在主线程访问
+    static std::unordered_map<std::string, std::vector<std::function<void(std::shared_ptr<APNG>)>>> pendingRequests;
+
+    if (auto apng = APNGCache::GetInstance().Get(filePath)) {
+        // 使用缓存的APNG
+        completion(apng);
+        return;
+    }
+
+    {
+        auto it = pendingRequests.find(filePath);
+        if (it != pendingRequests.end()) {
+            // 如果已经有一个相同的请求正在进行，将回调函数添加到列表中
+            it->second.push_back(completion);
+            return;
+        } else {
+            // 如果没有相同的请求正在进行，创建一个新的回调函数列表
+            pendingRequests[filePath] = {completion};
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    KRGCDQueue::GetInstance().DispatchAsync([filePath, start]() {
+        std::vector<uint8_t> buffer;
+        bool res = ReadFileToBuffer(filePath, buffer);
+        auto end0 = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start);
+
+        parseAPNG(buffer, APNGPixelmapCodec::GetInstance(), [end0, duration, filePath](std::shared_ptr<APNG> apng) {
+            auto end1 = std::chrono::steady_clock::now();
+            auto duration1 = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0);
+            bool isValidApng = apng && apng->isAPNG && apng->frames.size();
+            KR_LOG_INFO << "ReadFileToBuffer cost time:" << (duration).count() << " parse apng c:" << duration1.count();
+            KRMainThread::RunOnMainThread([filePath, apng, isValidApng] {
+                auto it = pendingRequests.find(filePath);
+                if (it != pendingRequests.end()) {
+                    std::vector<std::function<void(std::shared_ptr<APNG>)>> completions = std::move(it->second);
+                    pendingRequests.erase(it);
+
+                    if (isValidApng) {
+                        APNGCache::GetInstance().Put(filePath, apng);
+                    }
+
+                    for (const auto &completion : completions) {
+                        if (isValidApng) {
+                            // 加载成功
+                            completion(apng);
+                        } else {
+                            // 播放失败
+                            completion(nullptr);
+                        }
+                    }
+                }
+            });
+        });
+    }, KRQoS::kUserInitiated);
+}
@@ -0,0 +1,93 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGCompositor.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include "libohos_render/expand/components/apng/APNGBlendKernels.h"
+
+APNGCompositor::APNGCompositor(int width, int height) : width_(width), height_(height) {
+    canvas_.assign(static_cast<size_t>(width) * height * 4, 0);
+}
+
+void APNGCompositor::Reset() {
+    std::fill(canvas_.begin(), canvas_.end(), 0);
+    previous_region_.clear();
+}
+
+bool APNGCompositor::Contains(const APNGFrameRegion &region) const {
+    // 以减法比较，避免 left + width 溢出
+    return region.width > 0 && region.height > 0 && region.left >= 0 && region.top >= 0 &&
+           region.left <= width_ - region.width && region.top <= height_ - region.height;
+}
+
+bool APNGCompositor::ComposeFrame(const APNGFrameRegion &region, const uint8_t *pixels) {
+    if (!Contains(region) || pixels == nullptr) {
+        return false;
+    }
+    size_t frameRowBytes = static_cast<size_t>(region.width) * 4;
+    if (region.disposeOp == 2) {  // 仅保存帧区域绘制前的内容，输出后恢复
+        previous_region_.resize(frameRowBytes * region.height);
+        for (int y = 0; y < region.height; ++y) {
+            memcpy(previous_region_.data() + y * frameRowBytes, CanvasRow(region, y), frameRowBytes);
+        }
+    } else {
+        previous_region_.clear();
+    }
+    BlendFrame(region, pixels);
+    return true;
+}
+
+void APNGCompositor::BlendFrame(const APNGFrameRegion &region, const uint8_t *pixels) {
+    if (!Contains(region)) {
+        return;
+    }
+    // 根据 blendOp 逐行合成帧
+    size_t frameRowBytes = static_cast<size_t>(region.width) * 4;
+    for (int y = 0; y < region.height; ++y) {
+        const uint8_t *src = pixels + y * frameRowBytes;
+        uint8_t *dst = CanvasRow(region, y);
+        if (region.blendOp == 0) {  // 覆盖操作
+            memcpy(dst, src, frameRowBytes);
+        } else if (region.blendOp == 1) {
+            APNGBlendRowOver(dst, src, region.width);
+        }
+    }
+}
+
+void APNGCompositor::DisposeFrame(const APNGFrameRegion &region) {
+    if (!Contains(region)) {
+        return;
+    }
+    size_t frameRowBytes = static_cast<size_t>(region.width) * 4;
+    if (region.disposeOp == 1) {  // 清除当前帧区域
+        for (int y = 0; y < region.height; ++y) {
+            memset(CanvasRow(region, y), 0, frameRowBytes);
+        }
+    } else if (region.disposeOp == 2) {  // 恢复到绘制该帧之前的画面
+        if (previous_region_.size() != frameRowBytes * region.height) {
+            return;  // 恢复点不属于该帧（如该帧未合成），不能按该帧尺寸拷贝
+        }
+        for (int y = 0; y < region.height; ++y) {
+            memcpy(CanvasRow(region, y), previous_region_.data() + y * frameRowBytes, frameRowBytes);
+        }
+    }
+}
+
+uint8_t *APNGCompositor::CanvasRow(const APNGFrameRegion &region, int y) {
+    return canvas_.data() + ((static_cast<size_t>(region.top) + y) * width_ + region.left) * 4;
+}
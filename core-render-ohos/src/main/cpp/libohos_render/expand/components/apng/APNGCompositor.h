@@ -0,0 +1,85 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGCOMPOSITOR_H
+#define CORE_RENDER_OHOS_APNGCOMPOSITOR_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * 帧在画布上的区域与合成方式，取值同 fcTL 块
+ */
+struct APNGFrameRegion {
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+    int disposeOp = 0;
+    int blendOp = 0;
+};
+
+/**
+ * APNG 帧合成器：按播放顺序对已解码的帧执行 blend / dispose，输出完整画布的 RGBA 数据。
+ * 所有写画布的操作都先校验帧区域，超出画布的帧不会修改画布
+ */
+class APNGCompositor {
+ public:
+    APNGCompositor(int width, int height);
+
+    /**
+     * 清空画布，从首帧重新合成
+     */
+    void Reset();
+
+    /**
+     * 帧区域是否非空且完全位于画布内
+     */
+    bool Contains(const APNGFrameRegion &region) const;
+
+    /**
+     * 合成一帧，pixels 为 region.width * region.height 个 RGBA 像素；成功后 Canvas() 为该帧的完整画面
+     * @return 帧区域超出画布时返回 false，画布不变
+     */
+    bool ComposeFrame(const APNGFrameRegion &region, const uint8_t *pixels);
+
+    /**
+     * 画面输出后执行该帧的 dispose 操作；帧区域非法或恢复点不属于该帧时忽略
+     */
+    void DisposeFrame(const APNGFrameRegion &region);
+
+    const std::vector<uint8_t> &Canvas() const {
+        return canvas_;
+    }
+
+    /**
+     * 供调用方解码帧像素时复用的缓冲区
+     */
+    std::vector<uint8_t> &DecodeBuffer() {
+        return frame_buffer_;
+    }
+
+ private:
+    void BlendFrame(const APNGFrameRegion &region, const uint8_t *pixels);
+    uint8_t *CanvasRow(const APNGFrameRegion &region, int y);
+
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<uint8_t> canvas_;
+    std::vector<uint8_t> previous_region_;  // dispose_op 为 2 时帧区域的恢复点
+    std::vector<uint8_t> frame_buffer_;     // 当前帧解码结果，复用内存
+};
+
+#endif  // CORE_RENDER_OHOS_APNGCOMPOSITOR_H
@@ -0,0 +1,139 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGPixelmapCodec.h"
+
+#include <arkui/drawable_descriptor.h>
+#include <multimedia/image_framework/image/image_common.h>
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include "libohos_render/utils/KRRenderLoger.h"
+
+/**
+ * 持有 Pixelmap 与 DrawableDescriptor 的帧，析构时释放
+ */
+class APNGPixelmapDrawable : public APNGDrawable {
+ public:
+    ~APNGPixelmapDrawable() override {
+        if (drawable) {
+            OH_ArkUI_DrawableDescriptor_Dispose(drawable);
+            drawable = nullptr;
+        }
+        if (pixelmap) {
+            OH_PixelmapNative_Release(pixelmap);
+            pixelmap = nullptr;
+        }
+    }
+};
+
+static OH_PixelmapNative *CreatePixelMap(const Frame &frame) {
+    // 创建ImageSource实例
+    OH_ImageSourceNative *source = nullptr;
+
+    auto &buffer = frame.data;
+    Image_ErrorCode errCode = OH_ImageSourceNative_CreateFromData(buffer.data(), buffer.size(), &source);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreateFromData failed, errCode: "
+                     << errCode;
+        return nullptr;
+    }
+
+    OH_DecodingOptions *ops = nullptr;
+    OH_DecodingOptions_Create(&ops);
+    // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
+    OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
+    OH_DecodingOptions_SetPixelFormat(ops, PIXEL_FORMAT_RGBA_8888);
+    OH_PixelmapNative *resPixMap = nullptr;
+    // ops参数支持传入nullptr, 当不需要设置解码参数时，不用创建
+    errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &resPixMap);
+    OH_DecodingOptions_Release(ops);
+    OH_ImageSourceNative_Release(source);
+
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreatePixelmap failed, errCode: "
+                     << errCode;
+        return nullptr;
+    }
+    return resPixMap;
+}
+
+static bool PixelmapToBitmapBuffer(OH_PixelmapNative *pixelmap, size_t bufferSize, std::vector<uint8_t> &buffer) {
+    if (pixelmap == nullptr) {
+        return false;
+    }
+    buffer.resize(bufferSize);
+    Image_ErrorCode errCode = OH_PixelmapNative_ReadPixels(pixelmap, buffer.data(), &bufferSize);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest PixelMapToBitmapBuffer failed, errCode: " << errCode;
+        buffer.clear();
+        return false;
+    }
+    return true;
+}
+
+static OH_PixelmapNative *BitmapBufferToPixelmap(size_t bufferSize, int width, int height,
+                                                 const std::vector<uint8_t> &buffer) {
+    OH_PixelmapNative *resPixMap = nullptr;
+    OH_Pixelmap_InitializationOptions *createOpts;
+    OH_PixelmapInitializationOptions_Create(&createOpts);
+    OH_PixelmapInitializationOptions_SetWidth(createOpts, width);
+    OH_PixelmapInitializationOptions_SetHeight(createOpts, height);
+    OH_PixelmapInitializationOptions_SetPixelFormat(createOpts, PIXEL_FORMAT_RGBA_8888);
+    // OH_PixelmapInitializationOptions_SetAlphaType(createOpts, PIXELMAP_ALPHA_TYPE_);
+
+    Image_ErrorCode errCode = OH_PixelmapNative_CreateEmptyPixelmap(createOpts, &resPixMap);
+    OH_PixelmapInitializationOptions_Release(createOpts);
+
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "BitmapBufferToPixelmap sourceTest OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: "
+                     << errCode;
+        return nullptr;
+    }
+
+    errCode = OH_PixelmapNative_WritePixels(resPixMap, const_cast<uint8_t *>(buffer.data()), bufferSize);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "BitmapBufferToPixelmap BitmapBufferToPixelmap sourceTest OH_PixelmapNative_WritePixels "
+                        "failed, errCode: "
+                     << errCode;
+        OH_PixelmapNative_Release(resPixMap);
+        return nullptr;
+    }
+
+    return resPixMap;
+}
+
+APNGPixelmapCodec *APNGPixelmapCodec::GetInstance() {
+    static APNGPixelmapCodec *instance = new APNGPixelmapCodec();  // 进程级单例，不析构
+    return instance;
+}
+
+bool APNGPixelmapCodec::Decode(const Frame &frame, std::vector<uint8_t> &pixels) {
+    auto framePixelmap = CreatePixelMap(frame);
+    bool success = PixelmapToBitmapBuffer(framePixelmap, static_cast<size_t>(frame.width) * frame.height * 4, pixels);
+    if (framePixelmap) {
+        OH_PixelmapNative_Release(framePixelmap);
+    }
+    return success;
+}
+
+std::shared_ptr<APNGDrawable> APNGPixelmapCodec::MakeDrawable(int width, int height,
+                                                              const std::vector<uint8_t> &canvas) {
+    auto drawable = std::make_shared<APNGPixelmapDrawable>();
+    drawable->pixelmap = BitmapBufferToPixelmap(canvas.size(), width, height, canvas);
+    if (drawable->pixelmap) {
+        drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
+    }
+    return drawable->drawable ? drawable : nullptr;
+}
@@ -0,0 +1,35 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGPIXELMAPCODEC_H
+#define CORE_RENDER_OHOS_APNGPIXELMAPCODEC_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+
+/**
+ * 设备上的帧编解码：OH_ImageSource 解码帧数据，画布像素写入 Pixelmap 并生成 DrawableDescriptor
+ */
+class APNGPixelmapCodec : public APNGFrameCodec {
+ public:
+    static APNGPixelmapCodec *GetInstance();
+
+    bool Decode(const Frame &frame, std::vector<uint8_t> &pixels) override;
+    std::shared_ptr<APNGDrawable> MakeDrawable(int width, int height, const std::vector<uint8_t> &canvas) override;
+};
+
+#endif  // CORE_RENDER_OHOS_APNGPIXELMAPCODEC_H
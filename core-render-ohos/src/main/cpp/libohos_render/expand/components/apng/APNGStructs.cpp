@@ -15,8 +15,13 @@
 
 #include "libohos_render/expand/components/apng/APNGStructs.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+// 默认内存预算：超过后改为流式解码（约等于 30 帧 512x512 RGBA）
+static std::atomic<size_t> gAPNGMemoryBudget{32 * 1024 * 1024};
 
 void Frame::SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer) {
     if (width == 0) {
@@ -36,225 +41,221 @@ void Frame::SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer) {
     }
 }
 
-static OH_PixelmapNative *CreatePixelMap(std::shared_ptr<Frame> frame) {
-    // 创建ImageSource实例
-    OH_ImageSourceNative *source = nullptr;
-
-    auto &buffer = frame->data;
-    Image_ErrorCode errCode = OH_ImageSourceNative_CreateFromData(buffer.data(), buffer.size(), &source);
-    if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreateFromData failed, errCode: "
-                     << errCode;
-        return nullptr;
-    }
-
-    OH_DecodingOptions *ops = nullptr;
-    OH_DecodingOptions_Create(&ops);
-    // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
-    OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
-    OH_DecodingOptions_SetPixelFormat(ops, PIXEL_FORMAT_RGBA_8888);
-    OH_PixelmapNative *resPixMap = nullptr;
-    // ops参数支持传入nullptr, 当不需要设置解码参数时，不用创建
-    errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &resPixMap);
-    OH_DecodingOptions_Release(ops);
-
-    if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreatePixelmap failed, errCode: "
-                     << errCode;
-        return nullptr;
-    }
-    return resPixMap;
-}
-
-static bool PixelmapToBitmapBuffer(OH_PixelmapNative *pixelmap, size_t bufferSize, std::vector<uint8_t> &buffer) {
-    buffer.clear();
-    buffer.reserve(bufferSize);
-    Image_ErrorCode errCode = OH_PixelmapNative_ReadPixels(pixelmap, buffer.data(), &bufferSize);
-    if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest PixelMapToBitmapBuffer failed, errCode: " << errCode;
-        buffer.clear();
+/**
+ * 解码帧数据并交给合成器，帧区域超出画布时不解码
+ */
+static bool ComposeFrame(APNGFrameCodec &codec, APNGCompositor &compositor, const Frame &frame) {
+    auto region = frame.Region();
+    if (!compositor.Contains(region)) {
         return false;
     }
-    return true;
+    auto &buffer = compositor.DecodeBuffer();
+    bool frameDecodeSuccess = codec.Decode(frame, buffer) &&
+                              buffer.size() == static_cast<size_t>(frame.width) * frame.height * 4;
+    return frameDecodeSuccess && compositor.ComposeFrame(region, buffer.data());
 }
 
-static OH_PixelmapNative *BitmapBufferToPixelmap(size_t bufferSize, int width, int height,
-                                                 std::vector<uint8_t> &buffer) {
-    OH_PixelmapNative *resPixMap = nullptr;
-    OH_Pixelmap_InitializationOptions *createOpts;
-    OH_PixelmapInitializationOptions_Create(&createOpts);
-    OH_PixelmapInitializationOptions_SetWidth(createOpts, width);
-    OH_PixelmapInitializationOptions_SetHeight(createOpts, height);
-    OH_PixelmapInitializationOptions_SetPixelFormat(createOpts, PIXEL_FORMAT_RGBA_8888);
-    // OH_PixelmapInitializationOptions_SetAlphaType(createOpts, PIXELMAP_ALPHA_TYPE_);
-
-    Image_ErrorCode errCode = OH_PixelmapNative_CreateEmptyPixelmap(createOpts, &resPixMap);
-
-    if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "BitmapBufferToPixelmap sourceTest OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: "
-                     << errCode;
-        return nullptr;
-    }
-
-    errCode = OH_PixelmapNative_WritePixels(resPixMap, buffer.data(), bufferSize);
-    if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "BitmapBufferToPixelmap BitmapBufferToPixelmap sourceTest OH_PixelmapNative_WritePixels "
-                        "failed, errCode: "
-                     << errCode;
-        return nullptr;
-    }
+void APNG::SetMemoryBudget(size_t bytes) {
+    gAPNGMemoryBudget.store(bytes);
+}
 
-    return resPixMap;
+size_t APNG::GetMemoryBudget() {
+    return gAPNGMemoryBudget.load();
 }
 
+APNG::APNG(APNGFrameCodec *codec) : codec(codec) {}
+
 APNG::~APNG() {
     std::unique_lock<std::mutex> lock(drawableMutex);
-    for (const auto &drawable : animateDrawables) {
-        if (drawable && drawable->pixelmap) {
-            OH_PixelmapNative_Release(drawable->pixelmap);
-        }
-        if (drawable && drawable->drawable) {
-            OH_ArkUI_DrawableDescriptor_Dispose(drawable->drawable);
+    animateDrawables.clear();
+}
+
+void APNG::WillParseFrame() {
+    isParsing.store(true);
+    size_t decodedSize = static_cast<size_t>(width) * height * 4 * frames.size();
+    streaming = decodedSize > GetMemoryBudget();
+    if (!streaming) {
+        compositor = std::make_unique<APNGCompositor>(width, height);
+        memoryCost = decodedSize;
+    } else {
+        memoryCost = 0;
+        for (const auto &frame : frames) {
+            for (const auto &part : frame->dataParts) {
+                memoryCost += part.size();
+            }
         }
-        drawable->drawable = nullptr;
-        drawable->pixelmap = nullptr;
     }
-    animateDrawables.clear();
 }
 
 bool APNG::DidAddFrame(std::shared_ptr<Frame> frame, int index) {
     if (frame->width == 0 || frame->height == 0) {
         return false;
     }
-    bool didHandled = false;
-    // 首个完整帧
-    if (frame->width == width && frame->height == height && !hasFirstFullFrame) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = CreatePixelMap(frame);
-        if (drawable->pixelmap) {
-            hasFirstFullFrame = true;
-            drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-            didHandled = true;
-            size_t bufferSize = width * height * 4;
-            AddDrawable(drawable, index);
-            lazyBeforeNextFrameTask = [needApplyPixelmap = drawable->pixelmap, frame, bufferSize, this]() {
-                PixelmapToBitmapBuffer(needApplyPixelmap, bufferSize, this->curBitmapBuffer);
-                HandlePostFrameDisposeOp(frame);
-            };
+    // 首个完整帧之前的帧无法合成
+    if (!hasFirstFullFrame) {
+        if (frame->width != width || frame->height != height) {
+            return false;
         }
-    } else if (hasFirstFullFrame) {  // 非完整帧依赖合成
-        size_t bufferSize = width * height * 4;
-        if (this->lazyBeforeNextFrameTask) {
-            this->lazyBeforeNextFrameTask();
-            this->lazyBeforeNextFrameTask = nullptr;
-        }
-        if (frame->disposeOp == 2) {  // 保存上一帧到缓冲区
-            previousBuffer = curBitmapBuffer;
-        }
-        HandleFrameBlendOp(frame, index);
-        HandlePostFrameDisposeOp(frame);
-        didHandled = true;
+        hasFirstFullFrame = true;
+    }
+    if (streaming) {  // 仅记录帧，保留压缩数据，播放时再合成
+        std::unique_lock<std::mutex> lock(drawableMutex);
+        playableFrameIndexes.push_back(index);
+        return true;
     }
-    return didHandled;
+    // 帧区域越界或解码失败时画布未被修改，也不能执行 dispose
+    std::shared_ptr<APNGDrawable> drawable;
+    if (ComposeFrame(*codec, *compositor, *frame)) {
+        drawable = codec->MakeDrawable(width, height, compositor->Canvas());
+        compositor->DisposeFrame(frame->Region());
+    }
+    std::vector<uint8_t>().swap(frame->data);  // 已解码，释放压缩数据
+    if (!drawable) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    playableFrameIndexes.push_back(index);
+    FillFrameTimingLocked(*drawable, playableFrameIndexes.size() - 1);
+    animateDrawables.push_back(drawable);
+    return true;
 }
 
-void APNG::HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index) {
-    // 合成// 根据 blendOp 合成帧
-    auto &drawingBuffer = this->curBitmapBuffer;
-    auto framePixelmap = CreatePixelMap(frame);
-    auto frameBuffer = std::vector<uint8_t>();
-    int frameBufferSize = frame->width * frame->height * 4;
-    bool frameDecodeSuccess = PixelmapToBitmapBuffer(framePixelmap, frameBufferSize, frameBuffer);
-    if (!frameDecodeSuccess) {
-        return;
+void APNG::FillFrameTiming(APNGDrawable &drawable, int index) {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    FillFrameTimingLocked(drawable, index);
+}
+
+void APNG::FillFrameTimingLocked(APNGDrawable &drawable, int index) {
+    int curFrameIndex = playableFrameIndexes[index];
+    if (curFrameIndex + 1 < this->frames.size()) {
+        drawable.isLast = false;
+        drawable.nextFrameDelay = this->frames[curFrameIndex + 1]->delay;
+    } else {
+        drawable.nextFrameDelay = this->frames[this->frames.size() - 1]->delay;
+        drawable.isLast = true;
     }
-    for (int y = 0; y < frame->height; ++y) {
-        for (int x = 0; x < frame->width; ++x) {
-            int srcIdx = (y * frame->width + x) * 4;
-            int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
+}
 
-            if (frame->blendOp == 0) {  // 覆盖操作
-                drawingBuffer[dstIdx + 0] = frameBuffer[srcIdx + 0];
-                drawingBuffer[dstIdx + 1] = frameBuffer[srcIdx + 1];
-                drawingBuffer[dstIdx + 2] = frameBuffer[srcIdx + 2];
-                drawingBuffer[dstIdx + 3] = frameBuffer[srcIdx + 3];
-            } else if (frame->blendOp == 1) {
-                // 在这里执行混合操作，例如使用 alpha 通道作为权重计算新的颜色值
-                uint8_t srcR = frameBuffer[srcIdx + 0];
-                uint8_t srcG = frameBuffer[srcIdx + 1];
-                uint8_t srcB = frameBuffer[srcIdx + 2];
-                uint8_t srcA = frameBuffer[srcIdx + 3];
+int APNG::DrawableCount() {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    return streaming ? playableFrameIndexes.size() : animateDrawables.size();
+}
 
-                uint8_t dstR = drawingBuffer[dstIdx + 0];
-                uint8_t dstG = drawingBuffer[dstIdx + 1];
-                uint8_t dstB = drawingBuffer[dstIdx + 2];
-                uint8_t dstA = drawingBuffer[dstIdx + 3];
+std::shared_ptr<APNGDrawable> APNG::GetDrawable(int index) {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    if (index >= 0 && index < animateDrawables.size()) {
+        return animateDrawables[index];
+    }
+    return nullptr;
+}
 
-                float srcAlpha = srcA / 255.0f;
-                float dstAlpha = dstA / 255.0f;
-                float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+std::shared_ptr<Frame> APNG::GetPlayableFrame(int index) {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    if (index >= 0 && index < playableFrameIndexes.size()) {
+        return frames[playableFrameIndexes[index]];
+    }
+    return nullptr;
+}
 
-                if (outAlpha == 0) {
-                    drawingBuffer[dstIdx + 0] = 0;
-                    drawingBuffer[dstIdx + 1] = 0;
-                    drawingBuffer[dstIdx + 2] = 0;
-                    drawingBuffer[dstIdx + 3] = 0;
-                } else {
-                    drawingBuffer[dstIdx + 0] =
-                        static_cast<uint8_t>((srcR * srcAlpha + dstR * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 1] =
-                        static_cast<uint8_t>((srcG * srcAlpha + dstG * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 2] =
-                        static_cast<uint8_t>((srcB * srcAlpha + dstB * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 3] = static_cast<uint8_t>(outAlpha * 255);
-                }
-            }
+APNGFrameStream::APNGFrameStream(std::shared_ptr<APNG> apng, size_t ring_size)
+    : apng_(std::move(apng)), ring_size_(std::max<size_t>(ring_size, 1)) {}
+
+std::shared_ptr<APNGDrawable> APNGFrameStream::GetDrawable(int index) {
+    std::shared_ptr<APNGDrawable> result;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = std::find_if(ring_.begin(), ring_.end(), [index](const auto &item) { return item.first == index; });
+        if (it != ring_.end()) {
+            result = it->second;
+            ring_.erase(ring_.begin(), it + 1);  // 丢弃已播放及跳过的帧
+        } else if (next_decode_index_ != index) {
+            // 跳帧或重新播放：清空缓冲，从 index 开始重新解码
+            ring_.clear();
+            next_decode_index_ = index;
         }
     }
+    ScheduleDecodeIfNeed();
+    return result;
+}
 
-    auto pixelmap = BitmapBufferToPixelmap(width * height * 4, width, height, this->curBitmapBuffer);
-    if (pixelmap) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = pixelmap;
-        drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-        AddDrawable(drawable, index);
+void APNGFrameStream::Cancel() {
+    std::deque<std::pair<int, std::shared_ptr<APNGDrawable>>> ring;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cancel_token_.Cancel();
+        ring.swap(ring_);
     }
 }
 
-void APNG::HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame) {
-    if (frame->disposeOp == 1) {  // 清理当前区域
-        auto &drawingBuffer = this->curBitmapBuffer;
-        // 清除当前帧区域
-        for (int y = 0; y < frame->height; ++y) {
-            for (int x = 0; x < frame->width; ++x) {
-                int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
-                drawingBuffer[dstIdx + 0] = 0;
-                drawingBuffer[dstIdx + 1] = 0;
-                drawingBuffer[dstIdx + 2] = 0;
-                drawingBuffer[dstIdx + 3] = 0;
-            }
+void APNGFrameStream::ScheduleDecodeIfNeed() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (decoding_ || cancel_token_.IsCancelled() || ring_.size() >= ring_size_) {
+            return;
         }
-    } else if (frame->disposeOp == 2) {
-        previousBuffer = this->curBitmapBuffer;
+        decoding_ = true;
     }
+    std::weak_ptr<APNGFrameStream> weak_self = shared_from_this();
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [weak_self] {
+            if (auto self = weak_self.lock()) {
+                self->DecodeAhead();
+            }
+        },
+        KRQoS::kUserInitiated, cancel_token_);
 }
 
-void APNG::AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex) {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    if (curFrameIndex + 1 < this->frames.size()) {
-        drawable->isLast = false;
-        drawable->nextFrameDelay = this->frames[curFrameIndex + 1]->delay;
-    } else {
-        drawable->nextFrameDelay = this->frames[this->frames.size() - 1]->delay;
-        drawable->isLast = true;
+void APNGFrameStream::DecodeAhead() {
+    while (true) {
+        int index = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            int count = apng_->DrawableCount();
+            if (next_decode_index_ >= count && !apng_->IsParsing() && count > 0) {
+                next_decode_index_ = 0;  // 循环播放，继续解码下一轮的首帧
+            }
+            if (cancel_token_.IsCancelled() || ring_.size() >= ring_size_ || next_decode_index_ >= count) {
+                decoding_ = false;
+                return;
+            }
+            index = next_decode_index_;
+        }
+        auto drawable = DecodeFrame(index);
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (next_decode_index_ != index) {
+            continue;  // 解码期间发生了跳帧，结果作废
+        }
+        ring_.emplace_back(index, drawable);
+        next_decode_index_ = index + 1;
     }
-    animateDrawables.push_back(drawable);
 }
 
-std::shared_ptr<APNGDrawable> APNG::GetDrawable(int index) {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    if (index < animateDrawables.size()) {
-        return animateDrawables[index];
+std::shared_ptr<APNGDrawable> APNGFrameStream::DecodeFrame(int index) {
+    if (!compositor_) {
+        compositor_ = std::make_unique<APNGCompositor>(apng_->width, apng_->height);
     }
-    return nullptr;
+    if (index < composed_count_) {  // 合成只能顺序进行，回退时从首帧重新开始
+        compositor_->Reset();
+        composed_count_ = 0;
+    }
+    auto drawable = std::make_shared<APNGDrawable>();
+    while (composed_count_ <= index) {
+        auto frame = apng_->GetPlayableFrame(composed_count_);
+        if (!frame) {
+            break;
+        }
+        if (ComposeFrame(*apng_->Codec(), *compositor_, *frame)) {
+            if (composed_count_ == index) {
+                auto composed = apng_->Codec()->MakeDrawable(apng_->width, apng_->height, compositor_->Canvas());
+                if (composed) {
+                    drawable = composed;
+                }
+            }
+            compositor_->DisposeFrame(frame->Region());
+        }
+        composed_count_++;
+    }
+    // 解码失败的帧保留时长信息，保证播放节奏不中断
+    apng_->FillFrameTiming(*drawable, index);
+    return drawable;
 }
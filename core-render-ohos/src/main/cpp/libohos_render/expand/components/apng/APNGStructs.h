@@ -16,26 +16,20 @@
 #ifndef CORE_RENDER_OHOS_APNGSTRUCTS_H
 #define CORE_RENDER_OHOS_APNGSTRUCTS_H
 
-#include <arkui/drawable_descriptor.h>
-#include <hilog/log.h>
-#include <linux/kd.h>
-#include <multimedia/image_framework/image/image_common.h>
-#include <multimedia/image_framework/image/image_packer_native.h>
-#include <multimedia/image_framework/image/image_receiver_native.h>
-#include <multimedia/image_framework/image/image_source_native.h>
-#include <multimedia/image_framework/image/pixelmap_native.h>
-#include <multimedia/image_framework/image_pixel_map_mdk.h>
-#include <native_drawing/drawing_canvas.h>
-#include <array>
+#include <atomic>
 #include <cstdint>
-#include <cstring>
-#include <execution>  // For std::execution::par
-#include <iostream>
-#include <stdexcept>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
+#include "libohos_render/expand/components/apng/APNGCompositor.h"
 #include "libohos_render/expand/components/apng/APNGUtil.h"
-#include "libohos_render/utils/KRRenderLoger.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+struct OH_PixelmapNative;
+struct ArkUI_DrawableDescriptor;
 
 class Frame {
  public:
@@ -51,18 +45,50 @@ class Frame {
     std::string base64Image;
 
     void SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer);
+
+    APNGFrameRegion Region() const {
+        return APNGFrameRegion{left, top, width, height, disposeOp, blendOp};
+    }
 };
 
+/**
+ * 可播放的一帧，pixelmap / drawable 由创建它的 APNGFrameCodec 负责释放
+ */
 class APNGDrawable {
  public:
+    virtual ~APNGDrawable() = default;
+
     int nextFrameDelay = 0;  // 如果为-1, 则没有下一个drawable
     bool isLast = false;
     OH_PixelmapNative *pixelmap = nullptr;
     ArkUI_DrawableDescriptor *drawable = nullptr;
 };
 
+/**
+ * 帧数据解码与可播放帧创建，设备上为 APNGPixelmapCodec；帧的拆分、合成与 dispose 不依赖平台
+ */
+class APNGFrameCodec {
+ public:
+    virtual ~APNGFrameCodec() = default;
+
+    /**
+     * 将帧的 PNG 数据解码为 frame.width * frame.height 个 RGBA 像素
+     */
+    virtual bool Decode(const Frame &frame, std::vector<uint8_t> &pixels) = 0;
+
+    /**
+     * 以画布的 RGBA 数据创建可播放帧，失败返回 nullptr
+     */
+    virtual std::shared_ptr<APNGDrawable> MakeDrawable(int width, int height, const std::vector<uint8_t> &canvas) = 0;
+};
+
 class APNG {
  public:
+    /**
+     * @param codec 帧编解码器，需在 APNG 的生命周期内有效
+     */
+    explicit APNG(APNGFrameCodec *codec);
+
     bool isAPNG = true;
     int width = 0;
     int height = 0;
@@ -72,35 +98,105 @@ class APNG {
     std::vector<std::shared_ptr<APNGDrawable>> animateDrawables;  // 播放帧
     ~APNG();
 
-    void WillParseFrame() {
-        isParsing.store(true);
+    APNGFrameCodec *Codec() const {
+        return codec;
     }
+
+    /**
+     * 单个动画全部帧解码后的内存预算（字节），超出时该动画改为流式解码
+     */
+    static void SetMemoryBudget(size_t bytes);
+    static size_t GetMemoryBudget();
+
+    void WillParseFrame();
     bool DidAddFrame(std::shared_ptr<Frame> frame, int index);
     void DidEndParserFrame() {
         isParsing.store(false);
-        lazyBeforeNextFrameTask = nullptr;
     }
 
     bool IsParsing() {
         return isParsing.load();
     }
 
+    /**
+     * 是否为流式解码模式，流式模式下不保存解码后的帧，由 APNGFrameStream 按需合成
+     */
+    bool IsStreaming() const {
+        return streaming;
+    }
+
+    /**
+     * 常驻内存估算（字节）：非流式为全部解码帧，流式为帧压缩数据，用于缓存容量统计
+     */
+    size_t MemoryCost() const {
+        return memoryCost;
+    }
+
+    /**
+     * 可播放的帧数
+     */
+    int DrawableCount();
+
     std::shared_ptr<APNGDrawable> GetDrawable(int index);
 
+    /**
+     * 第 index 个可播放帧（流式模式使用）
+     */
+    std::shared_ptr<Frame> GetPlayableFrame(int index);
+
+    /**
+     * 设置第 index 个可播放帧的播放时长信息
+     */
+    void FillFrameTiming(APNGDrawable &drawable, int index);
+
  private:
+    APNGFrameCodec *codec;
     std::atomic_bool isParsing = true;
-    std::function<void()> lazyBeforeNextFrameTask = nullptr;
-    std::vector<uint8_t> curBitmapBuffer;
-    std::vector<uint8_t> previousBuffer;
+    bool streaming = false;
+    size_t memoryCost = 0;
+    std::unique_ptr<APNGCompositor> compositor;
+    std::vector<int> playableFrameIndexes;  // 可播放帧在 frames 中的下标
     std::mutex drawableMutex;
 
     bool hasFirstFullFrame = false;
 
-    void HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index);
+    void FillFrameTimingLocked(APNGDrawable &drawable, int index);
+};
+
+/**
+ * 流式帧解码：在后台线程按播放顺序提前合成少量帧放入环形缓冲，内存占用与帧数无关
+ */
+class APNGFrameStream : public std::enable_shared_from_this<APNGFrameStream> {
+ public:
+    static constexpr size_t kDefaultRingSize = 3;
+
+    explicit APNGFrameStream(std::shared_ptr<APNG> apng, size_t ring_size = kDefaultRingSize);
+
+    /**
+     * 取出第 index 个可播放帧，尚未解码完成时返回 nullptr；同时触发后续帧的预解码
+     */
+    std::shared_ptr<APNGDrawable> GetDrawable(int index);
+
+    /**
+     * 停止预解码并释放缓冲的帧
+     */
+    void Cancel();
+
+ private:
+    void ScheduleDecodeIfNeed();
+    void DecodeAhead();
+    std::shared_ptr<APNGDrawable> DecodeFrame(int index);
+
+    std::shared_ptr<APNG> apng_;
+    size_t ring_size_;
+    std::unique_ptr<APNGCompositor> compositor_;  // 仅在解码任务中访问
+    int composed_count_ = 0;                      // compositor_ 已合成的帧数
 
-    void HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame);
-    //
-    void AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex);
+    std::mutex mutex_;
+    std::deque<std::pair<int, std::shared_ptr<APNGDrawable>>> ring_;
+    int next_decode_index_ = 0;
+    bool decoding_ = false;
+    KRCancellationToken cancel_token_ = KRCancellationToken::Create();  // 取消后已排队的解码任务直接丢弃
 };
 
 enum APNGEvent { LOAD_FAILURE, ANIMATION_START, ANIMATION_END };
@@ -16,10 +16,13 @@
 #ifndef CORE_RENDER_OHOS_APNGPARSER_H
 #define CORE_RENDER_OHOS_APNGPARSER_H
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -163,13 +166,17 @@ static void eachChunk(std::vector<uint8_t> &bytes,
     } while (res != false && type != "IEND" && off < bytes.size());
 }
 
-static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shared_ptr<APNG>)> completion) {
+/**
+ * 拆分 APNG 的帧并依次交给 APNG 合成，codec 负责单帧 PNG 数据的解码
+ */
+static void parseAPNG(std::vector<uint8_t> &buffer, APNGFrameCodec *codec,
+                      std::function<void(std::shared_ptr<APNG>)> completion) {
     if (!completion) {
         return;
     }
     static std::array<uint8_t, 8> PNGSignature = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
     std::vector<uint8_t> &bytes = buffer;
-    std::shared_ptr<APNG> apng = std::make_shared<APNG>();
+    std::shared_ptr<APNG> apng = std::make_shared<APNG>(codec);
 
     if (bytes.size() < 8 || !std::equal(bytes.begin(), bytes.begin() + 8, PNGSignature.begin())) {
         apng->isAPNG = false;
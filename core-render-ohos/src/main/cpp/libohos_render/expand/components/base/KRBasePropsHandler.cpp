@@ -18,27 +18,14 @@
 #include <multimedia/image_framework/image/image_common.h>
 #include <cfloat>
 #include "libohos_render/foundation/KRConfig.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRViewUtil.h"
 
 const char *kBackgroundColor = "backgroundColor";
-const char *kFrame = "frame";
-const char *kBorderRadius = "borderRadius";
-const char *kBorder = "border";
 const char *kBackgroundImage = "backgroundImage";
-const char *kTransform = "transform";
-const char *kOpacity = "opacity";
-const char *kVisibility = "visibility";
-const char *kOverflow = "overflow";
-const char *kZIndex = "zIndex";
-const char *kTouchEnable = "touchEnable";
-const char *kAccessibility = "accessibility";
-const char *kBoxShadow = "boxShadow";
-const char *KAnimation = "animation";
-const char *kAnimationCompletion = "animationCompletion";
-const char *kClipPath = "clipPath";
 
 // 动画完成回调事件参数
 constexpr char kParamKeyFinish[] = "finish";
@@ -53,24 +40,25 @@ void KRBasePropsHandler::OnDestroy() {
 }
 
 bool KRBasePropsHandler::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                                 const KRRenderCallback event_call_back) {
+                                 const KRRenderCallback event_call_back, KRPropKey prop_id) {
     if (tryAddCurrentAnimationOperation(prop_key, prop_value)) {
         return true;
     }
 
-    return SetPropWithoutAnimation(prop_key, prop_value, event_call_back);
+    return SetPropWithoutAnimation(prop_key, prop_value, event_call_back, prop_id);
 }
 
 bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
-                                                 const KRRenderCallback event_call_back) {
+                                                 const KRRenderCallback event_call_back, KRPropKey prop_id) {
     if (node_ == nullptr) {
         return false;
     }
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {  // 背景色
+    switch (KRResolvePropKey(prop_id, prop_key)) {
+    case KRPropKey::kBackgroundColor: {  // 背景色
         kuikly::util::UpdateNodeBackgroundColor(node_, kuikly::util::ConvertToHexColor(prop_value->toString()));
         return true;
     }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
+    case KRPropKey::kBorderRadius: {  // 圆角
         auto borderRadiuses = kuikly::util::ConverToBorderRadiuses(prop_value->toString());
         kuikly::util::UpdateNodeBorderRadius(node_, borderRadiuses);
         force_overflow_ = !borderRadiuses.isAllZero(); // 圆角不为0，需要强制clip 子孩子，避免超出自身边界
@@ -79,11 +67,11 @@ bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, co
         }
         return true;
     }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {  // 边框样式
+    case KRPropKey::kBorder: {  // 边框样式
         kuikly::util::UpdateNodeBorder(node_, prop_value->toString());
         return true;
     }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
+    case KRPropKey::kFrame: {
         if (prop_value->isString()) {
             KRRect frame;
             const std::string &s = prop_value->toString();
@@ -96,67 +84,59 @@ bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, co
             }
             return true;
         }
+        return false;
     }
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {  // 背景渐变
+    case KRPropKey::kBackgroundImage: {  // 背景渐变
         kuikly::util::UpdateNodeBackgroundImage(node_, prop_value->toString());
         return true;
     }
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {  // transform(旋转，位移，缩放，倾斜) （+anchor）
+    case KRPropKey::kTransform: {  // transform(旋转，位移，缩放，倾斜) （+anchor）
         css_transform_ = prop_value->toString();
         UpdateTransform(css_transform_);
         return true;
     }
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {  // 透明度
+    case KRPropKey::kOpacity: {  // 透明度
         kuikly::util::UpdateNodeOpacity(node_, prop_value->toDouble());
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // Visibility
+    case KRPropKey::kVisibility: {  // Visibility
         kuikly::util::UpdateNodeVisibility(node_, prop_value->toInt());
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪
+    case KRPropKey::kOverflow: {  // 裁剪
         css_overflow_ = prop_value->toInt();
         if (!has_clip_path_) {
             kuikly::util::UpdateNodeOverflow(node_, css_overflow_ || force_overflow_);
         }
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
+    case KRPropKey::kZIndex: {  // z-index
         z_index_ = prop_value->toInt();
         kuikly::util::UpdateNodeZIndex(node_, z_index_);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
+    case KRPropKey::kTouchEnable: {  // 禁用手势
         kuikly::util::UpdateNodeHitTest(node_, prop_value->toBool());
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
+    case KRPropKey::kAccessibility: {  // 无障碍化
         kuikly::util::UpdateNodeAccessibility(node_, prop_value->toString());
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
+    case KRPropKey::kBoxShadow: {  // 阴影
         kuikly::util::UpdateNodeBoxShadow(node_, prop_value->toString());
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
+    case KRPropKey::kAnimation: {
         auto animationStr = prop_value->toString();
         kuikly::util::SetNodeAnimation(weakView_, &animationStr);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kAnimationCompletion) == 0) {
+    case KRPropKey::kAnimationCompletion: {
         animation_completion_callback_ = event_call_back;
         return true;
     }
-    
-    if (strcmp(prop_key.c_str(), kClipPath) == 0) {
+    case KRPropKey::kClipPath: {
         auto pathCommand = kuikly::util::ConvertToPathCommand(prop_value->toString());
         has_clip_path_ = !pathCommand.empty();
         kuikly::util::UpdateNodeClipPath(node_, frame_.width, frame_.height, pathCommand);
@@ -165,48 +145,48 @@ bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, co
         }
         return true;
     }
-
-    return false;
+    default:
+        return false;
+    }
 }
 
-bool KRBasePropsHandler::ResetProp(const std::string &prop_key) {
+bool KRBasePropsHandler::ResetProp(const std::string &prop_key, KRPropKey prop_id) {
     if (node_ == nullptr) {
         return false;
     }
     force_overflow_ = false;
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {
+    switch (KRResolvePropKey(prop_id, prop_key)) {
+    case KRPropKey::kBackgroundColor: {
         kuikly::util::UpdateNodeBackgroundColor(node_, 0x00000000);  // 透明
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BACKGROUND_COLOR);
         return true;
     }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
+    case KRPropKey::kBorderRadius: {  // 圆角
         kuikly::util::UpdateNodeBorderRadius(node_, KRBorderRadiuses());
         kuikly::util::UpdateNodeOverflow(node_, 0);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_RADIUS);
         return true;
     }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {
+    case KRPropKey::kBorder: {
         kuikly::util::UpdateNodeBorder(node_, "0 solid 0");
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_WIDTH);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_COLOR);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_STYLE);
         return true;
     }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
+    case KRPropKey::kFrame: {
         KRRect frame;
         kuikly::util::UpdateNodeFrame(node_, frame);
         frame_ = frame;
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {
+    case KRPropKey::kBackgroundImage: {
         kuikly::util::UpdateNodeBackgroundImage(node_, "8,0 0,0 1");  // 重置为不渐变，且透明
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_LINEAR_GRADIENT);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {
+    case KRPropKey::kTransform: {
         ResetTransformIfNeed();
         css_transform_ = "";
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM_CENTER);
@@ -214,61 +194,55 @@ bool KRBasePropsHandler::ResetProp(const std::string &prop_key) {
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ROTATE);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {
+    case KRPropKey::kOpacity: {
         kuikly::util::UpdateNodeOpacity(node_, 1);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_OPACITY);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // 透明度
+    case KRPropKey::kVisibility: {  // 透明度
         kuikly::util::UpdateNodeVisibility(node_, 1);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_VISIBILITY);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪子孩子
+    case KRPropKey::kOverflow: {  // 裁剪子孩子
         kuikly::util::UpdateNodeOverflow(node_, 0);
         css_overflow_ = 0;
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
+    case KRPropKey::kZIndex: {  // z-index
         z_index_ = 0;
         kuikly::util::UpdateNodeZIndex(node_, 0);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_Z_INDEX);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
+    case KRPropKey::kTouchEnable: {  // 禁用手势
         kuikly::util::UpdateNodeHitTest(node_, true);
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ENABLED);
         return true;
     }
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
+    case KRPropKey::kAccessibility: {  // 无障碍化
         kuikly::util::UpdateNodeAccessibility(node_, "");
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ACCESSIBILITY_TEXT);
         return true;
     }
-
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
+    case KRPropKey::kBoxShadow: {  // 阴影
         kuikly::util::UpdateNodeBoxShadow(node_, "0 0 0 0");
         kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CUSTOM_SHADOW);
+        return false;
     }
-
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
+    case KRPropKey::kAnimation: {
         kuikly::util::SetNodeAnimation(weakView_, nullptr);
         return true;
     }
-    
-    if (strcmp(prop_key.c_str(), kClipPath) == 0) {
+    case KRPropKey::kClipPath: {
         has_clip_path_ = false;
         kuikly::util::UpdateNodeClipPath(node_, 0, 0, "");
         return true;
     }
-
-    return false;
+    default:
+        return false;
+    }
 }
 
 void KRBasePropsHandler::ResetTransformIfNeed() {
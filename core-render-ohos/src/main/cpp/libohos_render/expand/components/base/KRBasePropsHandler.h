@@ -21,6 +21,7 @@
 #include <string>
 #include "libohos_render/expand/components/base/animation/IKRNodeAnimation.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -35,11 +36,15 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
     }
     virtual ~KRBasePropsHandler() = default;
 
-    virtual bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back);
+    /**
+     * @param prop_id 已解析的属性ID，kUnresolved时按prop_key解析
+     */
+    virtual bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back,
+                         KRPropKey prop_id = KRPropKey::kUnresolved);
     virtual bool SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
-                                 const KRRenderCallback event_call_back);
+                                 const KRRenderCallback event_call_back, KRPropKey prop_id = KRPropKey::kUnresolved);
 
-    virtual bool ResetProp(const std::string &prop_key);
+    virtual bool ResetProp(const std::string &prop_key, KRPropKey prop_id = KRPropKey::kUnresolved);
 
     virtual void OnDestroy();
 
@@ -109,15 +114,17 @@ class KRArkTSViewBasePropsHandler : public KRBasePropsHandler{
     }
     virtual ~KRArkTSViewBasePropsHandler() = default;
 
-    bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back) override {
+    bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back,
+                 KRPropKey prop_id = KRPropKey::kUnresolved) override {
         return false;
     }
     bool SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
-                                 const KRRenderCallback event_call_back) override {
+                                 const KRRenderCallback event_call_back,
+                                 KRPropKey prop_id = KRPropKey::kUnresolved) override {
         return false;
     }
 
-    bool ResetProp(const std::string &prop_key) override {
+    bool ResetProp(const std::string &prop_key, KRPropKey prop_id = KRPropKey::kUnresolved) override {
         return false;
     }
 
@@ -0,0 +1,81 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+
+#include <deviceinfo.h>
+
+constexpr int SHADER_EFFECT_DESTROY_API_LEVEL = 19;
+static void KRSafeCall_OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *shaderEffect) {
+    // OH_Drawing_ShaderEffectDestroy 在 api 19 以下存在绘制阶段崩溃问题，见 KRParagraph.cpp
+    if (OH_GetSdkApiVersion() >= SHADER_EFFECT_DESTROY_API_LEVEL) {
+        OH_Drawing_ShaderEffectDestroy(shaderEffect);
+    }
+}
+
+KRCanvasDisplayList::~KRCanvasDisplayList() {
+    Clear();
+}
+
+void KRCanvasDisplayList::Add(KRCanvasOpCode code, uint32_t ref, std::initializer_list<float> args) {
+    ops_.push_back(KRCanvasOp{code, ref, static_cast<uint32_t>(args_.size())});
+    args_.insert(args_.end(), args);
+}
+
+void KRCanvasDisplayList::Clear() {
+    ops_.clear();
+    args_.clear();
+    strings_.clear();
+    string_indexes_.clear();
+    for (auto shader_effect : shader_effects_) {
+        KRSafeCall_OH_Drawing_ShaderEffectDestroy(shader_effect);
+    }
+    shader_effects_.clear();
+    shader_effect_indexes_.clear();
+    for (auto path_effect : path_effects_) {
+        OH_Drawing_PathEffectDestroy(path_effect);
+    }
+    path_effects_.clear();
+}
+
+uint32_t KRCanvasDisplayList::InternString(std::string_view str) {
+    std::string key(str);
+    auto it = string_indexes_.find(key);
+    if (it != string_indexes_.end()) {
+        return it->second;
+    }
+    auto index = static_cast<uint32_t>(strings_.size());
+    strings_.push_back(key);
+    string_indexes_.emplace(std::move(key), index);
+    return index;
+}
+
+uint32_t KRCanvasDisplayList::FindShaderEffect(const std::string &key) const {
+    auto it = shader_effect_indexes_.find(key);
+    return it == shader_effect_indexes_.end() ? kNoRef : it->second;
+}
+
+uint32_t KRCanvasDisplayList::AddShaderEffect(const std::string &key, OH_Drawing_ShaderEffect *shader_effect) {
+    auto index = static_cast<uint32_t>(shader_effects_.size());
+    shader_effects_.push_back(shader_effect);
+    shader_effect_indexes_[key] = index;
+    return index;
+}
+
+uint32_t KRCanvasDisplayList::AddPathEffect(OH_Drawing_PathEffect *path_effect) {
+    auto index = static_cast<uint32_t>(path_effects_.size());
+    path_effects_.push_back(path_effect);
+    return index;
+}
@@ -0,0 +1,130 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+#define CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+
+#include <native_drawing/drawing_path_effect.h>
+#include <native_drawing/drawing_shader_effect.h>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 画布指令码，由 KRCanvasView::CallMethod 解码生成
+ */
+enum class KRCanvasOpCode : uint8_t {
+    kSetLineCap,         // ref: OH_Drawing_PenLineCapStyle
+    kSetLineWidth,       // args: width
+    kSetLineDash,        // ref: path effect 索引，kNoRef 表示取消虚线
+    kSetStrokeColor,     // ref: 颜色值
+    kSetStrokeShader,    // ref: shader effect 索引
+    kSetFillColor,       // ref: 颜色值
+    kSetFillShader,      // ref: shader effect 索引
+    kBeginPath,
+    kMoveTo,             // args: x, y
+    kLineTo,             // args: x, y
+    kArcTo,              // args: left, top, right, bottom, start_angle, sweep_angle
+    kClosePath,
+    kStroke,
+    kFill,
+    kQuadraticCurveTo,   // args: cpx, cpy, x, y
+    kBezierCurveTo,      // args: cp1x, cp1y, cp2x, cp2y, x, y
+    kSetTextAlign,       // ref: OH_Drawing_TextAlign
+    kSetFont,            // ref: family 字符串索引; args: size, font_style, font_weight
+    kFillText,           // ref: text 字符串索引; args: x, y
+    kStrokeText,         // ref: text 字符串索引; args: x, y
+    kSave,
+    kSaveLayer,          // args: x, y, width, height
+    kRestore,
+    kClip,               // ref: 1 为 intersect，0 为 difference
+    kTranslate,          // args: x, y
+    kScale,              // args: x, y
+    kRotate,             // args: degrees
+    kSkew,               // args: x, y
+    kTransform,          // args: 3x3 矩阵
+    kDrawImage,          // ref: cacheKey 字符串索引; args: sx, sy, sw, sh, dx, dy, dw, dh（sw/sh < 0、dw/dh 为 NaN 表示缺省）
+};
+
+/**
+ * 画布指令，参数以 float 形式紧凑存放在显示列表的参数池中
+ */
+struct KRCanvasOp {
+    KRCanvasOpCode code;
+    uint32_t ref;
+    uint32_t arg_offset;
+};
+
+/**
+ * 画布显示列表：指令在调用时解码一次，绘制时直接回放，不再解析参数；
+ * 字符串、渐变与虚线效果在列表内驻留复用，随列表清空统一释放
+ */
+class KRCanvasDisplayList {
+ public:
+    static constexpr uint32_t kNoRef = UINT32_MAX;
+
+    KRCanvasDisplayList() = default;
+    KRCanvasDisplayList(const KRCanvasDisplayList &) = delete;
+    KRCanvasDisplayList &operator=(const KRCanvasDisplayList &) = delete;
+    ~KRCanvasDisplayList();
+
+    void Add(KRCanvasOpCode code, uint32_t ref = 0, std::initializer_list<float> args = {});
+    void Clear();
+
+    size_t Size() const {
+        return ops_.size();
+    }
+
+    const std::vector<KRCanvasOp> &Ops() const {
+        return ops_;
+    }
+
+    const float *Args(const KRCanvasOp &op) const {
+        return args_.data() + op.arg_offset;
+    }
+
+    uint32_t InternString(std::string_view str);
+    const std::string &String(uint32_t index) const {
+        return strings_[index];
+    }
+
+    /**
+     * 查找以 key 驻留的渐变，未找到返回 kNoRef
+     */
+    uint32_t FindShaderEffect(const std::string &key) const;
+    uint32_t AddShaderEffect(const std::string &key, OH_Drawing_ShaderEffect *shader_effect);
+    OH_Drawing_ShaderEffect *ShaderEffect(uint32_t index) const {
+        return shader_effects_[index];
+    }
+
+    uint32_t AddPathEffect(OH_Drawing_PathEffect *path_effect);
+    OH_Drawing_PathEffect *PathEffect(uint32_t index) const {
+        return path_effects_[index];
+    }
+
+ private:
+    std::vector<KRCanvasOp> ops_;
+    std::vector<float> args_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> string_indexes_;
+    std::vector<OH_Drawing_ShaderEffect *> shader_effects_;
+    std::unordered_map<std::string, uint32_t> shader_effect_indexes_;
+    std::vector<OH_Drawing_PathEffect *> path_effects_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
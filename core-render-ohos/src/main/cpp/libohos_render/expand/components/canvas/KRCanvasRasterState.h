@@ -0,0 +1,73 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCANVASRASTERSTATE_H
+#define CORE_RENDER_OHOS_KRCANVASRASTERSTATE_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 保留图层的光栅化进度：记录已绘制到图层上的指令数。
+ * 图层尺寸、密度变化或被标记失效后，下一帧需重建图层并从第一条指令全量回放
+ */
+class KRCanvasRasterState {
+ public:
+    /**
+     * 开始一帧绘制
+     * @return 需要全量回放时返回 true，此时已光栅化的指令数归零
+     */
+    bool BeginFrame(uint32_t width, uint32_t height, float density) {
+        if (!invalid_ && width == width_ && height == height_ && density == density_) {
+            return false;
+        }
+        width_ = width;
+        height_ = height;
+        density_ = density;
+        invalid_ = false;
+        rasterized_count_ = 0;
+        return true;
+    }
+
+    /**
+     * 本帧开始前已在图层上的指令数，本帧从该下标开始执行
+     */
+    size_t RasterizedCount() const {
+        return rasterized_count_;
+    }
+
+    /**
+     * 本帧执行完毕，指令列表的前 count 条已在图层上
+     */
+    void EndFrame(size_t count) {
+        rasterized_count_ = count;
+    }
+
+    /**
+     * 指令列表被重置、图层被释放或某条指令未能完整绘制时调用，可在帧内调用
+     */
+    void Invalidate() {
+        invalid_ = true;
+    }
+
+ private:
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    float density_ = 0;
+    size_t rasterized_count_ = 0;
+    bool invalid_ = true;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCANVASRASTERSTATE_H
@@ -27,7 +27,10 @@
 #include <native_drawing/drawing_shader_effect.h>
 #include <native_drawing/drawing_types.h>
 #include <native_drawing/drawing_matrix.h>
+#include <cmath>
+#include <unordered_map>
 
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
 #include "libohos_render/utils/KRColor.h"
 #include "libohos_render/utils/KRJSONObject.h"
@@ -64,11 +67,55 @@ static constexpr std::string_view SKEW = "skew";
 static constexpr std::string_view TRANSFORM = "transform";
 static constexpr std::string_view DRAW_IMAGE = "drawImage";
 
-KRCanvasView::KRCanvasView()
-    : KRView(), cachable_methods_({LINE_CAP, LINE_WIDTH, LINE_DASH, STROKE_STYLE, FILL_STYLE, BEGIN_PATH, MOVE_TO,
-                                   LINE_TO, ARC, CLOSE_PATH, STROKE, FILL, CREATE_LINEAR_GRADIENT, QUADRATIC_CURVE_TO,
-                                   TEXT_ALIGN, FONT, FILL_TEXT, STROKE_TEXT, BEZIER_CURVE_TO, SAVE, SAVE_LAYER,
-                                   RESTORE, CLIP, TRANSLATE, SCALE, ROTATE, SKEW, TRANSFORM, DRAW_IMAGE}) {
+// 保留图层位图的内存上限，超过时不保留图层，每帧直接全量回放
+static constexpr size_t kMaxRetainedLayerBytes = 16 * 1024 * 1024;
+
+static const std::unordered_map<std::string_view, KRCanvasOpCode> &CanvasMethodOpCodes() {
+    static const std::unordered_map<std::string_view, KRCanvasOpCode> op_codes = {
+        {LINE_CAP, KRCanvasOpCode::kSetLineCap},
+        {LINE_WIDTH, KRCanvasOpCode::kSetLineWidth},
+        {LINE_DASH, KRCanvasOpCode::kSetLineDash},
+        {STROKE_STYLE, KRCanvasOpCode::kSetStrokeColor},
+        {FILL_STYLE, KRCanvasOpCode::kSetFillColor},
+        {BEGIN_PATH, KRCanvasOpCode::kBeginPath},
+        {MOVE_TO, KRCanvasOpCode::kMoveTo},
+        {LINE_TO, KRCanvasOpCode::kLineTo},
+        {ARC, KRCanvasOpCode::kArcTo},
+        {CLOSE_PATH, KRCanvasOpCode::kClosePath},
+        {STROKE, KRCanvasOpCode::kStroke},
+        {FILL, KRCanvasOpCode::kFill},
+        {QUADRATIC_CURVE_TO, KRCanvasOpCode::kQuadraticCurveTo},
+        {TEXT_ALIGN, KRCanvasOpCode::kSetTextAlign},
+        {FONT, KRCanvasOpCode::kSetFont},
+        {FILL_TEXT, KRCanvasOpCode::kFillText},
+        {STROKE_TEXT, KRCanvasOpCode::kStrokeText},
+        {BEZIER_CURVE_TO, KRCanvasOpCode::kBezierCurveTo},
+        {SAVE, KRCanvasOpCode::kSave},
+        {SAVE_LAYER, KRCanvasOpCode::kSaveLayer},
+        {RESTORE, KRCanvasOpCode::kRestore},
+        {CLIP, KRCanvasOpCode::kClip},
+        {TRANSLATE, KRCanvasOpCode::kTranslate},
+        {SCALE, KRCanvasOpCode::kScale},
+        {ROTATE, KRCanvasOpCode::kRotate},
+        {SKEW, KRCanvasOpCode::kSkew},
+        {TRANSFORM, KRCanvasOpCode::kTransform},
+        {DRAW_IMAGE, KRCanvasOpCode::kDrawImage},
+    };
+    return op_codes;
+}
+
+static const KRAnyValue &Param(const KRRenderValue::Map &params, const char *key) {
+    static const KRAnyValue kNullParam = std::make_shared<KRRenderValue>();
+    auto it = params.find(key);
+    return it != params.end() && it->second ? it->second : kNullParam;
+}
+
+static float NumberParam(const KRRenderValue::Map &params, const char *key, float default_value = 0) {
+    auto it = params.find(key);
+    return it != params.end() && it->second ? it->second->toFloat() : default_value;
+}
+
+KRCanvasView::KRCanvasView() : KRView() {
     // ctor body left blank
 }
 void KRCanvasView::DidMoveToParentView() {
@@ -80,28 +127,26 @@ void KRCanvasView::DidInit() {
     IKRRenderViewExport::DidInit();
 }
 
-bool KRCanvasView::ShouldCacheOp(const std::string &method) {
-    return cachable_methods_.find(method) != cachable_methods_.end();
-}
-
-bool KRCanvasView::MarkDirtyIfNeeded(const std::string &method) {
-    if (method == STROKE || method == FILL || method == RESET) {
-        kuikly::util::GetNodeApi()->markDirty(GetNode(), NODE_NEED_RENDER);
-        return true;
-    }
-    return false;
+void KRCanvasView::OnDestroy() {
+    KRView::OnDestroy();
+    Reset();
+    DestroyRetainedLayer();
 }
 
 void KRCanvasView::CallMethod(const std::string &method, const KRAnyValue &params, const KRRenderCallback &cb) {
-    if (ShouldCacheOp(method)) {
-        AddOp(method, params);
+    const auto &op_codes = CanvasMethodOpCodes();
+    auto it = op_codes.find(method);
+    if (it != op_codes.end()) {
+        AddOp(it->second, params);
+        if (it->second == KRCanvasOpCode::kStroke || it->second == KRCanvasOpCode::kFill) {
+            kuikly::util::GetNodeApi()->markDirty(GetNode(), NODE_NEED_RENDER);
+        }
     } else if (method == RESET) {
         Reset();
-    } else {
+        kuikly::util::GetNodeApi()->markDirty(GetNode(), NODE_NEED_RENDER);
+    } else if (method != CREATE_LINEAR_GRADIENT) {  // 渐变随 strokeStyle / fillStyle 下发，无需单独处理
         KRView::CallMethod(method, params, cb);
-        return;
     }
-    MarkDirtyIfNeeded(method);
 }
 
 void KRCanvasView::OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeCustomEventType &event_type) {
@@ -113,46 +158,38 @@ void KRCanvasView::OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeC
     }
 }
 
-void KRCanvasView::SetLineCap(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    std::string str = obj->GetString("style");
-    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
-    if (str == "round") {
-        style = LINE_ROUND_CAP;
-    } else if (str == "square") {
-        style = LINE_SQUARE_CAP;
-    }
+OH_Drawing_Pen *KRCanvasView::Pen() {
     if (pen_ == nullptr) {
         pen_ = OH_Drawing_PenCreate();
     }
-    OH_Drawing_PenSetCap(pen_, style);
+    return pen_;
 }
 
-void KRCanvasView::SetLineWidth(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float width = obj->GetNumber("width");
-
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
+OH_Drawing_Brush *KRCanvasView::Brush() {
+    if (brush_ == nullptr) {
+        brush_ = OH_Drawing_BrushCreate();
     }
-    OH_Drawing_PenSetWidth(pen_, width);
+    return brush_;
 }
 
-void KRCanvasView::SetLineDash(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    auto intervalsVector = obj->GetNumberArray("intervals");
-    int count = intervalsVector.size();
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
+void KRCanvasView::SetLineDash(const KRRenderValue::Map &params) {
+    const auto &intervals_value = Param(params, "intervals");
+    if (!intervals_value->isArray() && !intervals_value->isString()) {
+        display_list_.Add(KRCanvasOpCode::kSetLineDash, KRCanvasDisplayList::kNoRef);
+        return;
     }
-    if (count == 0) {
-        OH_Drawing_PenSetPathEffect(pen_, nullptr);
+    const auto &intervals_array = intervals_value->toArray();
+    if (intervals_array.empty()) {
+        display_list_.Add(KRCanvasOpCode::kSetLineDash, KRCanvasDisplayList::kNoRef);
         return;
     }
-    std::vector<float> intervals(intervalsVector.begin(), intervalsVector.end());
-    auto pathEffect = OH_Drawing_CreateDashPathEffect(intervals.data(), count, 0);
-    OH_Drawing_PenSetPathEffect(pen_, pathEffect);
-    OH_Drawing_PathEffectDestroy(pathEffect);
+    std::vector<float> intervals;
+    intervals.reserve(intervals_array.size());
+    for (const auto &interval : intervals_array) {
+        intervals.push_back(interval->toFloat());
+    }
+    auto pathEffect = OH_Drawing_CreateDashPathEffect(intervals.data(), intervals.size(), 0);
+    display_list_.Add(KRCanvasOpCode::kSetLineDash, display_list_.AddPathEffect(pathEffect));
 }
 
 void processColorStops(const std::string &colorStopsStr, std::vector<uint32_t> &colors, std::vector<float> &locations) {
@@ -198,189 +235,86 @@ OH_Drawing_ShaderEffect *parseGradientStyle(const std::string &style) {
     return colorShaderEffect;
 }
 
-void KRCanvasView::SetStrokeStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, colorShaderEffect);
-        } else {
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, nullptr);
-            OH_Drawing_PenSetColor(pen_, kuikly::util::ConvertToHexColor(style));
-        }
-    }
-}
-void KRCanvasView::SetFillStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
-            }
-            OH_Drawing_BrushSetShaderEffect(brush_, colorShaderEffect);
-        } else {
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
-            }
-            OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
-            kuikly::graphics::Color color = kuikly::graphics::Color::FromString(style);
-            OH_Drawing_BrushSetColor(brush_, color.value);
-        }
-    }
-}
-
-void KRCanvasView::BeginPath() {
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
-    }
-    drawingPath_ = OH_Drawing_PathCreate();
-}
-
-void KRCanvasView::MoveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-
-    OH_Drawing_PathMoveTo(drawingPath_, x, y);
-}
-
-void KRCanvasView::LineTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathLineTo(drawingPath_, x, y);
-}
-
-void KRCanvasView::Arc(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        float x = paramObj->GetNumber("x");
-        float y = paramObj->GetNumber("y");
-        float r = paramObj->GetNumber("r");
-        float startAngle = paramObj->GetNumber("sAngle") * 180 / M_PI;
-        float endAngle = paramObj->GetNumber("eAngle") * 180 / M_PI;
-        bool ccw = paramObj->GetNumber("counterclockwise");
-        float sweepAngle = endAngle - startAngle;
-        if (ccw) {
-            // Preprocessing for counter-clockwise drawing:
-            // 0. Angles in (-720, 0] require no processing
-            // 1. sweepAngle > 0, startAngle and endAngle represent absolute angles, convert to [-360, 0)
-            // 2. sweepAngle <= -720, drawing exceeds 2 turns, convert to (-720, -360]
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in (-720, 0]
-            if (sweepAngle > 0 || sweepAngle <= -720) {
-                sweepAngle = std::fmod(sweepAngle, 360) - 360;
-            }
-        } else {
-            // Preprocessing for clockwise drawing:
-            // 0. Angles in [0, 720) require no processing
-            // 1. sweepAngle < 0, startAngle and endAngle represent absolute angles, convert to (0, 360]
-            // 2. sweepAngle >= 720, drawing exceeds 2 turns, convert to [360, 720)
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in [0, 720)
-            if (sweepAngle < 0 || sweepAngle >= 720) {
-                sweepAngle = std::fmod(sweepAngle, 360) + 360;
-            }
-        }
-        if (std::fabs(sweepAngle) < 360) {
-            // Deal with arc less than 2π
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, sweepAngle);
-        } else {
-            // Deal with arc greater than or equal to 2π
-            float halfSweepAngle = sweepAngle * 0.5;
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, halfSweepAngle);
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle);
-        }
-    }
+static bool IsGradientStyle(const std::string &style) {
+    return style.compare(0, LINEAR_GRADIENT.size(), LINEAR_GRADIENT) == 0;
 }
 
-void KRCanvasView::ClosePath() {
-    if (drawingPath_) {
-        OH_Drawing_PathClose(drawingPath_);
+/**
+ * 同一渐变在显示列表内只创建一次 shader
+ */
+static uint32_t InternGradient(KRCanvasDisplayList &display_list, const std::string &style) {
+    auto index = display_list.FindShaderEffect(style);
+    if (index == KRCanvasDisplayList::kNoRef) {
+        index = display_list.AddShaderEffect(style, parseGradientStyle(style));
     }
+    return index;
 }
 
-void KRCanvasView::Stroke() {
-    if (canvas_ && drawingPath_) {
-        if (pen_) {
-            OH_Drawing_CanvasAttachPen(canvas_, pen_);
-        }
-        OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
-        if (pen_) {
-            OH_Drawing_CanvasDetachPen(canvas_);
-        }
+void KRCanvasView::SetStrokeStyle(const std::string &style) {
+    if (IsGradientStyle(style)) {
+        display_list_.Add(KRCanvasOpCode::kSetStrokeShader, InternGradient(display_list_, style));
+    } else {
+        display_list_.Add(KRCanvasOpCode::kSetStrokeColor, kuikly::util::ConvertToHexColor(style));
     }
 }
 
-void KRCanvasView::Fill() {
-    if (canvas_ && drawingPath_) {
-        if (brush_) {
-            OH_Drawing_CanvasAttachBrush(canvas_, brush_);
+void KRCanvasView::SetFillStyle(const std::string &style) {
+    if (IsGradientStyle(style)) {
+        display_list_.Add(KRCanvasOpCode::kSetFillShader, InternGradient(display_list_, style));
+    } else {
+        display_list_.Add(KRCanvasOpCode::kSetFillColor, kuikly::graphics::Color::FromString(style).value);
+    }
+}
+
+void KRCanvasView::Arc(const KRRenderValue::Map &params) {
+    float x = NumberParam(params, "x");
+    float y = NumberParam(params, "y");
+    float r = NumberParam(params, "r");
+    float startAngle = NumberParam(params, "sAngle") * 180 / M_PI;
+    float endAngle = NumberParam(params, "eAngle") * 180 / M_PI;
+    bool ccw = NumberParam(params, "counterclockwise");
+    float sweepAngle = endAngle - startAngle;
+    if (ccw) {
+        // Preprocessing for counter-clockwise drawing:
+        // 0. Angles in (-720, 0] require no processing
+        // 1. sweepAngle > 0, startAngle and endAngle represent absolute angles, convert to [-360, 0)
+        // 2. sweepAngle <= -720, drawing exceeds 2 turns, convert to (-720, -360]
+        // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in (-720, 0]
+        if (sweepAngle > 0 || sweepAngle <= -720) {
+            sweepAngle = std::fmod(sweepAngle, 360) - 360;
         }
-        OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
-        if (brush_) {
-            OH_Drawing_CanvasDetachBrush(canvas_);
+    } else {
+        // Preprocessing for clockwise drawing:
+        // 0. Angles in [0, 720) require no processing
+        // 1. sweepAngle < 0, startAngle and endAngle represent absolute angles, convert to (0, 360]
+        // 2. sweepAngle >= 720, drawing exceeds 2 turns, convert to [360, 720)
+        // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in [0, 720)
+        if (sweepAngle < 0 || sweepAngle >= 720) {
+            sweepAngle = std::fmod(sweepAngle, 360) + 360;
         }
     }
-}
-
-void KRCanvasView::SetTextAlign(const std::string &params) {
-    if (params == "left") {
-        text_feature_.textAlign = TEXT_ALIGN_LEFT;
-    } else if (params == "center") {
-        text_feature_.textAlign = TEXT_ALIGN_CENTER;
-    } else if (params == "right") {
-        text_feature_.textAlign = TEXT_ALIGN_RIGHT;
-    }
-}
-
-void KRCanvasView::SetFont(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto size = paramObj->GetNumber("size");
-    auto style = paramObj->GetString("style");
-    auto weight = std::stoi(paramObj->GetString("weight"));
-    auto family = paramObj->GetString("family");
-
-    text_feature_.fontSize = size;
-    text_feature_.fontStyle = kuikly::util::ConvertToFontStyle(style);
-    text_feature_.fontWeight = kuikly::util::ConvertFontWeight(weight);
-    text_feature_.fontFamily = family;
-}
-
-void KRCanvasView::FillText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, FILL_TEXT);
+    if (std::fabs(sweepAngle) < 360) {
+        // Deal with arc less than 2π
+        display_list_.Add(KRCanvasOpCode::kArcTo, 0, {x - r, y - r, x + r, y + r, startAngle, sweepAngle});
+    } else {
+        // Deal with arc greater than or equal to 2π
+        float halfSweepAngle = sweepAngle * 0.5;
+        display_list_.Add(KRCanvasOpCode::kArcTo, 0, {x - r, y - r, x + r, y + r, startAngle, halfSweepAngle});
+        display_list_.Add(KRCanvasOpCode::kArcTo, 0,
+                          {x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle});
     }
 }
 
-void KRCanvasView::StrokeText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, STROKE_TEXT);
-    }
+void KRCanvasView::SetFont(const KRRenderValue::Map &params) {
+    auto size = NumberParam(params, "size");
+    auto style = kuikly::util::ConvertToFontStyle(Param(params, "style")->toString());
+    auto weight = kuikly::util::ConvertFontWeight(Param(params, "weight")->toInt());
+    auto family = display_list_.InternString(Param(params, "family")->toString());
+    display_list_.Add(KRCanvasOpCode::kSetFont, family,
+                      {size, static_cast<float>(style), static_cast<float>(weight)});
 }
 
-void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                            std::string_view type) {
+void KRCanvasView::DrawText(const KRCanvasOp &op) {
     OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
     // 设置文字大小、字重等属性
     float fontSizeScale = 1;
@@ -401,13 +335,13 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     OH_Drawing_SetTextStyleLocale(txtStyle, "en");
 
     // 自定义字体
-    auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
+    auto fontCollectionManager = KRFontCollectionManager::GetInstance();
     if (!text_feature_.fontFamily.empty()) {
         const char *fontFamilyPtr = text_feature_.fontFamily.c_str();
         const char *fontFamilies[] = {fontFamilyPtr};
         OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
         auto nativeResMgr = rootView->GetNativeResourceManager();
-        SetCustomFontIfApplicable(nativeResMgr, wrapper, text_feature_.fontFamily, fontAdapters);
+        fontCollectionManager->LoadCustomFont(text_feature_.fontFamily, nativeResMgr);
     }
 
     OH_Drawing_TypographyStyle *typoStyle = OH_Drawing_CreateTypographyStyle();
@@ -415,24 +349,19 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     // 使用左对齐
     OH_Drawing_SetTypographyTextAlign(typoStyle, TEXT_ALIGN_LEFT);
 
-    if (type == FILL_TEXT) {
-        if (brush_ == nullptr) {
-            brush_ = OH_Drawing_BrushCreate();
-        }
-        OH_Drawing_SetTextStyleForegroundBrush(txtStyle, brush_);
-    } else if (type == STROKE_TEXT) {
-        if (pen_ == nullptr) {
-            pen_ = OH_Drawing_PenCreate();
-        }
-        OH_Drawing_SetTextStyleForegroundPen(txtStyle, pen_);
+    if (op.code == KRCanvasOpCode::kFillText) {
+        OH_Drawing_SetTextStyleForegroundBrush(txtStyle, Brush());
+    } else {
+        OH_Drawing_SetTextStyleForegroundPen(txtStyle, Pen());
     }
 
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto text = paramObj->GetString("text");
-    auto x = paramObj->GetNumber("x");
-    auto y = paramObj->GetNumber("y");
+    const std::string &text = display_list_.String(op.ref);
+    const float *args = display_list_.Args(op);
+    double x = args[0];
+    double y = args[1];
 
-    OH_Drawing_TypographyCreate *handler = OH_Drawing_CreateTypographyHandler(typoStyle, wrapper->fontCollection);
+    OH_Drawing_TypographyCreate *handler =
+        OH_Drawing_CreateTypographyHandler(typoStyle, fontCollectionManager->SharedFontCollection());
     OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
     // 设置文字内容
     OH_Drawing_TypographyHandlerAddText(handler, text.c_str());
@@ -468,181 +397,385 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     OH_Drawing_DestroyTextStyle(txtStyle);
 }
 
-void KRCanvasView::QuadraticCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cpx = obj->GetNumber("cpx");
-    float cpy = obj->GetNumber("cpy");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathQuadTo(drawingPath_, cpx, cpy, x, y);
-}
-
-void KRCanvasView::BezierCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
+void KRCanvasView::DrawImage(const KRCanvasOp &op) {
+    auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
+    auto pixelmap = module->GetImage(display_list_.String(op.ref));
+    if (!pixelmap) {
+        raster_state_.Invalidate();  // 图片尚未就绪，下一帧需全量回放
         return;
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cp1x = obj->GetNumber("cp1x");
-    float cp1y = obj->GetNumber("cp1y");
-    float cp2x = obj->GetNumber("cp2x");
-    float cp2y = obj->GetNumber("cp2y");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathCubicTo(drawingPath_, cp1x, cp1y, cp2x, cp2y, x, y);
+    const float *args = display_list_.Args(op);
+    float sx = args[0];
+    float sy = args[1];
+    float sWidth = args[2];
+    float sHeight = args[3];
+    if (sWidth < 0 || sHeight < 0) {
+        OH_Pixelmap_ImageInfo *info;
+        OH_PixelmapImageInfo_Create(&info);
+        OH_PixelmapNative_GetImageInfo(pixelmap, info);
+        uint32_t width = 0;
+        OH_PixelmapImageInfo_GetWidth(info, &width);
+        uint32_t height = 0;
+        OH_PixelmapImageInfo_GetHeight(info, &height);
+        OH_PixelmapImageInfo_Release(info);
+        sWidth = width;
+        sHeight = height;
+    }
+    float dx = args[4];
+    float dy = args[5];
+    float dWidth = std::isnan(args[6]) ? sWidth : args[6];
+    float dHeight = std::isnan(args[7]) ? sHeight : args[7];
+
+    OH_Drawing_PixelMap *drawingPixelMap = OH_Drawing_PixelMapGetFromOhPixelMapNative(pixelmap);
+    OH_Drawing_Rect *srcRect = OH_Drawing_RectCreate(sx, sy, sx + sWidth, sy + sHeight);
+    OH_Drawing_Rect *dstRect = OH_Drawing_RectCreate(dx, dy, dx + dWidth, dy + dHeight);
+    OH_Drawing_CanvasDrawPixelMapRect(canvas_, drawingPixelMap, srcRect, dstRect, nullptr);
+    OH_Drawing_RectDestroy(srcRect);
+    OH_Drawing_RectDestroy(dstRect);
 }
 
-void KRCanvasView::Save() {
-    if (canvas_) {
-        OH_Drawing_CanvasSave(canvas_);
-    }
+void KRCanvasView::Reset() {
+    ResetDrawState();
+    // 画笔释放后再释放其引用的 shader / path effect
+    display_list_.Clear();
+    raster_state_.Invalidate();
 }
 
-void KRCanvasView::SaveLayer(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        float width = obj->GetNumber("width");
-        float height = obj->GetNumber("height");
-        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(x, y, x + width, y + height);
-        OH_Drawing_CanvasSaveLayer(canvas_, rect, brush_);
-        OH_Drawing_RectDestroy(rect);
+void KRCanvasView::ResetDrawState() {
+    if (drawingPath_) {
+        OH_Drawing_PathDestroy(drawingPath_);
+        drawingPath_ = nullptr;
     }
-}
-
-void KRCanvasView::Restore() {
-    if (canvas_) {
-        OH_Drawing_CanvasRestore(canvas_);
+    if (pen_) {
+        OH_Drawing_PenDestroy(pen_);
+        pen_ = nullptr;
     }
-}
-
-void KRCanvasView::clip(const std::string &params) {
-    if (canvas_ && drawingPath_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto op = obj->GetNumber("intersect") ? OH_Drawing_CanvasClipOp::INTERSECT
-                                              : OH_Drawing_CanvasClipOp::DIFFERENCE;
-        OH_Drawing_CanvasClipPath(canvas_, drawingPath_, op, true);
+    if (brush_) {
+        OH_Drawing_BrushDestroy(brush_);
+        brush_ = nullptr;
     }
+    text_feature_ = TextFeature();
 }
 
-void KRCanvasView::Translate(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasTranslate(canvas_, x, y);
+void KRCanvasView::AddOp(KRCanvasOpCode code, const KRAnyValue &params) {
+    switch (code) {
+        case KRCanvasOpCode::kBeginPath:
+        case KRCanvasOpCode::kClosePath:
+        case KRCanvasOpCode::kStroke:
+        case KRCanvasOpCode::kFill:
+        case KRCanvasOpCode::kSave:
+        case KRCanvasOpCode::kRestore:
+            display_list_.Add(code);
+            return;
+        case KRCanvasOpCode::kSetTextAlign: {  // 参数为对齐方式字符串
+            const auto &align = params->toString();
+            if (align == "left") {
+                display_list_.Add(code, TEXT_ALIGN_LEFT);
+            } else if (align == "center") {
+                display_list_.Add(code, TEXT_ALIGN_CENTER);
+            } else if (align == "right") {
+                display_list_.Add(code, TEXT_ALIGN_RIGHT);
+            }
+            return;
+        }
+        default:
+            break;
+    }
+
+    const auto &map = params->toMap();
+    switch (code) {
+        case KRCanvasOpCode::kSetLineCap: {
+            const auto &style = Param(map, "style")->toString();
+            OH_Drawing_PenLineCapStyle cap = LINE_FLAT_CAP;
+            if (style == "round") {
+                cap = LINE_ROUND_CAP;
+            } else if (style == "square") {
+                cap = LINE_SQUARE_CAP;
+            }
+            display_list_.Add(code, cap);
+            break;
+        }
+        case KRCanvasOpCode::kSetLineWidth:
+            display_list_.Add(code, 0, {NumberParam(map, "width")});
+            break;
+        case KRCanvasOpCode::kSetLineDash:
+            SetLineDash(map);
+            break;
+        case KRCanvasOpCode::kSetStrokeColor:
+            SetStrokeStyle(Param(map, "style")->toString());
+            break;
+        case KRCanvasOpCode::kSetFillColor:
+            SetFillStyle(Param(map, "style")->toString());
+            break;
+        case KRCanvasOpCode::kMoveTo:
+        case KRCanvasOpCode::kLineTo:
+        case KRCanvasOpCode::kTranslate:
+        case KRCanvasOpCode::kScale:
+        case KRCanvasOpCode::kSkew:
+            display_list_.Add(code, 0, {NumberParam(map, "x"), NumberParam(map, "y")});
+            break;
+        case KRCanvasOpCode::kArcTo:
+            Arc(map);
+            break;
+        case KRCanvasOpCode::kQuadraticCurveTo:
+            display_list_.Add(code, 0,
+                              {NumberParam(map, "cpx"), NumberParam(map, "cpy"), NumberParam(map, "x"),
+                               NumberParam(map, "y")});
+            break;
+        case KRCanvasOpCode::kBezierCurveTo:
+            display_list_.Add(code, 0,
+                              {NumberParam(map, "cp1x"), NumberParam(map, "cp1y"), NumberParam(map, "cp2x"),
+                               NumberParam(map, "cp2y"), NumberParam(map, "x"), NumberParam(map, "y")});
+            break;
+        case KRCanvasOpCode::kSetFont:
+            SetFont(map);
+            break;
+        case KRCanvasOpCode::kFillText:
+        case KRCanvasOpCode::kStrokeText:
+            display_list_.Add(code, display_list_.InternString(Param(map, "text")->toString()),
+                              {NumberParam(map, "x"), NumberParam(map, "y")});
+            break;
+        case KRCanvasOpCode::kSaveLayer:
+            display_list_.Add(code, 0,
+                              {NumberParam(map, "x"), NumberParam(map, "y"), NumberParam(map, "width"),
+                               NumberParam(map, "height")});
+            break;
+        case KRCanvasOpCode::kClip:
+            display_list_.Add(code, NumberParam(map, "intersect") ? 1 : 0);
+            break;
+        case KRCanvasOpCode::kRotate:
+            display_list_.Add(code, 0, {static_cast<float>(NumberParam(map, "angle") * 180 / M_PI)});
+            break;
+        case KRCanvasOpCode::kTransform: {
+            const auto &values = Param(map, "values")->toArray();
+            if (values.size() < 9) {
+                break;
+            }
+            display_list_.Add(code, 0,
+                              {values[0]->toFloat(), values[1]->toFloat(), values[2]->toFloat(),
+                               values[3]->toFloat(), values[4]->toFloat(), values[5]->toFloat(),
+                               values[6]->toFloat(), values[7]->toFloat(), values[8]->toFloat()});
+            break;
+        }
+        case KRCanvasOpCode::kDrawImage:
+            display_list_.Add(code, display_list_.InternString(Param(map, "cacheKey")->toString()),
+                              {NumberParam(map, "sx"), NumberParam(map, "sy"), NumberParam(map, "sWidth", -1),
+                               NumberParam(map, "sHeight", -1), NumberParam(map, "dx"), NumberParam(map, "dy"),
+                               NumberParam(map, "dWidth", NAN), NumberParam(map, "dHeight", NAN)});
+            break;
+        default:
+            break;
+    }
+}
+
+void KRCanvasView::DrawOp(const KRCanvasOp &op) {
+    const float *args = display_list_.Args(op);
+    switch (op.code) {
+        case KRCanvasOpCode::kSetLineCap:
+            OH_Drawing_PenSetCap(Pen(), static_cast<OH_Drawing_PenLineCapStyle>(op.ref));
+            break;
+        case KRCanvasOpCode::kSetLineWidth:
+            OH_Drawing_PenSetWidth(Pen(), args[0]);
+            break;
+        case KRCanvasOpCode::kSetLineDash:
+            OH_Drawing_PenSetPathEffect(
+                Pen(), op.ref == KRCanvasDisplayList::kNoRef ? nullptr : display_list_.PathEffect(op.ref));
+            break;
+        case KRCanvasOpCode::kSetStrokeColor:
+            OH_Drawing_PenSetShaderEffect(Pen(), nullptr);
+            OH_Drawing_PenSetColor(Pen(), op.ref);
+            break;
+        case KRCanvasOpCode::kSetStrokeShader:
+            OH_Drawing_PenSetShaderEffect(Pen(), display_list_.ShaderEffect(op.ref));
+            break;
+        case KRCanvasOpCode::kSetFillColor:
+            OH_Drawing_BrushSetShaderEffect(Brush(), nullptr);
+            OH_Drawing_BrushSetColor(Brush(), op.ref);
+            break;
+        case KRCanvasOpCode::kSetFillShader:
+            OH_Drawing_BrushSetShaderEffect(Brush(), display_list_.ShaderEffect(op.ref));
+            break;
+        case KRCanvasOpCode::kBeginPath:
+            // 复用同一个 path 对象，避免每帧重复创建
+            if (drawingPath_) {
+                OH_Drawing_PathReset(drawingPath_);
+            } else {
+                drawingPath_ = OH_Drawing_PathCreate();
+            }
+            break;
+        case KRCanvasOpCode::kMoveTo:
+            if (drawingPath_) {
+                OH_Drawing_PathMoveTo(drawingPath_, args[0], args[1]);
+            }
+            break;
+        case KRCanvasOpCode::kLineTo:
+            if (drawingPath_) {
+                OH_Drawing_PathLineTo(drawingPath_, args[0], args[1]);
+            }
+            break;
+        case KRCanvasOpCode::kArcTo:
+            if (drawingPath_) {
+                OH_Drawing_PathArcTo(drawingPath_, args[0], args[1], args[2], args[3], args[4], args[5]);
+            }
+            break;
+        case KRCanvasOpCode::kClosePath:
+            if (drawingPath_) {
+                OH_Drawing_PathClose(drawingPath_);
+            }
+            break;
+        case KRCanvasOpCode::kStroke:
+            if (drawingPath_) {
+                if (pen_) {
+                    OH_Drawing_CanvasAttachPen(canvas_, pen_);
+                }
+                OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
+                if (pen_) {
+                    OH_Drawing_CanvasDetachPen(canvas_);
+                }
+            }
+            break;
+        case KRCanvasOpCode::kFill:
+            if (drawingPath_) {
+                if (brush_) {
+                    OH_Drawing_CanvasAttachBrush(canvas_, brush_);
+                }
+                OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
+                if (brush_) {
+                    OH_Drawing_CanvasDetachBrush(canvas_);
+                }
+            }
+            break;
+        case KRCanvasOpCode::kQuadraticCurveTo:
+            if (drawingPath_) {
+                OH_Drawing_PathQuadTo(drawingPath_, args[0], args[1], args[2], args[3]);
+            }
+            break;
+        case KRCanvasOpCode::kBezierCurveTo:
+            if (drawingPath_) {
+                OH_Drawing_PathCubicTo(drawingPath_, args[0], args[1], args[2], args[3], args[4], args[5]);
+            }
+            break;
+        case KRCanvasOpCode::kSetTextAlign:
+            text_feature_.textAlign = static_cast<OH_Drawing_TextAlign>(op.ref);
+            break;
+        case KRCanvasOpCode::kSetFont:
+            text_feature_.fontSize = args[0];
+            text_feature_.fontStyle = static_cast<OH_Drawing_FontStyle>(args[1]);
+            text_feature_.fontWeight = static_cast<OH_Drawing_FontWeight>(args[2]);
+            text_feature_.fontFamily = display_list_.String(op.ref);
+            break;
+        case KRCanvasOpCode::kFillText:
+        case KRCanvasOpCode::kStrokeText:
+            DrawText(op);
+            break;
+        case KRCanvasOpCode::kSave:
+            OH_Drawing_CanvasSave(canvas_);
+            break;
+        case KRCanvasOpCode::kSaveLayer: {
+            OH_Drawing_Rect *rect = OH_Drawing_RectCreate(args[0], args[1], args[0] + args[2], args[1] + args[3]);
+            OH_Drawing_CanvasSaveLayer(canvas_, rect, brush_);
+            OH_Drawing_RectDestroy(rect);
+            break;
+        }
+        case KRCanvasOpCode::kRestore:
+            OH_Drawing_CanvasRestore(canvas_);
+            break;
+        case KRCanvasOpCode::kClip:
+            if (drawingPath_) {
+                auto clip_op = op.ref ? OH_Drawing_CanvasClipOp::INTERSECT : OH_Drawing_CanvasClipOp::DIFFERENCE;
+                OH_Drawing_CanvasClipPath(canvas_, drawingPath_, clip_op, true);
+            }
+            break;
+        case KRCanvasOpCode::kTranslate:
+            OH_Drawing_CanvasTranslate(canvas_, args[0], args[1]);
+            break;
+        case KRCanvasOpCode::kScale:
+            OH_Drawing_CanvasScale(canvas_, args[0], args[1]);
+            break;
+        case KRCanvasOpCode::kRotate:
+            OH_Drawing_CanvasRotate(canvas_, args[0], 0, 0);
+            break;
+        case KRCanvasOpCode::kSkew:
+            OH_Drawing_CanvasSkew(canvas_, args[0], args[1]);
+            break;
+        case KRCanvasOpCode::kTransform: {
+            auto matrix = OH_Drawing_MatrixCreate();
+            OH_Drawing_MatrixSetMatrix(matrix,
+                                       args[0], args[1], args[2],
+                                       args[3], args[4], args[5],
+                                       args[6], args[7], args[8]);
+            OH_Drawing_CanvasConcatMatrix(canvas_, matrix);
+            OH_Drawing_MatrixDestroy(matrix);
+            break;
+        }
+        case KRCanvasOpCode::kDrawImage:
+            DrawImage(op);
+            break;
     }
 }
 
-void KRCanvasView::Scale(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasScale(canvas_, x, y);
+void KRCanvasView::DrawOps(size_t begin) {
+    const auto &ops = display_list_.Ops();
+    for (size_t i = begin; i < ops.size(); ++i) {
+        DrawOp(ops[i]);
     }
 }
 
-void KRCanvasView::Rotate(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float degrees = obj->GetNumber("angle") * 180 / M_PI;
-        OH_Drawing_CanvasRotate(canvas_, degrees, 0, 0);
+bool KRCanvasView::PrepareRetainedLayer(const KRRect &frame, float density) {
+    auto width = static_cast<uint32_t>(std::ceil(frame.width * density));
+    auto height = static_cast<uint32_t>(std::ceil(frame.height * density));
+    if (width == 0 || height == 0 || static_cast<size_t>(width) * height * 4 > kMaxRetainedLayerBytes) {
+        DestroyRetainedLayer();
+        return false;
     }
-}
-
-void KRCanvasView::Skew(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasSkew(canvas_, x, y);
+    if (layer_bitmap_ == nullptr || width != layer_width_ || height != layer_height_) {
+        DestroyRetainedLayer();
+        layer_bitmap_ = OH_Drawing_BitmapCreate();
+        OH_Drawing_BitmapFormat format = {COLOR_FORMAT_RGBA_8888, ALPHA_FORMAT_PREMUL};
+        OH_Drawing_BitmapBuild(layer_bitmap_, width, height, &format);
+        layer_width_ = width;
+        layer_height_ = height;
     }
-}
-
-void KRCanvasView::Transform(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto values = obj->GetNumberArray("values");
-        if (values.size() < 9) {
-            return;
-        }
-        auto matrix = OH_Drawing_MatrixCreate();
-        OH_Drawing_MatrixSetMatrix(matrix,
-                                   values[0], values[1], values[2],
-                                   values[3], values[4], values[5],
-                                   values[6], values[7], values[8]);
-        OH_Drawing_CanvasConcatMatrix(canvas_, matrix);
-        OH_Drawing_MatrixDestroy(matrix);
+    if (layer_canvas_ == nullptr) {
+        raster_state_.Invalidate();
     }
-}
-
-void KRCanvasView::DrawImage(const std::string &params) {
-    if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        std::string cacheKey = obj->GetString("cacheKey");
-        auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
-        auto pixelmap = module->GetImage(cacheKey);
-        if (!pixelmap) {
-            return;
-        }
-        float sx = obj->GetNumber("sx");
-        float sy = obj->GetNumber("sy");
-        float sWidth = obj->GetNumber("sWidth", -1);
-        float sHeight = obj->GetNumber("sHeight", -1);
-        if (sWidth < 0 || sHeight < 0) {
-            OH_Pixelmap_ImageInfo *info;
-            OH_PixelmapImageInfo_Create(&info);
-            OH_PixelmapNative_GetImageInfo(pixelmap, info);
-            uint32_t width = 0;
-            OH_PixelmapImageInfo_GetWidth(info, &width);
-            uint32_t height = 0;
-            OH_PixelmapImageInfo_GetHeight(info, &height);
-            OH_PixelmapImageInfo_Release(info);
-            sWidth = width;
-            sHeight = height;
+    if (raster_state_.BeginFrame(width, height, density)) {
+        // 全量回放：重建画布以清空变换与裁剪，并重置画笔、画刷、路径与字体，从第一条指令重新光栅化
+        if (layer_canvas_) {
+            OH_Drawing_CanvasDestroy(layer_canvas_);
         }
-        float dx = obj->GetNumber("dx");
-        float dy = obj->GetNumber("dy");
-        float dWidth = obj->GetNumber("dWidth", sWidth);
-        float dHeight = obj->GetNumber("dHeight", sHeight);
-
-        OH_Drawing_PixelMap *drawingPixelMap = OH_Drawing_PixelMapGetFromOhPixelMapNative(pixelmap);
-        OH_Drawing_Rect *srcRect = OH_Drawing_RectCreate(sx, sy, sx + sWidth, sy + sHeight);
-        OH_Drawing_Rect *dstRect = OH_Drawing_RectCreate(dx, dy, dx + dWidth, dy + dHeight);
-        OH_Drawing_CanvasDrawPixelMapRect(canvas_, drawingPixelMap, srcRect, dstRect, nullptr);
-        OH_Drawing_RectDestroy(srcRect);
-        OH_Drawing_RectDestroy(dstRect);
+        layer_canvas_ = OH_Drawing_CanvasCreate();
+        OH_Drawing_CanvasBind(layer_canvas_, layer_bitmap_);
+        OH_Drawing_CanvasClear(layer_canvas_, 0x00000000);
+        OH_Drawing_CanvasScale(layer_canvas_, density, density);
+        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(0, 0, frame.width, frame.height);
+        OH_Drawing_CanvasClipRect(layer_canvas_, rect, OH_Drawing_CanvasClipOp::INTERSECT, false);
+        OH_Drawing_RectDestroy(rect);
+        ResetDrawState();
     }
+    return true;
 }
 
-void KRCanvasView::Reset() {
-    ops_.clear();
-
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
-        drawingPath_ = nullptr;
+void KRCanvasView::DestroyRetainedLayer() {
+    if (layer_canvas_) {
+        OH_Drawing_CanvasDestroy(layer_canvas_);
+        layer_canvas_ = nullptr;
     }
-    if (pen_) {
-        OH_Drawing_PenDestroy(pen_);
-        pen_ = nullptr;
+    if (layer_bitmap_) {
+        OH_Drawing_BitmapDestroy(layer_bitmap_);
+        layer_bitmap_ = nullptr;
     }
-    if (brush_) {
-        OH_Drawing_BrushDestroy(brush_);
-        brush_ = nullptr;
-    }
-}
-
-void KRCanvasView::AddOp(const std::string &method, const KRAnyValue &params) {
-    ops_.push_back(std::pair{method, params->toString()});
+    layer_width_ = 0;
+    layer_height_ = 0;
+    raster_state_.Invalidate();
 }
 
 void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
     auto drawContext = OH_ArkUI_NodeCustomEvent_GetDrawContextInDraw(event);
-    canvas_ = reinterpret_cast<OH_Drawing_Canvas *>(OH_ArkUI_DrawContext_GetCanvas(drawContext));
+    auto node_canvas = reinterpret_cast<OH_Drawing_Canvas *>(OH_ArkUI_DrawContext_GetCanvas(drawContext));
+    if (node_canvas == nullptr) {
+        return;
+    }
 
     float density = 1;
     if (auto root = GetRootView().lock()) {
@@ -651,76 +784,24 @@ void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
         }
     }
 
+    auto frame = GetFrame();
+    if (PrepareRetainedLayer(frame, density)) {
+        // 只执行上次光栅化之后追加的指令，已有内容直接贴图
+        canvas_ = layer_canvas_;
+        DrawOps(raster_state_.RasterizedCount());
+        raster_state_.EndFrame(display_list_.Size());
+        canvas_ = node_canvas;
+        OH_Drawing_CanvasDrawBitmap(canvas_, layer_bitmap_, 0, 0);
+        return;
+    }
+
+    canvas_ = node_canvas;
     OH_Drawing_CanvasScale(canvas_, density, density);
     // 设置可绘制区域为 Canvas 的整个布局区域
-    auto frame = GetFrame();
     OH_Drawing_Rect *rect = OH_Drawing_RectCreate(0, 0, frame.width, frame.height);
     OH_Drawing_CanvasClipRect(canvas_, rect, OH_Drawing_CanvasClipOp::INTERSECT, false);
     OH_Drawing_RectDestroy(rect);
-
-    std::for_each(ops_.begin(), ops_.end(), [this](auto item) {
-        const std::string &method = item.first;
-        const std::string &params = item.second;
-        if (method == LINE_CAP) {
-            SetLineCap(params);
-        } else if (method == LINE_WIDTH) {
-            SetLineWidth(params);
-        } else if (method == LINE_DASH) {
-            SetLineDash(params);
-        } else if (method == STROKE_STYLE) {
-            SetStrokeStyle(params);
-        } else if (method == FILL_STYLE) {
-            SetFillStyle(params);
-        } else if (method == BEGIN_PATH) {
-            BeginPath();
-        } else if (method == MOVE_TO) {
-            MoveTo(params);
-        } else if (method == LINE_TO) {
-            LineTo(params);
-        } else if (method == ARC) {
-            Arc(params);
-        } else if (method == CLOSE_PATH) {
-            ClosePath();
-        } else if (method == STROKE) {
-            Stroke();
-        } else if (method == FILL) {
-            Fill();
-        } else if (method == CREATE_LINEAR_GRADIENT) {
-            //
-        } else if (method == QUADRATIC_CURVE_TO) {
-            QuadraticCurveTo(params);
-        } else if (method == TEXT_ALIGN) {
-            SetTextAlign(params);
-        } else if (method == FONT) {
-            SetFont(params);
-        } else if (method == FILL_TEXT) {
-            FillText(params);
-        } else if (method == STROKE_TEXT) {
-            StrokeText(params);
-        } else if (method == BEZIER_CURVE_TO) {
-            BezierCurveTo(params);
-        } else if (method == RESET) {
-            Reset();
-        } else if (method == SAVE) {
-            Save();
-        } else if (method == SAVE_LAYER) {
-            SaveLayer(params);
-        } else if (method == RESTORE) {
-            Restore();
-        } else if (method == CLIP) {
-            clip(params);
-        } else if (method == TRANSLATE) {
-            Translate(params);
-        } else if (method == SCALE) {
-            Scale(params);
-        } else if (method == ROTATE) {
-            Rotate(params);
-        } else if (method == SKEW) {
-            Skew(params);
-        } else if (method == TRANSFORM) {
-            Transform(params);
-        } else if (method == DRAW_IMAGE) {
-            DrawImage(params);
-        }
-    });
+    // 每帧从第一条指令回放，不能沿用上一帧结束时的画笔、画刷与字体
+    ResetDrawState();
+    DrawOps(0);
 }
@@ -16,8 +16,8 @@
 #ifndef CORE_RENDER_OHOS_KRCANVASVIEW_H
 #define CORE_RENDER_OHOS_KRCANVASVIEW_H
 
-#include <unordered_set>
-
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+#include "libohos_render/expand/components/canvas/KRCanvasRasterState.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
@@ -46,52 +46,44 @@ class KRCanvasView : public KRView {
 
     void DidInit() override;
     void DidMoveToParentView() override;
+    void OnDestroy() override;
 
  private:
-    void SetLineCap(const std::string &params);
-    void SetLineWidth(const std::string &params);
-    void SetLineDash(const std::string &params);
-    void SetStrokeStyle(const std::string &params);
-    void SetFillStyle(const std::string &params);
-    void BeginPath();
-    void MoveTo(const std::string &params);
-    void LineTo(const std::string &params);
-    void Arc(const std::string &params);
-    void ClosePath();
-    void Stroke();
-    void Fill();
-    void FillText(const std::string &params);
-    void StrokeText(const std::string &params);
-    void SetTextAlign(const std::string &params);
-    void SetFont(const std::string &params);
-    void QuadraticCurveTo(const std::string &params);
-    void BezierCurveTo(const std::string &params);
-    void Save();
-    void SaveLayer(const std::string &params);
-    void Restore();
-    void clip(const std::string &params);
-    void Translate(const std::string &params);
-    void Scale(const std::string &params);
-    void Rotate(const std::string &params);
-    void Skew(const std::string &params);
-    void Transform(const std::string &params);
-    void DrawImage(const std::string &params);
+    void SetStrokeStyle(const std::string &style);
+    void SetFillStyle(const std::string &style);
+    void SetLineDash(const KRRenderValue::Map &params);
+    void Arc(const KRRenderValue::Map &params);
+    void SetFont(const KRRenderValue::Map &params);
+    void DrawImage(const KRCanvasOp &op);
     void Reset();
-    void DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper, std::string_view type);
+    void ResetDrawState();
+    void DrawText(const KRCanvasOp &op);
 
-    void AddOp(const std::string &method, const KRAnyValue &params);
+    void AddOp(KRCanvasOpCode code, const KRAnyValue &params);
+    void DrawOp(const KRCanvasOp &op);
     void OnDraw(ArkUI_NodeCustomEvent *event);
+    void DrawOps(size_t begin);
+    bool PrepareRetainedLayer(const KRRect &frame, float density);
+    void DestroyRetainedLayer();
 
-    bool ShouldCacheOp(const std::string &method);
-    bool MarkDirtyIfNeeded(const std::string &method);
+    OH_Drawing_Pen *Pen();
+    OH_Drawing_Brush *Brush();
 
  private:
     OH_Drawing_Canvas *canvas_ = nullptr;
     OH_Drawing_Path *drawingPath_ = nullptr;
     OH_Drawing_Brush *brush_ = nullptr;
     OH_Drawing_Pen *pen_ = nullptr;
-    std::vector<std::pair<std::string, std::string>> ops_;
-    std::unordered_set<std::string_view> cachable_methods_;
+    KRCanvasDisplayList display_list_;
+    /**
+     * 保留图层：已执行的指令光栅化在离屏位图上，后续帧只执行新追加的指令再整体贴图；
+     * 尺寸/密度变化、reset 或指令未能完整绘制（如图片尚未加载）时回退为全量回放
+     */
+    OH_Drawing_Bitmap *layer_bitmap_ = nullptr;
+    OH_Drawing_Canvas *layer_canvas_ = nullptr;
+    uint32_t layer_width_ = 0;
+    uint32_t layer_height_ = 0;
+    KRCanvasRasterState raster_state_;
     TextFeature text_feature_;
 };
 
@@ -38,7 +38,7 @@ class KRForwardArkTSView : public IKRRenderViewExport {
     void DidMoveToParentView() override;
 
     bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                       const KRRenderCallback event_call_back) override;
+                       const KRRenderCallback event_call_back, KRPropKey prop_id) override;
 
     bool ReuseEnable() override {
         return false;
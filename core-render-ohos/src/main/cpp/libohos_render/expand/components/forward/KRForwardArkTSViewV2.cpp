@@ -47,15 +47,15 @@ void KRForwardArkTSViewV2::DestroyNode(){
     node_ = nullptr;
 }
 void KRForwardArkTSViewV2::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                           const KRRenderCallback event_call_back){
+                           const KRRenderCallback event_call_back, KRPropKey prop_id){
     SetProp(prop_key, prop_value, event_call_back);
 }
 
 bool KRForwardArkTSViewV2::ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                                       const KRRenderCallback event_call_back) {
-    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back);
+                                       const KRRenderCallback event_call_back, KRPropKey prop_id) {
+    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back, prop_id);
     if (handled) {
-        if (prop_key == kBackgroundColor || prop_key == kBackgroundImage) {
+        if (prop_id == KRPropKey::kBackgroundColor || prop_id == KRPropKey::kBackgroundImage) {
             KRArkTSManager::GetInstance().CallArkTSMethod(this->GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
                                                           std::make_shared<KRRenderValue>(this->GetViewTag()),
                                                           std::make_shared<KRRenderValue>(prop_key), prop_value,
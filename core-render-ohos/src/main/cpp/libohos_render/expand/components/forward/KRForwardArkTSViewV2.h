@@ -31,7 +31,8 @@ class KRForwardArkTSViewV2 : public IKRRenderViewExport {
     void OnDestroy() override;
     void DestroyNode() override;
     void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                           const KRRenderCallback event_call_back = nullptr) override;
+                           const KRRenderCallback event_call_back = nullptr,
+                           KRPropKey prop_id = KRPropKey::kUnresolved) override;
     bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                  const KRRenderCallback event_call_back = nullptr) override;
     void FireViewEventFromArkTS(std::string eventKey, KRAnyValue data) override;
@@ -56,7 +57,7 @@ class KRForwardArkTSViewV2 : public IKRRenderViewExport {
     void DidMoveToParentView() override;
 
     bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                       const KRRenderCallback event_call_back) override;
+                       const KRRenderCallback event_call_back, KRPropKey prop_id) override;
 
     bool ReuseEnable() override {
         return false;
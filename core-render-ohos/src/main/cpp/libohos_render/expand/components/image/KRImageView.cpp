@@ -34,25 +34,14 @@ constexpr char kHttpsPrefix[] = "https:";
 constexpr char kFilePrefix[] = "file:";
 constexpr char kAssetsPrefix[] = "assets:";
 
-constexpr char kPropNameResize[] = "resize";
 constexpr char kResizeModeCover[] = "cover";
 constexpr char kResizeModeContain[] = "contain";
 constexpr char kResizeModeStretch[] = "stretch";
 
-constexpr char kPropNameDragEnable[] = "dragEnable";
 
-constexpr char kPropNameBlurRadius[] = "blurRadius";
-constexpr char kPropNameTintColor[] = "tintColor";
-constexpr char kPropNameCapInsets[] = "capInsets";
-constexpr char kPropNameDotNineImage[] = "dotNineImage";
-
-constexpr char kEventNameLoadSuccess[] = "loadSuccess";
-constexpr char kEventNameLoadResolution[] = "loadResolution";
-constexpr char kEventNameLoadFailure[] = "loadFailure";
 constexpr char kEventNameLoadErrorCode[] = "errorCode";
 constexpr char kParamKeyImageWidth[] = "imageWidth";
 constexpr char kParamKeyImageHeight[] = "imageHeight";
-constexpr char kPropNameMaskLinearGradient[] = "maskLinearGradient";
 
 bool isBase64(const std::string &src) {
     return src.find(kBase64Prefix) == 0;
@@ -98,74 +87,74 @@ void KRImageView::OnDestroy() {
 
 bool KRImageView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                           const KRRenderCallback event_call_back) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {
-        didHanded = SetImageSrc(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
-        didHanded = SetResizeMode(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameBlurRadius)) {
-        didHanded = SetBlurRadius(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTintColor)) {
-        didHanded = SetTintColor(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameCapInsets)) {
-        didHanded = SetCapInsets(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDotNineImage)) {
-        didHanded = SetDotNineImage(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameMaskLinearGradient)) {
-        didHanded = SetMaskLinearGradient(prop_value);        
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadSuccess)) {
-        didHanded = RegisterLoadSuccessCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadResolution)) {
-        didHanded = RegisterLoadResolutionCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadFailure)) {
-        didHanded = RegisterLoadFailureCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDragEnable)) {
-        didHanded = SetDragEnable(prop_value);
-    }
-    return didHanded;
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kSrc:
+        return SetImageSrc(prop_value);
+    case KRPropKey::kResize:
+        return SetResizeMode(prop_value);
+    case KRPropKey::kBlurRadius:
+        return SetBlurRadius(prop_value);
+    case KRPropKey::kTintColor:
+        return SetTintColor(prop_value);
+    case KRPropKey::kCapInsets:
+        return SetCapInsets(prop_value);
+    case KRPropKey::kDotNineImage:
+        return SetDotNineImage(prop_value);
+    case KRPropKey::kMaskLinearGradient:
+        return SetMaskLinearGradient(prop_value);
+    case KRPropKey::kLoadSuccess:
+        return RegisterLoadSuccessCallback(event_call_back);
+    case KRPropKey::kLoadResolution:
+        return RegisterLoadResolutionCallback(event_call_back);
+    case KRPropKey::kLoadFailure:
+        return RegisterLoadFailureCallback(event_call_back);
+    case KRPropKey::kDragEnable:
+        return SetDragEnable(prop_value);
+    default:
+        return false;
+    }
 }
 
 bool KRImageView::ResetProp(const std::string &prop_key) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kSrc:
         image_src_ = "";
         kuikly::util::ResetArkUIImageSrc(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
+        return true;
+    case KRPropKey::kResize:
         SetResizeMode(NewKRRenderValue(kResizeModeCover));
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameBlurRadius)) {
+        return true;
+    case KRPropKey::kBlurRadius:
         kuikly::util::ResetArkUIImageBlurRadius(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTintColor)) {
+        return true;
+    case KRPropKey::kTintColor:
         kuikly::util::ResetArkUIImageTintColor(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameCapInsets)) {
+        return true;
+    case KRPropKey::kCapInsets:
         kuikly::util::ResetArkUIImageCapInsets(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDotNineImage)) {
+        return true;
+    case KRPropKey::kDotNineImage:
         this->is_dot_nine_image_ = false;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameMaskLinearGradient)) {
+        return true;
+    case KRPropKey::kMaskLinearGradient:
         ResetMaskLinearGradientNode();
         kuikly::util::ResetArkUIImageBlendMode(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadSuccess)) {
-        didHanded = true;
+        return true;
+    case KRPropKey::kLoadSuccess:
         had_register_on_complete_event_ = false;
         load_success_callback_ = nullptr;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadResolution)) {
-        didHanded = true;
+        return true;
+    case KRPropKey::kLoadResolution:
         had_register_on_complete_event_ = false;
         load_resolution_callback_ = nullptr;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadFailure)) {
-        didHanded = true;
+        return true;
+    case KRPropKey::kLoadFailure:
         had_register_on_error_event_ = false;
         load_failure_callback_ = nullptr;
-    } else {
-        didHanded = IKRRenderViewExport::ResetProp(prop_key);
+        return true;
+    default:
+        return IKRRenderViewExport::ResetProp(prop_key);
     }
-    return didHanded;
 }
 
 void KRImageView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) {
@@ -15,9 +15,8 @@
 
 #include "libohos_render/expand/components/image/KRImageViewWrapper.h"
 
-constexpr char kPropNameResize[] = "resize";
-constexpr char kPropNameSrc[] = "src";
-constexpr char kPropNamePlaceHolder[] = "placeholder";
+static const std::string kPropNameResize = "resize";
+static const std::string kPropNameSrc = "src";
 
 void KRImageViewWrapper::DidInit() {
     place_holder_image_view_ = std::make_shared<KRImageView>();
@@ -56,12 +55,12 @@ void KRImageViewWrapper::OnDestroy() {
 
 bool KRImageViewWrapper::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                                  const KRRenderCallback event_call_back) {
-    auto didHanded = false;
-    didHanded = image_view_->SetProp(prop_key, prop_value, event_call_back);
-    if (std::strcmp(prop_key.c_str(), kPropNameResize) == 0) {
-        place_holder_image_view_->SetProp(prop_key, prop_value, event_call_back);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePlaceHolder) == 0) {
-        place_holder_image_view_->SetProp(kPropNameSrc, prop_value, event_call_back);
+    auto prop_id = PropIdOf(prop_key);
+    auto didHanded = image_view_->DispatchSetProp(prop_key, prop_value, event_call_back, prop_id);
+    if (prop_id == KRPropKey::kResize) {
+        place_holder_image_view_->DispatchSetProp(prop_key, prop_value, event_call_back, prop_id);
+    } else if (prop_id == KRPropKey::kPlaceholder) {
+        place_holder_image_view_->DispatchSetProp(kPropNameSrc, prop_value, event_call_back, KRPropKey::kSrc);
         didHanded = true;
     }
     return didHanded;
@@ -70,9 +69,10 @@ bool KRImageViewWrapper::SetProp(const std::string &prop_key, const KRAnyValue &
 bool KRImageViewWrapper::ResetProp(const std::string &prop_key) {
     IKRRenderViewExport::ResetProp(prop_key);
     auto didHanded = image_view_->ResetProp(prop_key);
-    if (std::strcmp(prop_key.c_str(), kPropNameResize) == 0) {
+    auto prop_id = PropIdOf(prop_key);
+    if (prop_id == KRPropKey::kResize) {
         place_holder_image_view_->ResetProp(kPropNameResize);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePlaceHolder) == 0) {
+    } else if (prop_id == KRPropKey::kPlaceholder) {
         place_holder_image_view_->ResetProp(kPropNameSrc);
         didHanded = true;
     }
@@ -17,32 +17,12 @@
 
 #include "libohos_render/manager/KRKeyboardManager.h"
 
-constexpr char *kText = "text";
-constexpr char *kPlaceholder = "placeholder";
-constexpr char *kPlaceholderColor = "placeholderColor";
-constexpr char *kFontSize = "fontSize";
-constexpr char *kFontWeight = "fontWeight";
-constexpr char *kColor = "color";
-constexpr char *kEditable = "editable";
-constexpr char *kTintColor = "tintColor";
-constexpr char *kTextAlign = "textAlign";
-constexpr char *kKeyboardType = "keyboardType";    // 键盘类型
-constexpr char *kReturnKeyType = "returnKeyType";  // return类型
-constexpr char *kMaxTextLength = "maxTextLength";  // 最大长度
-
 constexpr char kMethodFocus[] = "focus";
 constexpr char kMethodBlur[] = "blur";
 constexpr char kMethodSetText[] = "setText";
 constexpr char kMethodGetCursorIndex[] = "getCursorIndex";
 constexpr char kMethodSetCursorIndex[] = "setCursorIndex";
 
-constexpr char kEventTextDidChanged[] = "textDidChange";
-constexpr char kEventInputFocus[] = "inputFocus";
-constexpr char kEventInputBlur[] = "inputBlur";
-constexpr char kEventInputReturn[] = "inputReturn";
-constexpr char kEventTextLengthBeyondLimit[] = "textLengthBeyondLimit";
-constexpr char kEventKeyboardHeightChange[] = "keyboardHeightChange";  // 键盘高度变化
-
 ArkUI_NodeHandle KRTextFieldView::CreateNode() {
     return kuikly::util::GetNodeApi()->createNode(ARKUI_NODE_TEXT_INPUT);
 }
@@ -113,60 +93,61 @@ std::string KRTextFieldView::GetInputNodeContentText(){
 }
 bool KRTextFieldView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                               const KRRenderCallback event_call_back) {
-    if (kuikly::util::isEqual(prop_key, kText)) {  // 占位
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kText: {  // 占位
         SetContentText(prop_value->toString());
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kPlaceholder)) {  // 占位
+    case KRPropKey::kPlaceholder: {  // 占位
         UpdateInputNodePlaceholder(prop_value->toString());
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kPlaceholderColor)) {  // 占位颜色
+    case KRPropKey::kPlaceholderColor: {  // 占位颜色
         UpdateInputNodePlaceholderColor(prop_value->toString());
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kFontSize)) {  // 字体大小
+    case KRPropKey::kFontSize: {  // 字体大小
         font_size_ = prop_value->toFloat();
         SetFont(font_size_, font_weight_);
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kFontWeight)) {  // 字重
+    case KRPropKey::kFontWeight: {  // 字重
         font_weight_ = kuikly::util::ConvertArkUIFontWeight(prop_value->toInt());
         SetFont(font_size_, font_weight_);
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kColor)) {  // 字体颜色
+    case KRPropKey::kColor: {  // 字体颜色
         UpdateInputNodeColor(prop_value->toString());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kTintColor)) {  // 光标颜色
+    case KRPropKey::kTintColor: {  // 光标颜色
         UpdateInputNodeCaretrColor(prop_value->toString());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kTextAlign)) {  // 文本对齐
+    case KRPropKey::kTextAlign: {  // 文本对齐
         UpdateInputNodeTextAlign(prop_value->toString());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kEditable)) {  // 是否可以编辑输入
+    case KRPropKey::kEditable: {  // 是否可以编辑输入
         focusable_ = prop_value->toBool();
         UpdateInputNodeFocusable(prop_value->toInt());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kKeyboardType)) {  // 键盘输入类型
+    case KRPropKey::kKeyboardType: {  // 键盘输入类型
         UpdateInputNodeKeyboardType(prop_value->toString());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kReturnKeyType)) {  // 完成键类型
+    case KRPropKey::kReturnKeyType: {  // 完成键类型
         UpdateInputNodeEnterKeyType(prop_value->toString());
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kMaxTextLength)) {  // 输入长度限制
+    case KRPropKey::kMaxTextLength: {  // 输入长度限制
         max_length_ = prop_value->toInt();
         LimitInputContentTextInMaxLength();
         if (!text_length_beyond_limit_callback_) {
@@ -176,36 +157,36 @@ bool KRTextFieldView::SetProp(const std::string &prop_key, const KRAnyValue &pro
     }
 
     // 事件
-    if (kuikly::util::isEqual(prop_key, kEventTextDidChanged)) {  // 文本变化事件
+    case KRPropKey::kTextDidChange: {  // 文本变化事件
         text_did_change_callback_ = event_call_back;
         RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
         RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kEventInputFocus)) {  // 获焦事件
+    case KRPropKey::kInputFocus: {  // 获焦事件
         input_focus_callback_ = event_call_back;
         RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kEventInputBlur)) {  // 失焦事件
+    case KRPropKey::kInputBlur: {  // 失焦事件
         input_blur_callback_ = event_call_back;
         RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kEventInputReturn)) {  // 按下完成键回调事件
+    case KRPropKey::kInputReturn: {  // 按下完成键回调事件
         input_return_callback_ = event_call_back;
         RegisterEvent(GetOnSubmitEventType());
         return true;
     }
-    if (kuikly::util::isEqual(prop_key, kEventTextLengthBeyondLimit)) {  // 监听文字是否超过输入最大的限制事件
+    case KRPropKey::kTextLengthBeyondLimit: {  // 监听文字是否超过输入最大的限制事件
         text_length_beyond_limit_callback_ = event_call_back;
         UpdateInputNodeMaxLength(10000000);  // 不限制，通过LimitInputContentTextInMaxLength
         return true;
     }
 
-    if (kuikly::util::isEqual(prop_key, kEventKeyboardHeightChange)) {  // 监听文字是否超过输入最大的限制事件
+    case KRPropKey::kKeyboardHeightChange: {  // 监听文字是否超过输入最大的限制事件
         keyboard_height_changed_callback_ = event_call_back;
         auto key = NewKRRenderValue(GetViewTag())->toString();
         KRKeyboardManager::GetInstance().AddKeyboardTask(key, [event_call_back](float height, int duration_ms) {
@@ -216,6 +197,9 @@ bool KRTextFieldView::SetProp(const std::string &prop_key, const KRAnyValue &pro
         });
         return true;
     }
+    default:
+        break;
+    }
 
     return IKRRenderViewExport::SetProp(prop_key, prop_value, event_call_back);
 }
@@ -26,6 +26,10 @@ class KRFontAdapterManager final {
     void RegisterFontAdapter(KRFontAdapter adapter, const char *fontFamily);
 
     std::unordered_map<std::string, KRFontAdapter> AllAdapters();
+    KRFontAdapter GetAdapter(const std::string &fontFamily);
+    bool HasAdapter(const std::string &fontFamily) {
+        return GetAdapter(fontFamily) != nullptr;
+    }
 
  private:
     KRFontAdapterManager() = default;
@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
+
+#include <native_drawing/drawing_font_collection.h>
+#include <native_drawing/drawing_register_font.h>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/utils/KRJSONCodec.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Remove this declaration if compatable api is raised to 14 and above
+extern OH_Drawing_FontCollection *OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
+#ifdef __cplusplus
+};
+#endif
+
+constexpr char kRawFilePrefix[] = "rawfile:";
+
+KRFontCollectionManager *KRFontCollectionManager::GetInstance() {
+    static KRFontCollectionManager *instance = new KRFontCollectionManager();  // 进程级单例，不析构
+    return instance;
+}
+
+KRFontCollectionManager::KRFontCollectionManager() {
+    if (OH_Drawing_GetFontCollectionGlobalInstance) {
+        collection_ = OH_Drawing_GetFontCollectionGlobalInstance();
+    } else {
+        collection_ = OH_Drawing_CreateSharedFontCollection();
+    }
+}
+
+bool KRFontCollectionManager::LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr) {
+    return LoadCustomFont(fontFamily, resMgr, false);
+}
+
+bool KRFontCollectionManager::LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr,
+                                             bool preload) {
+    if (fontFamily.empty()) {
+        return false;
+    }
+    // 失败不记录，适配器后续可能返回可用字体
+    return fonts_.LoadOnce(
+        fontFamily, preload, [&fontFamily] { return KRFontAdapterManager::GetInstance()->HasAdapter(fontFamily); },
+        [this, &fontFamily, resMgr, preload] {
+            auto start = std::chrono::steady_clock::now();
+            bool success = RegisterFont(fontFamily, resMgr);
+            auto cost =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            KR_LOG_INFO << "load font: " << fontFamily << ", success: " << success << ", preload: " << preload
+                        << ", cost us: " << cost.count();
+            return success;
+        });
+}
+
+void KRFontCollectionManager::PreloadFonts(const std::vector<std::string> &fontFamilies,
+                                           NativeResourceManager *resMgr) {
+    if (fontFamilies.empty()) {
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [this, fontFamilies, resMgr] {
+            for (const auto &fontFamily : fontFamilies) {
+                LoadCustomFont(fontFamily, resMgr, true);
+            }
+        },
+        KRQoS::kUserInitiated);
+}
+
+bool KRFontCollectionManager::RegisterFont(const std::string &fontFamily, NativeResourceManager *resMgr) {
+    auto adapter = KRFontAdapterManager::GetInstance()->GetAdapter(fontFamily);
+    if (adapter == nullptr) {
+        return false;
+    }
+    char *fontBuffer = nullptr;
+    size_t len = 0;
+    KRFontDataDeallocator deallocator = nullptr;
+    char *fontSrc = adapter(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
+    uint32_t error = 1;
+    if (fontSrc) {
+        if (strncmp(fontSrc, kRawFilePrefix, strlen(kRawFilePrefix)) == 0) {
+            RawFile *rawFile =
+                resMgr ? OH_ResourceManager_OpenRawFile(resMgr, fontSrc + strlen(kRawFilePrefix)) : nullptr;
+            if (rawFile) {
+                long rawLen = OH_ResourceManager_GetRawFileSize(rawFile);
+                std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(rawLen);
+                OH_ResourceManager_ReadRawFile(rawFile, data.get(), rawLen);
+                OH_ResourceManager_CloseRawFile(rawFile);
+                error = OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), data.get(), rawLen);
+            }
+        } else {
+            error = OH_Drawing_RegisterFont(collection_, fontFamily.c_str(), fontSrc);
+        }
+        if (deallocator) {
+            deallocator(fontSrc);
+        }
+    } else if (fontBuffer != nullptr && len > 0) {
+        error = OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), reinterpret_cast<uint8_t *>(fontBuffer),
+                                              len);
+        if (deallocator) {
+            deallocator(fontBuffer);
+        }
+    }
+    return error == 0;
+}
+
+std::string KRFontCollectionManager::GetStatsJson() {
+    int64_t total_load_time_us = 0;
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("fonts");
+    writer.BeginObject();
+    fonts_.ForEachLoaded([&writer, &total_load_time_us](const std::string &fontFamily,
+                                                        const KRLoadOnceRegistry::Record &record) {
+        total_load_time_us += record.load_time_us;
+        writer.Key(fontFamily);
+        writer.BeginObject();
+        writer.Key("loadTimeMs");
+        writer.Double(record.load_time_us / 1000.0);
+        writer.Key("preload");
+        writer.Bool(record.preload);
+        writer.EndObject();
+    });
+    writer.EndObject();
+    writer.Key("totalLoadTimeMs");
+    writer.Double(total_load_time_us / 1000.0);
+    writer.Key("failedCount");
+    writer.Int(fonts_.FailedCount());
+    writer.EndObject();
+    return json;
+}
@@ -0,0 +1,69 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFONTCOLLECTIONMANAGER_H
+#define CORE_RENDER_OHOS_KRFONTCOLLECTIONMANAGER_H
+
+#include <native_drawing/drawing_text_declaration.h>
+#include <rawfile/raw_file_manager.h>
+#include <string>
+#include <vector>
+#include "libohos_render/utils/KRLoadOnceRegistry.h"
+
+/**
+ * 进程级字体集合：所有文本排版共用同一个 FontCollection，每个自定义字体族只加载一次。
+ * 加载可在 Context 线程、主线程或后台线程发生，同一字体族并发加载时后到者等待先到者完成
+ */
+class KRFontCollectionManager final {
+ public:
+    static KRFontCollectionManager *GetInstance();
+
+    /**
+     * 共享字体集合，进程内不销毁，调用方不可释放
+     */
+    OH_Drawing_FontCollection *SharedFontCollection() {
+        return collection_;
+    }
+
+    /**
+     * 确保自定义字体已注册到共享字体集合，未注册字体适配器的字体族直接返回
+     * @param fontFamily 字体族名
+     * @param resMgr 资源管理器，用于读取 rawfile 字体
+     * @return 字体是否可用
+     */
+    bool LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr);
+
+    /**
+     * 在后台线程预加载字体，页面启动时调用，避免首屏排版时同步读取字体文件
+     */
+    void PreloadFonts(const std::vector<std::string> &fontFamilies, NativeResourceManager *resMgr);
+
+    /**
+     * 字体加载统计的 JSON 字符串，用于性能数据上报
+     */
+    std::string GetStatsJson();
+
+ private:
+    KRFontCollectionManager();
+    ~KRFontCollectionManager() = delete;
+
+    bool RegisterFont(const std::string &fontFamily, NativeResourceManager *resMgr);
+    bool LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr, bool preload);
+
+    OH_Drawing_FontCollection *collection_ = nullptr;
+    KRLoadOnceRegistry fonts_;  // 按字体族登记加载状态
+};
+
+#endif  // CORE_RENDER_OHOS_KRFONTCOLLECTIONMANAGER_H
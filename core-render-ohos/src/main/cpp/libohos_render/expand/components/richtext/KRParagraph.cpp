@@ -16,29 +16,17 @@
 #include <deviceinfo.h>
 #include <native_drawing/drawing_brush.h>
 #include <native_drawing/drawing_pen.h>
-#include <native_drawing/drawing_register_font.h>
 #include <native_drawing/drawing_shader_effect.h>
 
-#include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render//foundation/KRCommon.h"
 #include "libohos_render/foundation/KRConfig.h"
 #include "libohos_render/utils/KRConvertUtil.h"
+#include "libohos_render/utils/KRStringUtil.h"
+#include "libohos_render/utils/KRUtf8Util.h"
 #include "libohos_render/utils/KRViewUtil.h"
 
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-// Remove this declaration if compatable api is raised to 14 and above
-extern OH_Drawing_FontCollection *OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
-#ifdef __cplusplus
-};
-#endif
-constexpr char kRawFilePrefix[] = "rawfile:";
-
-static bool isRawFilePath(const std::string &src) { return src.find(kRawFilePrefix) == 0; }
-
 constexpr int SHADER_EFFECT_DESTROY_API_LEVEL = 19;
 static void KRSafeCall_OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *shaderEffect) {
     // OH_Drawing_ShaderEffectDestroy has known issues:
@@ -53,77 +41,6 @@ static void KRSafeCall_OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *s
     }
 }
 
-class KRFontCollectionManager final {
-  public:
-    static std::shared_ptr<KRFontCollectionManager> &GetInstance() {
-        static std::shared_ptr<KRFontCollectionManager> instance_ = nullptr;
-        static std::once_flag flag;
-        std::call_once(flag, []() { instance_ = std::make_shared<KRFontCollectionManager>(); });
-        return instance_;
-    }
-
-    KRFontCollectionManager() {
-        if (OH_Drawing_GetFontCollectionGlobalInstance) {
-            collection_ = OH_Drawing_GetFontCollectionGlobalInstance();
-        } else {
-            collection_ = OH_Drawing_CreateSharedFontCollection();
-        }
-    }
-
-    void LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr) {
-        if (fontFamily.empty() || resMgr == nullptr) {
-            return;
-        }
-        auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
-        if (auto adapter = fontAdapters.find(fontFamily); adapter != fontAdapters.end()) {
-            if (registered_.find(fontFamily) == registered_.end()) {
-                char *fontBuffer = nullptr;
-                size_t len = 0;
-                KRFontDataDeallocator deallocator = nullptr;
-                char *fontSrc = adapter->second(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
-                if (fontSrc) {
-                    uint32_t error = 0;
-                    auto fontStrString = std::string(fontSrc);
-                    if (isRawFilePath(std::string(fontSrc))) {
-                        auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
-                        RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
-                        long len = OH_ResourceManager_GetRawFileSize(rawFile);
-                        std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
-                        int res = OH_ResourceManager_ReadRawFile(rawFile, data.get(), len);
-                        OH_ResourceManager_CloseRawFile(rawFile);
-
-                        error = OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), data.get(), len);
-                    } else {
-                        error = OH_Drawing_RegisterFont(collection_, fontFamily.c_str(), fontSrc);
-                    }
-                    if (error == 0) {
-                        registered_.emplace(fontFamily);
-                    }
-
-                    if (deallocator) {
-                        deallocator(fontSrc);
-                    }
-                } else if (fontBuffer != nullptr && len > 0) {
-                    uint32_t error =
-                      OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), (uint8_t *)fontBuffer, len);
-                    if (error == 0) {
-                        registered_.emplace(fontFamily);
-                    }
-                    if (deallocator) {
-                        deallocator(fontBuffer);
-                    }
-                }
-            }
-        }
-    }
-
-    OH_Drawing_FontCollection *SharedFontCollection() { return collection_; }
-
-  private:
-    OH_Drawing_FontCollection *collection_;
-    std::unordered_set<std::string> registered_;
-};
-
 static KRAnyValue GetKTValue(const char *key, const KRRenderValue::Map &map0, const KRRenderValue::Map &map1) {
     auto it = map0.find(key);
     if (it != map0.end()) {
@@ -136,11 +53,6 @@ static KRAnyValue GetKTValue(const char *key, const KRRenderValue::Map &map0, co
     return std::make_shared<KRRenderValue>(nullptr);
 }
 
-template <class Facet> struct deletable_facet : Facet {
-    template <class... Args> deletable_facet(Args &&...args) : Facet(std::forward<Args>(args)...) {}
-    ~deletable_facet() {}
-};
-
 KRParagraph::KRParagraph(KRRenderValue::Array spans, KRRenderValue::Map props, float font_size_scale,
                          float font_weight_scale, float density, NativeResourceManager *resource_manager,
                          std::shared_ptr<kuikly::util::KRLinearGradientParser> gradient)
@@ -344,11 +256,9 @@ void KRParagraph::AddSpanToStyledString(const KRRenderValue::Map &spanMap, ArkUI
         OH_ArkUI_StyledString_AddText(styled_string, text.c_str());
         // OH_Drawing_TypographyHandlerAddText(handler, text.c_str());  // 添加文本
 
-        std::wstring_convert<deletable_facet<std::codecvt<char16_t, char, std::mbstate_t>>, char16_t> conv16;
-        std::u16string str16 = conv16.from_bytes(text);
-        int codePointCount = str16.size();
-        span_offsets_.emplace_back(std::tuple(spanIndex, charOffset, charOffset + codePointCount));
-        charOffset += codePointCount;
+        int codeUnitCount = static_cast<int>(kuikly::util::Utf16Length(text));
+        span_offsets_.Add(spanIndex, charOffset, charOffset + codeUnitCount);
+        charOffset += codeUnitCount;
     }
     ++spanIndex;
 
@@ -361,7 +271,7 @@ ArkUI_StyledString *KRParagraph::BuildStyledString(float width, float height) {
     charOffset = 0;
     spanIndex = 0;
     placeholder_count = 0;
-    span_offsets_.clear();
+    span_offsets_.Clear();
     placeholder_index_map_.clear();
 
     // create OH_Drawing_TypographyStyle
@@ -401,35 +311,7 @@ std::tuple<float, float, float, float> KRParagraph::SpanRect(int spanIndex) {
 
 
 int KRParagraph::SpanIndexAt(float spanX, float spanY) {
-    int resultIndex = -1;
-    if (typography_ == nullptr) {
-        return resultIndex;
-    }
-    for (int index = 0; index < span_offsets_.size(); ++index) {
-        int lastSpanIndex = std::get<0>(span_offsets_[index]);
-        int lastSpanBegin = std::get<1>(span_offsets_[index]);
-        int lastSpanEnd = std::get<2>(span_offsets_[index]);
-        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(typography_, lastSpanBegin, lastSpanEnd,
-                                                                        RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
-        int n = OH_Drawing_GetSizeOfTextBox(box);
-        auto dpi = KRConfig::GetDpi();
-        for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
-            float left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
-            float right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
-            float top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
-            float bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
-            if (spanX < left || spanX >= right || spanY < top || spanY >= bottom) {
-                continue;
-            }
-            resultIndex = lastSpanIndex;
-            break;
-        }
-        OH_Drawing_TypographyDestroyTextBox(box);
-        if (resultIndex != -1) {
-            break;
-        }
-    }
-    return resultIndex;
+    return span_offsets_.HitTest(typography_, spanX, spanY, KRConfig::GetDpi());
 }
 
 OH_Drawing_ShaderEffect *KRParagraph::CreateShaderEffect(std::shared_ptr<kuikly::util::KRLinearGradientParser> linearGradient) {
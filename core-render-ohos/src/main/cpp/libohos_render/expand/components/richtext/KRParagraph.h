@@ -18,6 +18,7 @@
 #include <arkui/styled_string.h>
 #include <tuple>
 
+#include "libohos_render/expand/components/richtext/KRSpanOffsetIndex.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
 #include "libohos_render/utils/KRLinearGradientParser.h"
 
@@ -53,7 +54,7 @@ class KRParagraph final {
     int placeholder_count = 0;
     int spanIndex = 0;
     std::unordered_map<int, int> placeholder_index_map_;
-    std::vector<std::tuple<int, int, int>> span_offsets_; // span, begin, end
+    KRSpanOffsetIndex span_offsets_;
 
     ArkUI_StyledString *styled_string_ = nullptr;
     OH_Drawing_Typography *typography_ = nullptr;
@@ -22,24 +22,28 @@
 #include <native_drawing/drawing_text_declaration.h>
 #include <native_drawing/drawing_text_typography.h>
 
+#include <atomic>
 #include <cassert>
-#include <codecvt>
+#include <condition_variable>
+#include <mutex>
 #include <unordered_set>
 
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/scheduler/KRContextScheduler.h"
 #include "libohos_render/utils/KRConvertUtil.h"
 #include "libohos_render/utils/KRLinearGradientParser.h"
 #include "libohos_render/utils/KRStringUtil.h"
+#include "libohos_render/utils/KRUtf8Util.h"
 #include "libohos_render/utils/KRViewUtil.h"
 
 static bool KR_TEXT_RENDER_V2_ENABLED = false;
 #ifdef __cplusplus
 extern "C" {
 #endif
-// Remove this declaration if compatable api is raised to 14 and above
-extern OH_Drawing_FontCollection* OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
-
 void KREnableTextRenderV2(){
     KR_TEXT_RENDER_V2_ENABLED = true;
 }
@@ -47,19 +51,183 @@ void KREnableTextRenderV2(){
 };
 #endif
 
-// utility wrapper to adapt locale-bound facets for wstring/wbuffer convert
-template <class Facet> struct deletable_facet : Facet {
-    template <class... Args> deletable_facet(Args &&...args) : Facet(std::forward<Args>(args)...) {}
-    ~deletable_facet() {}
+/**
+ * 文本排版输入
+ */
+struct KRTextLayoutInput {
+    const KRRenderValue::Map *props = nullptr;
+    const KRRenderValue::Array *values = nullptr;
+    float font_size_scale = 1;
+    float font_weight_scale = 1;
+    double dpi = 1;
+    NativeResourceManager *res_mgr = nullptr;
 };
 
-constexpr char kRawFilePrefix[] = "rawfile:";
+static void CreateTextTypography(const KRTextLayoutInput &input, double constraint_width,
+                                 const std::function<void(OH_Drawing_TextStyle *, double)> &did_build_text_style,
+                                 const std::function<KRSize()> &estimate_size, KRTextLayoutResult &result);
+static void LayoutTextTypography(KRTextLayoutResult &result, double constraint_width, double dpi);
+
+static uint64_t TextContentKey(const KRRenderValue::Map &props, const KRRenderValue::Array &values,
+                               float font_size_scale, float font_weight_scale, double dpi) {
+    uint64_t key = KRTextMeasureCache::HashMap(props, 0);
+    for (const auto &span : values) {
+        key = span ? KRTextMeasureCache::HashValue(*span, key) : KRTextMeasureCache::HashDouble(0, key);
+    }
+    key = KRTextMeasureCache::HashDouble(font_size_scale, key);
+    key = KRTextMeasureCache::HashDouble(font_weight_scale, key);
+    key = KRTextMeasureCache::HashDouble(dpi, key);
+    return key == 0 ? 1 : key;
+}
+
+static uint64_t TextMeasureKey(uint64_t content_key, double constraint_width) {
+    uint64_t key = KRTextMeasureCache::HashDouble(constraint_width, content_key);
+    return key == 0 ? 1 : key;
+}
 
-static bool isRawFilePath(const std::string &src) {
-    return src.find(kRawFilePrefix) == 0;
+/**
+ * 深拷贝属性值，快照只由后台线程访问，其转换缓存不与 Context 线程上的原值共用
+ */
+static std::shared_ptr<KRRenderValue> CopySnapshotValue(const std::shared_ptr<KRRenderValue> &value) {
+    if (value == nullptr) {
+        return nullptr;
+    }
+    if (value->isString()) {
+        return std::make_shared<KRRenderValue>(value->toString());
+    }
+    if (value->isBool()) {
+        return std::make_shared<KRRenderValue>(value->toBool());
+    }
+    if (value->isInt()) {
+        return std::make_shared<KRRenderValue>(value->toInt());
+    }
+    if (value->isLong()) {
+        return std::make_shared<KRRenderValue>(value->toLong());
+    }
+    if (value->isFloat()) {
+        return std::make_shared<KRRenderValue>(value->toFloat());
+    }
+    if (value->isDouble()) {
+        return std::make_shared<KRRenderValue>(value->toDouble());
+    }
+    if (value->isMap()) {
+        KRRenderValue::Map map;
+        for (const auto &entry : value->toMap()) {
+            map.emplace(entry.first, CopySnapshotValue(entry.second));
+        }
+        return std::make_shared<KRRenderValue>(std::move(map));
+    }
+    if (value->isArray()) {
+        KRRenderValue::Array array;
+        array.reserve(value->toArray().size());
+        for (const auto &element : value->toArray()) {
+            array.push_back(CopySnapshotValue(element));
+        }
+        return std::make_shared<KRRenderValue>(std::move(array));
+    }
+    if (value->isByteArray()) {  // 二进制内容不可变，共用即可
+        return std::make_shared<KRRenderValue>(value->toByteArray());
+    }
+    return std::make_shared<KRRenderValue>(nullptr);
 }
 
+static void DestroyLayoutResult(KRTextLayoutResult &result) {
+    if (result.typography != nullptr) {
+        OH_Drawing_DestroyTypography(result.typography);
+    }
+    result = KRTextLayoutResult();
+}
+
+/**
+ * 预排版状态，由 shadow 与后台排版任务共同持有；快照在 Context 线程生成，后台线程只读
+ */
+struct KRRichTextShadow::SpeculativeLayout {
+    struct Snapshot {
+        KRRenderValue::Map props;
+        KRRenderValue::Array values;
+        uint64_t content_key = 0;  // 生成快照时在 Context 线程计算的属性哈希
+    };
+
+    std::shared_ptr<KRRenderContextParams> context;  // 读取页面内的约束宽度提示
+    float font_size_scale = 1;
+    float font_weight_scale = 1;
+    double dpi = 1;
+    NativeResourceManager *res_mgr = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable condition;  // 排版任务结束时通知
+    std::unique_ptr<Snapshot> pending;  // 尚未排版的最新属性快照
+    bool scheduled = false;             // 排版任务已派发或正在执行
+    bool snapshot_requested = false;    // 已投递 Context 任务，待本次任务的属性更新结束后生成快照
+    bool running = false;
+    bool cancelled = false;
+    uint64_t running_key = 0;  // 正在排版的快照对应的属性哈希
+    uint64_t content_key = 0;  // result 对应的属性哈希
+    double constraint_width = 0;
+    KRTextLayoutResult result;
+
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (pending && !cancelled) {
+            std::unique_ptr<Snapshot> snapshot = std::move(pending);
+            running = true;
+            running_key = snapshot->content_key;
+            lock.unlock();
+            KRTextLayoutResult next;
+            uint64_t next_key = 0;
+            double width = context->TextConstraintWidthHint();
+            if (!HasTextGradient(*snapshot)) {  // 渐变文本需先测量再创建着色器，不预排版
+                KRTextLayoutInput input;
+                input.props = &snapshot->props;
+                input.values = &snapshot->values;
+                input.font_size_scale = font_size_scale;
+                input.font_weight_scale = font_weight_scale;
+                input.dpi = dpi;
+                input.res_mgr = res_mgr;
+                next_key = snapshot->content_key;
+                CreateTextTypography(input, width, nullptr, nullptr, next);
+            }
+            lock.lock();
+            DestroyLayoutResult(result);
+            result = std::move(next);
+            content_key = next_key;
+            constraint_width = width;
+        }
+        running = false;
+        running_key = 0;
+        scheduled = false;
+        if (cancelled) {
+            DestroyLayoutResult(result);
+        }
+        condition.notify_all();
+    }
+
+    static bool HasTextGradient(const Snapshot &snapshot) {
+        auto has_gradient = [](const KRRenderValue::Map &map) {
+            auto it = map.find("backgroundImage");
+            return it != map.end() && it->second && !it->second->toString().empty();
+        };
+        if (has_gradient(snapshot.props)) {
+            return true;
+        }
+        for (const auto &span : snapshot.values) {
+            if (has_gradient(span->toMap())) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
 KRRichTextShadow::~KRRichTextShadow() {
+    if (auto layout = speculative_layout_) {
+        std::lock_guard<std::mutex> lock(layout->mutex);
+        layout->pending.reset();
+        layout->cancelled = true;
+        if (!layout->running) {
+            DestroyLayoutResult(layout->result);
+        }
+    }
     if (context_thread_typography_ != nullptr) {
         OH_Drawing_DestroyTypography(context_thread_typography_);
     }
@@ -74,9 +242,13 @@ KRRichTextShadow::~KRRichTextShadow() {
 void KRRichTextShadow::SetProp(const std::string &prop_key, const KRAnyValue &prop_value) {
     if (prop_key == "values") {
         values_ = prop_value->toArray();
-        return;
+    } else {
+        props_[prop_key] = prop_value;
+    }
+    // 文本内容到达后开始预排版，之后的属性更新刷新快照
+    if (!did_measure_ && (speculative_layout_ || prop_key == "values" || prop_key == "value" || prop_key == "text")) {
+        ScheduleSpeculativeLayout();
     }
-    props_[prop_key] = prop_value;
 }
 
 /**
@@ -105,11 +277,191 @@ KRSize KRRichTextShadow::CalculateRenderViewSize(double constraint_width, double
     }else{
         SetParagraph(nullptr);
     }
+    did_measure_ = true;
+    uint64_t content_key = MeasureContentKey();
+    if (context_params_ != nullptr) {
+        context_params_->SetTextConstraintWidthHint(constraint_width);
+    }
+    uint64_t key = content_key != 0 ? TextMeasureKey(content_key, constraint_width) : 0;
+    if (key != 0 && key == context_measure_key_) {  // 内容、样式与约束宽度均未变化，复用上次结果
+        if (typography_pending_) {
+            pending_constraint_height_ = constraint_height;
+        }
+        return context_measure_size_;
+    }
     ReleaseLastTypography();
-    BuildTextTypography(constraint_width, constraint_height);
+    KRTextLayoutResult speculative;
+    if (TakeSpeculativeLayout(content_key, constraint_width, speculative)) {
+        ApplyLayoutResult(std::move(speculative));
+        CacheMeasureResult(key);
+        return context_measure_size_;
+    }
+    KRTextMeasureResult cached;
+    if (key != 0 && KRTextMeasureCache::GetInstance().Get(key, cached)) {
+        context_measure_size_ = cached.size;
+        context_thread_drawOffsetY_ = cached.draw_offset_y;
+        context_thread_text_align_ = cached.text_align;
+        context_measure_key_ = key;
+        typography_pending_ = true;
+        pending_constraint_width_ = constraint_width;
+        pending_constraint_height_ = constraint_height;
+        return context_measure_size_;
+    }
+    if (BuildTextTypography(constraint_width, constraint_height) != nullptr) {
+        CacheMeasureResult(key);
+    }
     return context_measure_size_;
 }
 
+void KRRichTextShadow::CacheMeasureResult(uint64_t key) {
+    if (key == 0 || context_thread_typography_ == nullptr) {
+        return;
+    }
+    KRTextMeasureResult result;
+    result.size = context_measure_size_;
+    result.draw_offset_y = context_thread_drawOffsetY_;
+    result.text_align = context_thread_text_align_;
+    KRTextMeasureCache::GetInstance().Put(key, result);
+    context_measure_key_ = key;
+}
+
+bool KRRichTextShadow::ResolveContextParams() {
+    if (context_params_ != nullptr) {
+        return true;
+    }
+    auto rootView = GetRootView().lock();
+    if (rootView == nullptr) {
+        return false;
+    }
+    context_params_ = rootView->GetContext();
+    auto config = context_params_->Config();
+    font_size_scale_ = config->GetFontSizeScale();
+    font_weight_scale_ = config->GetFontWeightScale();
+    // rootView 可能是最后一个持有者，需在主线程释放
+    KRMainThread::RunOnMainThread([rootView] { rootView.get(); });
+    return true;
+}
+
+uint64_t KRRichTextShadow::MeasureContentKey() {
+    if (!ResolveContextParams()) {
+        return 0;
+    }
+    return TextContentKey(props_, values_, font_size_scale_, font_weight_scale_, KRConfig::GetDpi());
+}
+
+void KRRichTextShadow::ScheduleSpeculativeLayout() {
+    if (speculative_layout_ == nullptr) {
+        if (speculative_layout_disabled_ || !ResolveContextParams()) {
+            return;
+        }
+        if (StyledStringEnabled() || !context_params_->Config()->IsParallelTextLayoutEnabled()) {
+            speculative_layout_disabled_ = true;
+            return;
+        }
+        auto rootView = GetRootView().lock();
+        if (rootView == nullptr) {
+            return;
+        }
+        speculative_layout_ = std::make_shared<SpeculativeLayout>();
+        speculative_layout_->context = context_params_;
+        speculative_layout_->font_size_scale = font_size_scale_;
+        speculative_layout_->font_weight_scale = font_weight_scale_;
+        speculative_layout_->dpi = KRConfig::GetDpi();
+        speculative_layout_->res_mgr = rootView->GetNativeResourceManager();
+        KRMainThread::RunOnMainThread([rootView] { rootView.get(); });
+    }
+    // 属性逐条下发，待当前 Context 任务结束后再生成快照，避免每次更新都复制全部属性
+    if (speculative_layout_->snapshot_requested) {
+        return;
+    }
+    speculative_layout_->snapshot_requested = true;
+    std::weak_ptr<IKRRenderShadowExport> weakSelf = shared_from_this();
+    KRContextScheduler::ScheduleTask(context_params_->InstanceId(), false, 0, [weakSelf] {
+        auto strongSelf = weakSelf.lock();
+        if (!strongSelf) {
+            return;
+        }
+        std::static_pointer_cast<KRRichTextShadow>(strongSelf)->SnapshotSpeculativeLayout();
+    }, KRTaskPriority::kLayout);
+}
+
+void KRRichTextShadow::SnapshotSpeculativeLayout() {
+    auto layout = speculative_layout_;
+    if (layout == nullptr) {  // 快照前已完成首次测量
+        return;
+    }
+    layout->snapshot_requested = false;
+    auto snapshot = std::make_unique<SpeculativeLayout::Snapshot>();
+    for (const auto &prop : props_) {
+        snapshot->props.emplace(prop.first, CopySnapshotValue(prop.second));
+    }
+    snapshot->values.reserve(values_.size());
+    for (const auto &span : values_) {
+        // Span 可能是 JSON 字符串，先在 Context 线程解析为 Map 再深拷贝
+        KRRenderValue::Map span_map;
+        if (span) {
+            for (const auto &entry : span->toMap()) {
+                span_map.emplace(entry.first, CopySnapshotValue(entry.second));
+            }
+        }
+        snapshot->values.push_back(std::make_shared<KRRenderValue>(std::move(span_map)));
+    }
+    snapshot->content_key =
+        TextContentKey(snapshot->props, snapshot->values, layout->font_size_scale, layout->font_weight_scale, layout->dpi);
+    std::lock_guard<std::mutex> lock(layout->mutex);
+    layout->pending = std::move(snapshot);
+    if (!layout->scheduled) {
+        layout->scheduled = true;
+        KRGCDQueue::GetInstance().DispatchAsync([layout] { layout->Run(); }, KRQoS::kUserInitiated);
+    }
+}
+
+bool KRRichTextShadow::TakeSpeculativeLayout(uint64_t content_key, double constraint_width,
+                                             KRTextLayoutResult &result) {
+    auto layout = std::move(speculative_layout_);
+    if (layout == nullptr) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(layout->mutex);
+    layout->pending.reset();  // 尚未开始的快照不再排版
+    auto &stats = KRTextMeasureCache::GetInstance();
+    if (layout->running) {
+        if (content_key == 0 || layout->running_key != content_key) {
+            // 正在排版的快照已过期，不等待，排版任务结束时自行销毁结果
+            layout->cancelled = true;
+            stats.RecordSpeculativeLayout(KRTextMeasureCache::SpeculativeLayoutResult::kMiss);
+            return false;
+        }
+        layout->condition.wait(lock, [&layout] { return !layout->running; });
+    }
+    layout->cancelled = true;
+    if (layout->result.typography == nullptr) {
+        return false;
+    }
+    if (content_key == 0 || layout->content_key != content_key) {  // 预排版后属性又发生了变化
+        DestroyLayoutResult(layout->result);
+        stats.RecordSpeculativeLayout(KRTextMeasureCache::SpeculativeLayoutResult::kMiss);
+        return false;
+    }
+    result = std::move(layout->result);
+    layout->result = KRTextLayoutResult();
+    if (layout->constraint_width != constraint_width) {
+        LayoutTextTypography(result, constraint_width, layout->dpi);
+        stats.RecordSpeculativeLayout(KRTextMeasureCache::SpeculativeLayoutResult::kRelayout);
+    } else {
+        stats.RecordSpeculativeLayout(KRTextMeasureCache::SpeculativeLayoutResult::kHit);
+    }
+    return true;
+}
+
+void KRRichTextShadow::EnsureTypography() {
+    if (!typography_pending_) {
+        return;
+    }
+    typography_pending_ = false;
+    BuildTextTypography(pending_constraint_width_, pending_constraint_height_);
+}
+
 KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height) {
     auto rootView = GetRootView().lock();
     if (rootView == nullptr) {
@@ -138,7 +490,7 @@ KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constrai
     float fontSizeScale = rootView->GetContext()->Config()->GetFontSizeScale();
     float fontWeightScale = rootView->GetContext()->Config()->GetFontWeightScale();
 
-    span_offsets_.clear();
+    span_offsets_ = nullptr;
     placeholder_index_map_.clear();
     KRRenderValue::Array spans = values_;
     if (spans.empty()) {
@@ -162,15 +514,18 @@ bool KRRichTextShadow::StyledStringEnabled(){
  * @return
  */
 KRSchedulerTask KRRichTextShadow::TaskToMainQueueWhenWillSetShadowToView() {
+    EnsureTypography();
     auto self = shared_from_this();
     auto typography = context_thread_typography_;
     auto offsetY = context_thread_drawOffsetY_;
     auto offsetX = context_thread_drawOffsetX_;
     auto measure_size = context_measure_size_;
     auto text_align = context_thread_text_align_;
-    return [self, typography, offsetY, offsetX, measure_size, text_align] {
+    auto span_offsets = span_offsets_;
+    return [self, typography, offsetY, offsetX, measure_size, text_align, span_offsets] {
         KRRichTextShadow *shadow = reinterpret_cast<KRRichTextShadow *>(self.get());
         shadow->SetMainThreadTypography(typography);
+        shadow->main_thread_span_offsets_ = span_offsets;
         shadow->main_thread_drawOffsetY_ = offsetY;
         shadow->main_thread_drawOffsetX_ = offsetX;
         shadow->main_thread_text_align_ = text_align;
@@ -190,60 +545,6 @@ static KRAnyValue GetKRValue(const char *key, const KRRenderValue::Map &map0, co
     return std::make_shared<KRRenderValue>(nullptr);
 }
 
-KRFontCollectionWrapper::KRFontCollectionWrapper() : fontCollection(OH_Drawing_CreateSharedFontCollection()) {
-    // blank
-}
-KRFontCollectionWrapper::~KRFontCollectionWrapper() {
-    if (fontCollection) {
-        OH_Drawing_DestroyFontCollection(fontCollection);
-        fontCollection = nullptr;
-    }
-}
-
-void SetCustomFontIfApplicable(NativeResourceManager *resMgr, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                               const std::string &fontFamily,
-                               const std::unordered_map<std::string, KRFontAdapter> &fontAdapters) {
-    auto adapter = fontAdapters.find(fontFamily);
-    if (adapter != fontAdapters.end() && wrapper->registered.find(fontFamily) == wrapper->registered.end()) {
-        char *fontBuffer = nullptr;
-        size_t len = 0;
-        KRFontDataDeallocator deallocator = nullptr;
-        char *fontSrc = adapter->second(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
-        if (fontSrc) {
-            uint32_t error = 0;
-            auto fontStrString = std::string(fontSrc);
-            if (isRawFilePath(std::string(fontSrc))) {
-                auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
-                RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
-                long len = OH_ResourceManager_GetRawFileSize(rawFile);
-                std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
-                int res = OH_ResourceManager_ReadRawFile(rawFile, data.get(), len);
-                OH_ResourceManager_CloseRawFile(rawFile);
-                error = OH_Drawing_RegisterFontBuffer(wrapper->fontCollection, fontFamily.c_str(), data.get(), len);
-            } else {
-                error = OH_Drawing_RegisterFont(wrapper->fontCollection, fontFamily.c_str(), fontSrc);
-            }
-            if (error == 0) {
-                wrapper->registered.emplace(fontFamily);
-            }
-
-            if (deallocator) {
-                deallocator(fontSrc);
-            }
-        } else if (fontBuffer != nullptr && len > 0) {
-            uint32_t error =
-                OH_Drawing_RegisterFontBuffer(wrapper->fontCollection, fontFamily.c_str(),
-                                              reinterpret_cast<uint8_t *>(fontBuffer), len);
-            if (error == 0) {
-                wrapper->registered.emplace(fontFamily);
-            }
-            if (deallocator) {
-                deallocator(fontBuffer);
-            }
-        }
-    }
-}
-
 std::string KRRichTextShadow::GetTextContent() {
     std::string txt;
     for (auto span : values_) {
@@ -264,46 +565,43 @@ std::string KRRichTextShadow::GetTextContent() {
     return txt;
 }
 
-OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_width, double constraint_height) {
-    auto rootView = GetRootView().lock();
-    if (rootView == nullptr) {
-        return nullptr;
+/**
+ * 以约束宽度（0 为不限宽）排版并更新测量尺寸，已创建的排版对象可重复排版，无需重新创建
+ */
+static void LayoutTextTypography(KRTextLayoutResult &result, double constraint_width, double dpi) {
+    if (constraint_width == 0) {
+        constraint_width = 10000000;  // 无限宽
     }
+    double maxWidth = constraint_width * dpi;
+    OH_Drawing_TypographyLayout(result.typography, maxWidth);
+    // 获取文本布局结果的宽高
+    auto height = OH_Drawing_TypographyGetHeight(result.typography);
+    auto longestLineWidth =
+        std::fmax(0, std::fmin(std::ceil(OH_Drawing_TypographyGetLongestLine(result.typography)), maxWidth));
+    result.size = KRSize(longestLineWidth / dpi, height / dpi);
+}
 
-    struct RootViewThreadingDispatcher {
-        RootViewThreadingDispatcher(std::shared_ptr<IKRRenderView> r) : rootView_(r) {
-            // blank
-        }
-        ~RootViewThreadingDispatcher() {
-            if (auto theRootView = rootView_) {
-                //
-                // We need to dispatch it back to main thread to avoid destructing it on context thread,
-                // in case `rootView` variable is the last holding onto the root render view.
-                //
-                KRMainThread::RunOnMainThread([theRootView] { theRootView.get(); });
-            }
-        }
-
-        std::shared_ptr<IKRRenderView> rootView_;
-    } rootViewThreadingDispatcher(rootView);
-
-    float fontSizeScale = rootView->GetContext()->Config()->GetFontSizeScale();
-    float fontWeightScale = rootView->GetContext()->Config()->GetFontWeightScale();
-
-    span_offsets_.clear();
-    placeholder_index_map_.clear();
-    KRRenderValue::Array spans = values_;
+/**
+ * 按属性创建排版对象并排版，只读访问 input、不访问 shadow 成员，可在后台线程执行
+ */
+static void CreateTextTypography(const KRTextLayoutInput &input, double constraint_width,
+                                 const std::function<void(OH_Drawing_TextStyle *, double)> &did_build_text_style,
+                                 const std::function<KRSize()> &estimate_size, KRTextLayoutResult &result) {
+    const KRRenderValue::Map &props = *input.props;
+    float fontSizeScale = input.font_size_scale;
+    float fontWeightScale = input.font_weight_scale;
+
+    KRRenderValue::Array spans = *input.values;
     if (spans.empty()) {
-        spans.push_back(std::make_shared<KRRenderValue>(props_));
+        spans.push_back(std::make_shared<KRRenderValue>(props));
     }
-    auto numberOfLines = GetKRValue("numberOfLines", props_, props_)->toInt();
-    const std::string lineBreakModeStr = GetKRValue("lineBreakMode", props_, props_)->toString();
+    auto numberOfLines = GetKRValue("numberOfLines", props, props)->toInt();
+    const std::string lineBreakModeStr = GetKRValue("lineBreakMode", props, props)->toString();
     auto lineBreakMode = kuikly::util::ConvertToTextBreakMode(lineBreakModeStr);
     if (numberOfLines == 0) {
         numberOfLines = 10000;
     }
-    auto self = shared_from_this();
-    double dpi = KRConfig::GetDpi();
+    double dpi = input.dpi;
     OH_Drawing_TypographyStyle *typoStyle = nullptr;
     OH_Drawing_TypographyCreate *handler = nullptr;
     bool isFirst = true;
@@ -311,34 +609,35 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
     int placeholder_count = 0;
     OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
     int charOffset = 0;
-    font_collection_wrapper_ = std::make_shared<KRFontCollectionWrapper>();
-    auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
+    result.span_offsets = std::make_shared<KRSpanOffsetIndex>();
+    auto fontCollectionManager = KRFontCollectionManager::GetInstance();
+    auto nativeResMgr = input.res_mgr;
     for (auto span : spans) {
         auto spanMap = span->toMap();
-        auto fontSize = (GetKRValue("fontSize", spanMap, props_)->toFloat() ?: 15.0) * dpi * fontSizeScale;
+        auto fontSize = (GetKRValue("fontSize", spanMap, props)->toFloat() ?: 15.0) * dpi * fontSizeScale;
         auto text = GetKRValue("value", spanMap, spanMap)->toString();
         if (text.length() == 0) {
             text = GetKRValue("text", spanMap, spanMap)->toString();
         }
-        auto fontWeight = kuikly::util::ConvertFontWeight(GetKRValue("fontWeight", spanMap, props_)->toInt() * fontWeightScale);
+        auto fontWeight = kuikly::util::ConvertFontWeight(GetKRValue("fontWeight", spanMap, props)->toInt() * fontWeightScale);
         // 解析基于Span的多个渐变色属性
-        auto colorStr = GetKRValue("color", spanMap, props_)->toString();
-        auto backgroundImage = GetKRValue("backgroundImage", spanMap, props_)->toString();
+        auto colorStr = GetKRValue("color", spanMap, props)->toString();
+        auto backgroundImage = GetKRValue("backgroundImage", spanMap, props)->toString();
         OH_Drawing_ShaderEffect *colorShaderEffect = nullptr;
         auto linearGradient = std::make_shared<kuikly::util::KRLinearGradientParser>();
         bool hasBackgroundImage = linearGradient->ParseFromCssLinearGradient(backgroundImage);      // 当前是否存在渐变色待解析
 
-        auto fontFamily = GetKRValue("fontFamily", spanMap, props_)->toString();
+        auto fontFamily = GetKRValue("fontFamily", spanMap, props)->toString();
         auto color = colorStr.length() ? kuikly::util::ConvertToHexColor(colorStr) : 0xff000000;                    // 默认黑色
-        auto lineHeight = GetKRValue("lineHeight", spanMap, props_)->toFloat() / (fontSize / dpi);    // 字体比例
-        auto lineSpacing = GetKRValue("lineSpacing", spanMap, props_)->toFloat() / (fontSize / dpi);  // 行间距比例
-        auto textAlign = kuikly::util::ConvertToTextAlign(GetKRValue("textAlign", spanMap, props_)->toString());
-        auto textDecoration = kuikly::util::ConvertToTextDecoration(GetKRValue("textDecoration", spanMap, props_)->toString());
-        auto fontStyle = kuikly::util::ConvertToFontStyle(GetKRValue("fontStyle", spanMap, props_)->toString());
-        auto letterSpacing = GetKRValue("letterSpacing", spanMap, props_)->toDouble();
-        auto textShadowStr = GetKRValue("textShadow", spanMap, props_)->toString();
-        auto strokeWidth = GetKRValue("strokeWidth", spanMap, props_)->toFloat();
-        auto strokeColorStr = GetKRValue("strokeColor", spanMap, props_)->toString();
+        auto lineHeight = GetKRValue("lineHeight", spanMap, props)->toFloat() / (fontSize / dpi);    // 字体比例
+        auto lineSpacing = GetKRValue("lineSpacing", spanMap, props)->toFloat() / (fontSize / dpi);  // 行间距比例
+        auto textAlign = kuikly::util::ConvertToTextAlign(GetKRValue("textAlign", spanMap, props)->toString());
+        auto textDecoration = kuikly::util::ConvertToTextDecoration(GetKRValue("textDecoration", spanMap, props)->toString());
+        auto fontStyle = kuikly::util::ConvertToFontStyle(GetKRValue("fontStyle", spanMap, props)->toString());
+        auto letterSpacing = GetKRValue("letterSpacing", spanMap, props)->toDouble();
+        auto textShadowStr = GetKRValue("textShadow", spanMap, props)->toString();
+        auto strokeWidth = GetKRValue("strokeWidth", spanMap, props)->toFloat();
+        auto strokeColorStr = GetKRValue("strokeColor", spanMap, props)->toString();
         auto strokeColor = strokeColorStr.length() ? kuikly::util::ConvertToHexColor(strokeColorStr) : 0xff000000;
 
         if (typoStyle == nullptr) {
@@ -370,7 +669,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
                 OH_Drawing_TypographyTextSetHeightBehavior(typoStyle, TEXT_HEIGHT_DISABLE_ALL);
             }
 
-            handler = OH_Drawing_CreateTypographyHandler(typoStyle, font_collection_wrapper_->fontCollection);
+            handler = OH_Drawing_CreateTypographyHandler(typoStyle, fontCollectionManager->SharedFontCollection());
         } else {
             isFirst = false;
         }
@@ -424,7 +723,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
                 }
             }
             // 估算文本宽高
-            auto calculateSize = CalculateRenderViewSizeWithStyledString(constraint_width, constraint_height);
+            auto calculateSize = estimate_size ? estimate_size() : KRSize(0, 0);
             // 开始点
             OH_Drawing_Point *startPt = linearGradient->GetStartPoint(calculateSize.width * dpi, calculateSize.height * dpi);
             // 结束点
@@ -456,17 +755,14 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
         } else if (lineHeight > 0) {
             lineHeight = std::max(lineHeight, 1.0);
             OH_Drawing_SetTextStyleFontHeight(txtStyle, lineHeight);
-            context_thread_drawOffsetY_ = (fontSize * lineHeight - fontSize) / 4;  // cai系统绘制存在偏移问题，手动校准
+            result.draw_offset_y = (fontSize * lineHeight - fontSize) / 4;  // cai系统绘制存在偏移问题，手动校准
         }
         // fontFamily
         if (!fontFamily.empty()) {
             const char *fontFamilyPtr = fontFamily.c_str();
             const char *fontFamilies[] = {fontFamilyPtr};
             OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
-            auto rootView = GetRootView();
-            auto rootViewLock = rootView.lock();
-            auto nativeResMgr = rootViewLock->GetNativeResourceManager();
-            SetCustomFontIfApplicable(nativeResMgr, font_collection_wrapper_, fontFamily, fontAdapters);
+            fontCollectionManager->LoadCustomFont(fontFamily, nativeResMgr);
         }
         OH_Drawing_SetTextStyleFontStyle(txtStyle, FONT_STYLE_NORMAL);
         OH_Drawing_SetTextStyleLocale(txtStyle, "en");
@@ -476,7 +772,9 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
         }
         // 调用KRGradientRichTextShadow 绘制渐变色，KRGradientRichTextShadow支持对整个文本基于BackgroundImage属性绘制渐变色
         // 此调用与当前RichtextShadow中的渐变操作不冲突
-        DidBuildTextStyle(txtStyle, dpi);   
+        if (did_build_text_style) {
+            did_build_text_style(txtStyle, dpi);
+        }
         OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
         if (placeholderWidth != 0) {  // 添加占位Span
             auto placeholderHeight = GetKRValue("placeholderHeight", spanMap, spanMap)->toDouble();
@@ -486,17 +784,15 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
                 TEXT_BASELINE_ALPHABETIC,    0,
             };
             OH_Drawing_TypographyHandlerAddPlaceholder(handler, &inlineView);
-            placeholder_index_map_[spanIndex] = placeholder_count;
+            result.placeholder_index_map[spanIndex] = placeholder_count;
             placeholder_count++;
             charOffset += 1;
         } else {
             OH_Drawing_TypographyHandlerAddText(handler, text.c_str());  // 添加文本
 
-            std::wstring_convert<deletable_facet<std::codecvt<char16_t, char, std::mbstate_t>>, char16_t> conv16;
-            std::u16string str16 = conv16.from_bytes(text);
-            int codePointCount = str16.size();
-            span_offsets_.emplace_back(std::tuple(spanIndex, charOffset, charOffset + codePointCount));
-            charOffset += codePointCount;
+            int codeUnitCount = static_cast<int>(kuikly::util::Utf16Length(text));
+            result.span_offsets->Add(spanIndex, charOffset, charOffset + codeUnitCount);
+            charOffset += codeUnitCount;
         }
         OH_Drawing_DestroyTextStyle(txtStyle);
         if (textForegroundPen) {
@@ -510,34 +806,72 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
         spanIndex++;
     }
     // 根据handler对象生成文本排版布局typography
-    context_thread_typography_ = OH_Drawing_CreateTypography(handler);
-    if (constraint_width == 0) {
-        constraint_width = 10000000;  // 无限宽
+    result.typography = OH_Drawing_CreateTypography(handler);
+    result.text_align = text_align;
+    LayoutTextTypography(result, constraint_width, dpi);
+    if (result.size.width < 0.01) {
+        KR_LOG_ERROR << "Measure size:" << result.size.width << ", " << result.size.height
+                     << ", content chars:" << charOffset;
     }
-    double maxWidth = constraint_width * dpi;
-    OH_Drawing_TypographyLayout(context_thread_typography_, maxWidth);
-    // 获取文本布局结果的宽高
-    auto height = OH_Drawing_TypographyGetHeight(context_thread_typography_);
-    auto ouput_measure_height_ = height / dpi;
-    auto longestLineWidth =
-        std::fmax(0, std::fmin(std::ceil(OH_Drawing_TypographyGetLongestLine(context_thread_typography_)), maxWidth));
-    context_thread_text_align_ = text_align;
-    auto ouput_measure_width_ = (longestLineWidth / dpi);
-    if (ouput_measure_width_ < 0.01) {
-        KR_LOG_ERROR << "Measure size:" << ouput_measure_width_ << ", " << ouput_measure_height_
-                     << ", content bytes:" << GetTextContent().size() << ", in shadow view:" << this;
-    }
-
-    context_measure_size_ = KRSize(ouput_measure_width_, ouput_measure_height_);
     if (handler != nullptr) {
         OH_Drawing_DestroyTypographyHandler(handler);
     }
     if (typoStyle != nullptr) {
         OH_Drawing_DestroyTypographyStyle(typoStyle);
     }
+}
+
+OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_width, double constraint_height) {
+    auto rootView = GetRootView().lock();
+    if (rootView == nullptr) {
+        return nullptr;
+    }
+
+    struct RootViewThreadingDispatcher {
+        RootViewThreadingDispatcher(std::shared_ptr<IKRRenderView> r) : rootView_(r) {
+            // blank
+        }
+        ~RootViewThreadingDispatcher() {
+            if (auto theRootView = rootView_) {
+                //
+                // We need to dispatch it back to main thread to avoid destructing it on context thread,
+                // in case `rootView` variable is the last holding onto the root render view.
+                //
+                KRMainThread::RunOnMainThread([theRootView] { theRootView.get(); });
+            }
+        }
+
+        std::shared_ptr<IKRRenderView> rootView_;
+    } rootViewThreadingDispatcher(rootView);
+
+    KRTextLayoutInput input;
+    input.props = &props_;
+    input.values = &values_;
+    input.font_size_scale = rootView->GetContext()->Config()->GetFontSizeScale();
+    input.font_weight_scale = rootView->GetContext()->Config()->GetFontWeightScale();
+    input.dpi = KRConfig::GetDpi();
+    input.res_mgr = rootView->GetNativeResourceManager();
+    KRTextLayoutResult result;
+    CreateTextTypography(
+        input, constraint_width, [this](OH_Drawing_TextStyle *style, double dpi) { DidBuildTextStyle(style, dpi); },
+        [this, constraint_width, constraint_height] {
+            return CalculateRenderViewSizeWithStyledString(constraint_width, constraint_height);
+        },
+        result);
+    ApplyLayoutResult(std::move(result));
     return context_thread_typography_;
 }
 
+void KRRichTextShadow::ApplyLayoutResult(KRTextLayoutResult &&result) {
+    context_thread_typography_ = result.typography;
+    context_thread_drawOffsetY_ = result.draw_offset_y;
+    context_thread_text_align_ = result.text_align;
+    context_measure_size_ = result.size;
+    placeholder_index_map_ = std::move(result.placeholder_index_map);
+    span_offsets_ = std::move(result.span_offsets);
+    result.typography = nullptr;
+}
+
 void KRRichTextShadow::ReleaseLastTypography() {
     OH_Drawing_Typography *typography = context_thread_typography_;
     float drawOffsetY = context_thread_drawOffsetY_;
@@ -547,11 +881,12 @@ void KRRichTextShadow::ReleaseLastTypography() {
     context_thread_drawOffsetX_ = 0;
     context_thread_text_align_ = TEXT_ALIGN_LEFT;
     context_measure_size_ = KRSize(0, 0);
-    std::shared_ptr<struct KRFontCollectionWrapper> collection = std::move(font_collection_wrapper_);
+    context_measure_key_ = 0;
+    typography_pending_ = false;
     if (typography != nullptr) {
         if (auto lock = GetRootView().lock()) {
             std::shared_ptr<IKRRenderShadowExport> self = shared_from_this();
-            lock->AddTaskToMainQueueWithTask([self, typography, drawOffsetY, drawOffsetX, collection] {
+            lock->AddTaskToMainQueueWithTask([self, typography, drawOffsetY, drawOffsetX] {
                 KRRichTextShadow *shadow = static_cast<KRRichTextShadow *>(self.get());
                 if (shadow && shadow->MainThreadTypography() == typography) {
                     shadow->SetMainThreadTypography(nullptr);
@@ -574,6 +909,7 @@ KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
         return NewKRRenderValue(buffer);
     }
 
+    EnsureTypography();
     if (placeholder_index_map_.find(spanIndex) != placeholder_index_map_.end()) {
         auto placeholderIndex = placeholder_index_map_[spanIndex];
         auto placeholderRects = OH_Drawing_TypographyGetRectsForPlaceholders(context_thread_typography_);
@@ -598,29 +934,8 @@ int KRRichTextShadow::SpanIndexAt(float spanX, float spanY) {
         paragraphResultIndex = paragraph->SpanIndexAt(spanX, spanY);
         return paragraphResultIndex;
     }
-    int resultIndex = -1;
-    for (int index = 0; index < span_offsets_.size(); ++index) {
-        int lastSpanIndex = std::get<0>(span_offsets_[index]);
-        int lastSpanBegin = std::get<1>(span_offsets_[index]);
-        int lastSpanEnd = std::get<2>(span_offsets_[index]);
-        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(
-            main_thread_typography_, lastSpanBegin, lastSpanEnd, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
-        int n = OH_Drawing_GetSizeOfTextBox(box);
-        auto dpi = KRConfig::GetDpi();
-        for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
-            float left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
-            float right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
-            float top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
-            float bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
-            if (spanX < left || spanX >= right || spanY < top || spanY >= bottom) {
-                continue;
-            }
-            resultIndex = lastSpanIndex;
-            break;
-        }
-        if (resultIndex != -1) {
-            break;
-        }
+    if (main_thread_span_offsets_ == nullptr) {
+        return -1;
     }
-    return resultIndex;
+    return main_thread_span_offsets_->HitTest(main_thread_typography_, spanX, spanY, KRConfig::GetDpi());
 }
\ No newline at end of file
@@ -20,17 +20,26 @@
 #include <native_drawing/drawing_text_declaration.h>
 #include <native_drawing/drawing_text_typography.h>
 #include <native_drawing/drawing_types.h>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
+#include "libohos_render/expand/components/richtext/KRSpanOffsetIndex.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 
-struct KRFontCollectionWrapper {
-    KRFontCollectionWrapper();
-    ~KRFontCollectionWrapper();
-    OH_Drawing_FontCollection *fontCollection;
-    std::unordered_set<std::string> registered;
+/**
+ * 文本排版结果
+ */
+struct KRTextLayoutResult {
+    OH_Drawing_Typography *typography = nullptr;
+    KRSize size;
+    float draw_offset_y = 0;
+    OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
+    std::unordered_map<int, int> placeholder_index_map;
+    std::shared_ptr<KRSpanOffsetIndex> span_offsets;
 };
 
 class KRRichTextShadow : public IKRRenderShadowExport {
@@ -121,9 +130,21 @@ class KRRichTextShadow : public IKRRenderShadowExport {
 
     KRSize context_measure_size_;
     KRSize main_measure_size_;
+    uint64_t context_measure_key_ = 0;        // 当前测量结果对应的缓存键，0 表示无
+    bool typography_pending_ = false;         // 测量命中缓存，排版对象待创建
+    double pending_constraint_width_ = 0;
+    double pending_constraint_height_ = 0;
+    struct SpeculativeLayout;
+    std::shared_ptr<SpeculativeLayout> speculative_layout_;  // 预排版状态，首次测量后释放
+    bool speculative_layout_disabled_ = false;
+    // 页面上下文与字体缩放配置，首次计算测量缓存键时从 rootView 读取，避免每次测量都持有并转交 rootView
+    std::shared_ptr<KRRenderContextParams> context_params_;
+    float font_size_scale_ = 1;
+    float font_weight_scale_ = 1;
+    bool did_measure_ = false;
     std::unordered_map<int, int> placeholder_index_map_;
-    std::vector<std::tuple<int, int, int>> span_offsets_;  // span, begin, end
-    std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper_;
+    std::shared_ptr<KRSpanOffsetIndex> span_offsets_;
+    std::shared_ptr<KRSpanOffsetIndex> main_thread_span_offsets_;  // 与 main_thread_typography_ 对应，仅主线程访问
     std::shared_ptr<KRParagraph> paragraph_;
     KRSpinLock paragraph_lock_;
     std::shared_ptr<kuikly::util::KRLinearGradientParser> text_linearGradient_;
@@ -133,6 +154,31 @@ class KRRichTextShadow : public IKRRenderShadowExport {
         paragraph_ = paragraph;
     }
     OH_Drawing_Typography *BuildTextTypography(double constraint_width, double constraint_height);
+    void ApplyLayoutResult(KRTextLayoutResult &&result);
+    void CacheMeasureResult(uint64_t key);
+    /**
+     * 计算与约束宽度无关的测量缓存键，无法计算时返回 0
+     */
+    uint64_t MeasureContentKey();
+    /**
+     * 页面上下文未读取时从 rootView 读取并缓存，rootView 已释放时返回 false
+     */
+    bool ResolveContextParams();
+    /**
+     * 预排版：首次测量前文本属性到达时，在后台线程按属性快照提前创建排版对象（见 KRConfig::IsParallelTextLayoutEnabled）
+     * 同一 Context 任务内的多次属性更新只在任务结束后生成一次快照
+     */
+    void ScheduleSpeculativeLayout();
+    void SnapshotSpeculativeLayout();
+    /**
+     * 首次测量时取用预排版结果，属性已变化时丢弃，约束宽度不同时在已创建的排版对象上重新排版
+     * @return 是否取得可用的排版结果
+     */
+    bool TakeSpeculativeLayout(uint64_t content_key, double constraint_width, KRTextLayoutResult &result);
+    /**
+     * 测量命中缓存时排版对象延迟创建，绘制或查询 Span 位置前调用
+     */
+    void EnsureTypography();
 
     void ReleaseLastTypography();
     /**
@@ -146,8 +192,4 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     friend class KRGradientRichTextShadow;
 };
 
-void SetCustomFontIfApplicable(NativeResourceManager *resMgr, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                               const std::string &fontFamily,
-                               const std::unordered_map<std::string, KRFontAdapter> &fontAdapters);
-
 #endif  // CORE_RENDER_OHOS_KRRICHTEXTSHADOW_H
@@ -149,8 +149,9 @@ void KRRichTextView::OnForegroundDraw(ArkUI_NodeCustomEvent *event) {
 }
 
 void KRRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                               const KRRenderCallback event_callback) {
-    if (kuikly::util::isEqual(prop_key, "click")) {
+                               const KRRenderCallback event_callback, KRPropKey prop_id) {
+    prop_id = KRResolvePropKey(prop_id, prop_key);
+    if (prop_id == KRPropKey::kClick) {
         std::weak_ptr<KRRichTextView> weakSelf = std::dynamic_pointer_cast<KRRichTextView>(shared_from_this());
         KRRenderCallback middleManCallback = [weakSelf, event_callback](KRAnyValue res) {
             auto strongSelf = weakSelf.lock();
@@ -192,8 +193,8 @@ void KRRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &pr
                 event_callback(res);
             }
         };
-        IKRRenderViewExport::ToSetProp(prop_key, prop_value, middleManCallback);
+        IKRRenderViewExport::ToSetProp(prop_key, prop_value, middleManCallback, prop_id);
     } else {
-        IKRRenderViewExport::ToSetProp(prop_key, prop_value, event_callback);
+        IKRRenderViewExport::ToSetProp(prop_key, prop_value, event_callback, prop_id);
     }
 }
@@ -42,7 +42,8 @@ class KRRichTextView : public IKRRenderViewExport {
     void SetRenderViewFrame(const KRRect &frame) override;
 
     void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                   const KRRenderCallback event_call_back = nullptr) override;
+                   const KRRenderCallback event_call_back = nullptr,
+                   KRPropKey prop_id = KRPropKey::kUnresolved) override;
 
  private:
     std::shared_ptr<KRParagraph> paragraph_;
@@ -0,0 +1,94 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRSpanOffsetIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+void KRSpanOffsetIndex::Add(int span_index, int begin, int end) {
+    entries_.push_back({span_index, begin, end});
+    boxes_typography_ = nullptr;
+}
+
+void KRSpanOffsetIndex::Clear() {
+    entries_.clear();
+    boxes_typography_ = nullptr;
+    boxes_.clear();
+    box_begin_.clear();
+    max_bottom_prefix_.clear();
+    min_top_suffix_.clear();
+}
+
+void KRSpanOffsetIndex::BuildBoxes(OH_Drawing_Typography *typography, double dpi) const {
+    const size_t count = entries_.size();
+    boxes_.clear();
+    box_begin_.assign(count + 1, 0);
+    max_bottom_prefix_.assign(count, 0);
+    min_top_suffix_.assign(count, 0);
+    std::vector<float> span_top(count, std::numeric_limits<float>::infinity());
+    float max_bottom = -std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < count; ++i) {
+        box_begin_[i] = boxes_.size();
+        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(
+            typography, entries_[i].begin, entries_[i].end, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
+        int n = OH_Drawing_GetSizeOfTextBox(box);
+        for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
+            Box rect;
+            rect.left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
+            rect.right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
+            rect.top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
+            rect.bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
+            span_top[i] = std::min(span_top[i], rect.top);
+            max_bottom = std::max(max_bottom, rect.bottom);
+            boxes_.push_back(rect);
+        }
+        OH_Drawing_TypographyDestroyTextBox(box);
+        max_bottom_prefix_[i] = max_bottom;
+    }
+    box_begin_[count] = boxes_.size();
+    float min_top = std::numeric_limits<float>::infinity();
+    for (size_t i = count; i > 0; --i) {
+        min_top = std::min(min_top, span_top[i - 1]);
+        min_top_suffix_[i - 1] = min_top;
+    }
+    boxes_typography_ = typography;
+    boxes_layout_width_ = OH_Drawing_TypographyGetMaxWidth(typography);
+}
+
+int KRSpanOffsetIndex::HitTest(OH_Drawing_Typography *typography, float x, float y, double dpi) const {
+    if (typography == nullptr || entries_.empty()) {
+        return -1;
+    }
+    // 绘制时可能按视图宽度重新排版
+    if (boxes_typography_ != typography || boxes_layout_width_ != OH_Drawing_TypographyGetMaxWidth(typography)) {
+        BuildBoxes(typography, dpi);
+    }
+    // 按偏移顺序排列的 Span 纵向位置单调，底边不超过 y 的前缀 Span 不可能命中
+    auto first = std::upper_bound(max_bottom_prefix_.begin(), max_bottom_prefix_.end(), y);
+    for (size_t i = first - max_bottom_prefix_.begin(); i < entries_.size(); ++i) {
+        if (min_top_suffix_[i] > y) {
+            break;  // 之后所有 Span 都在 y 下方
+        }
+        for (size_t boxIndex = box_begin_[i]; boxIndex < box_begin_[i + 1]; ++boxIndex) {
+            const Box &rect = boxes_[boxIndex];
+            if (x < rect.left || x >= rect.right || y < rect.top || y >= rect.bottom) {
+                continue;
+            }
+            return entries_[i].span_index;
+        }
+    }
+    return -1;
+}
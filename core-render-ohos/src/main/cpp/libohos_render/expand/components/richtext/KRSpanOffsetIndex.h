@@ -0,0 +1,73 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSPANOFFSETINDEX_H
+#define CORE_RENDER_OHOS_KRSPANOFFSETINDEX_H
+
+#include <native_drawing/drawing_text_typography.h>
+#include <cstddef>
+#include <vector>
+
+/**
+ * 文本 Span 在排版对象中的 UTF-16 偏移表，条目按偏移递增添加
+ * 命中测试首次调用时缓存各 Span 的文本框及纵向范围，之后按纵坐标二分查找候选 Span，避免逐个查询排版对象；
+ * 排版对象或排版宽度变化时缓存失效
+ * 缓存只在命中测试线程（主线程）读写
+ */
+class KRSpanOffsetIndex {
+ public:
+    struct Entry {
+        int span_index;
+        int begin;  // UTF-16 偏移，含
+        int end;    // UTF-16 偏移，不含
+    };
+
+    void Add(int span_index, int begin, int end);
+    void Clear();
+    bool Empty() const {
+        return entries_.empty();
+    }
+    size_t Size() const {
+        return entries_.size();
+    }
+
+    /**
+     * 命中测试
+     * @param typography 已排版的排版对象，需与建表时的文本一致
+     * @param x y 相对文本左上角的坐标（vp）
+     * @param dpi 排版对象像素与 vp 的换算系数
+     * @return 坐标所在 Span 的 span_index，未命中返回 -1
+     */
+    int HitTest(OH_Drawing_Typography *typography, float x, float y, double dpi) const;
+
+ private:
+    struct Box {
+        float left;
+        float top;
+        float right;
+        float bottom;
+    };
+    void BuildBoxes(OH_Drawing_Typography *typography, double dpi) const;
+
+    std::vector<Entry> entries_;
+    mutable const OH_Drawing_Typography *boxes_typography_ = nullptr;
+    mutable double boxes_layout_width_ = 0;
+    mutable std::vector<Box> boxes_;               // 所有 Span 的文本框，按 Span 顺序连续存放
+    mutable std::vector<size_t> box_begin_;        // 第 i 个 Span 的文本框为 [box_begin_[i], box_begin_[i + 1])
+    mutable std::vector<float> max_bottom_prefix_;  // 前 i + 1 个 Span 文本框底边的最大值，单调不减
+    mutable std::vector<float> min_top_suffix_;     // 第 i 个及之后 Span 文本框顶边的最小值，单调不减
+};
+
+#endif  // CORE_RENDER_OHOS_KRSPANOFFSETINDEX_H
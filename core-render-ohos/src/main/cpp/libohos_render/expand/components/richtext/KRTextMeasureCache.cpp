@@ -0,0 +1,192 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+
+#include <cstring>
+#include "libohos_render/utils/KRJSONCodec.h"
+
+namespace {
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+enum KRHashTag : uint8_t {
+    kHashTagNull = 0,
+    kHashTagNumber,
+    kHashTagString,
+    kHashTagMap,
+    kHashTagArray,
+};
+
+uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+}  // namespace
+
+KRTextMeasureCache &KRTextMeasureCache::GetInstance() {
+    static KRTextMeasureCache *instance = new KRTextMeasureCache();  // 进程级单例，不析构
+    return *instance;
+}
+
+bool KRTextMeasureCache::Get(uint64_t key, KRTextMeasureResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        miss_count_++;
+        return false;
+    }
+    hit_count_++;
+    lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+    result = it->second.result;
+    return true;
+}
+
+void KRTextMeasureCache::Put(uint64_t key, const KRTextMeasureResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        it->second.result = result;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return;
+    }
+    if (max_entries_ == 0) {
+        return;
+    }
+    lru_.push_front(key);
+    entries_[key] = Entry{result, lru_.begin()};
+    TrimToSizeLocked(max_entries_);
+}
+
+void KRTextMeasureCache::SetMaxEntries(size_t max_entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_entries_ = max_entries;
+    TrimToSizeLocked(max_entries_);
+}
+
+void KRTextMeasureCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+void KRTextMeasureCache::RecordSpeculativeLayout(SpeculativeLayoutResult result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    speculative_counts_[static_cast<size_t>(result)]++;
+}
+
+KRTextMeasureCache::Stats KRTextMeasureCache::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.hit_count = hit_count_;
+    stats.miss_count = miss_count_;
+    stats.eviction_count = eviction_count_;
+    stats.entry_count = entries_.size();
+    stats.max_entries = max_entries_;
+    stats.speculative_hit_count = speculative_counts_[static_cast<size_t>(SpeculativeLayoutResult::kHit)];
+    stats.speculative_relayout_count = speculative_counts_[static_cast<size_t>(SpeculativeLayoutResult::kRelayout)];
+    stats.speculative_miss_count = speculative_counts_[static_cast<size_t>(SpeculativeLayoutResult::kMiss)];
+    return stats;
+}
+
+std::string KRTextMeasureCache::GetStatsJson() {
+    auto stats = GetStats();
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("hitCount");
+    writer.Int(stats.hit_count);
+    writer.Key("missCount");
+    writer.Int(stats.miss_count);
+    writer.Key("evictionCount");
+    writer.Int(stats.eviction_count);
+    writer.Key("entryCount");
+    writer.Int(stats.entry_count);
+    writer.Key("maxEntries");
+    writer.Int(stats.max_entries);
+    writer.Key("speculativeHitCount");
+    writer.Int(stats.speculative_hit_count);
+    writer.Key("speculativeRelayoutCount");
+    writer.Int(stats.speculative_relayout_count);
+    writer.Key("speculativeMissCount");
+    writer.Int(stats.speculative_miss_count);
+    writer.EndObject();
+    return json;
+}
+
+uint64_t KRTextMeasureCache::HashBytes(const void *data, size_t length, uint64_t seed) {
+    uint64_t h = seed ^ kFnvOffsetBasis;
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < length; i++) {
+        h ^= bytes[i];
+        h *= kFnvPrime;
+    }
+    return Mix(h ^ length);
+}
+
+uint64_t KRTextMeasureCache::HashDouble(double value, uint64_t seed) {
+    if (value == 0) {
+        value = 0;  // 统一 -0.0 与 0.0
+    }
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return Mix(seed ^ Mix(bits + kFnvPrime));
+}
+
+uint64_t KRTextMeasureCache::HashValue(const KRRenderValue &value, uint64_t seed) {
+    if (value.isNull()) {
+        return Mix(seed ^ kHashTagNull);
+    }
+    if (value.isString()) {
+        const auto &str = value.toString();
+        return HashBytes(str.data(), str.size(), seed ^ kHashTagString);
+    }
+    if (value.isMap()) {
+        return HashMap(value.toMap(), seed);
+    }
+    if (value.isArray()) {
+        uint64_t h = seed ^ kHashTagArray;
+        for (const auto &item : value.toArray()) {
+            h = item ? HashValue(*item, h) : Mix(h + kHashTagNull);
+        }
+        return Mix(h + value.toArray().size());
+    }
+    if (value.isBool() || value.isInt() || value.isLong() || value.isFloat() || value.isDouble()) {
+        return HashDouble(value.toDouble(), seed ^ kHashTagNumber);
+    }
+    return Mix(seed ^ kHashTagNull);  // 字节数组等不参与文本排版
+}
+
+uint64_t KRTextMeasureCache::HashMap(const KRRenderValue::Map &map, uint64_t seed) {
+    // 各键值对独立哈希后求和，与 unordered_map 的遍历顺序无关
+    uint64_t sum = 0;
+    for (const auto &[key, item] : map) {
+        uint64_t h = HashBytes(key.data(), key.size(), kHashTagMap);
+        sum += item ? HashValue(*item, h) : Mix(h);
+    }
+    return Mix(seed ^ kHashTagMap ^ Mix(sum + map.size()));
+}
+
+void KRTextMeasureCache::TrimToSizeLocked(size_t max_entries) {
+    while (entries_.size() > max_entries && !lru_.empty()) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+        eviction_count_++;
+    }
+}
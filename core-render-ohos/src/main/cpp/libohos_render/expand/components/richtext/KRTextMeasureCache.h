@@ -0,0 +1,111 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+#define CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+
+#include <native_drawing/drawing_text_typography.h>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "libohos_render/foundation/KRSize.h"
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+/**
+ * 文本测量结果：尺寸与绘制偏移，不含排版对象
+ */
+struct KRTextMeasureResult {
+    KRSize size;
+    float draw_offset_y = 0;
+    OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
+};
+
+/**
+ * 进程级文本测量缓存：按 span 内容、样式属性、字体缩放、dpi 与约束宽度的哈希缓存测量结果，以 LRU 淘汰
+ */
+class KRTextMeasureCache {
+ public:
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t eviction_count = 0;
+        size_t entry_count = 0;
+        size_t max_entries = 0;
+        uint64_t speculative_hit_count = 0;
+        uint64_t speculative_relayout_count = 0;
+        uint64_t speculative_miss_count = 0;
+    };
+
+    enum class SpeculativeLayoutResult {
+        kHit,       // 预排版结果直接可用
+        kRelayout,  // 约束宽度不同，复用排版对象重新排版
+        kMiss,      // 属性已变化，丢弃
+    };
+
+    static KRTextMeasureCache &GetInstance();
+
+    bool Get(uint64_t key, KRTextMeasureResult &result);
+    void Put(uint64_t key, const KRTextMeasureResult &result);
+
+    /**
+     * 设置缓存条目上限，超出部分立即淘汰
+     */
+    void SetMaxEntries(size_t max_entries);
+
+    void Clear();
+
+    /**
+     * 记录文本预排版结果的使用情况
+     */
+    void RecordSpeculativeLayout(SpeculativeLayoutResult result);
+
+    Stats GetStats();
+
+    /**
+     * 统计数据的 JSON 字符串，用于性能数据上报
+     */
+    std::string GetStatsJson();
+
+    /**
+     * 计算属性值的稳定哈希：Map 与键的遍历顺序无关，数值按 double 归一
+     */
+    static uint64_t HashValue(const KRRenderValue &value, uint64_t seed);
+    static uint64_t HashMap(const KRRenderValue::Map &map, uint64_t seed);
+    static uint64_t HashBytes(const void *data, size_t length, uint64_t seed);
+    static uint64_t HashDouble(double value, uint64_t seed);
+
+ private:
+    struct Entry {
+        KRTextMeasureResult result;
+        std::list<uint64_t>::iterator lru_it;
+    };
+
+    KRTextMeasureCache() = default;
+    void TrimToSizeLocked(size_t max_entries);
+
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, Entry> entries_;
+    std::list<uint64_t> lru_;  // 头部为最近使用
+    size_t max_entries_ = 512;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t eviction_count_ = 0;
+    uint64_t speculative_counts_[3] = {};
+};
+
+#endif  // CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
@@ -49,6 +49,7 @@ KRSize KRGradientRichTextShadow::CalculateRenderViewSize(double constraint_width
     }
     calculate_width_ = size.width;
     calculate_height_ = size.height;
+    ReleaseLastTypography();  // 渐变依赖测量尺寸，需按尺寸重新创建排版对象，不复用上次结果
     KRRichTextShadow::CalculateRenderViewSize(constraint_width, constraint_height);
     return size;
 }
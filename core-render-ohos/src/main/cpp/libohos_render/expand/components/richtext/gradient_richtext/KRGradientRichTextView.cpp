@@ -15,11 +15,11 @@
 
 #include "libohos_render/expand/components/richtext/gradient_richtext/KRGradientRichTextView.h"
 
-const char *tBackgroundImage = "backgroundImage";
 void KRGradientRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                                       const KRRenderCallback event_call_back) {
-    if (strcmp(prop_key.c_str(), tBackgroundImage) == 0) {
+                                       const KRRenderCallback event_call_back, KRPropKey prop_id) {
+    prop_id = KRResolvePropKey(prop_id, prop_key);
+    if (prop_id == KRPropKey::kBackgroundImage) {
         return;
     }
-    KRRichTextView::ToSetProp(prop_key, prop_value, event_call_back);
+    KRRichTextView::ToSetProp(prop_key, prop_value, event_call_back, prop_id);
 }
@@ -18,7 +18,7 @@
 #include "libohos_render/expand/components/richtext/KRRichTextView.h"
 class KRGradientRichTextView : public KRRichTextView {
     void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                   const KRRenderCallback event_call_back) override;
+                   const KRRenderCallback event_call_back, KRPropKey prop_id) override;
 };
 
 #endif  // CORE_RENDER_OHOS_KRGRADIENTRICHTEXTVIEW_H
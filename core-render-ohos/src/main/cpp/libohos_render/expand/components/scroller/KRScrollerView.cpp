@@ -29,24 +29,9 @@ extern void* OH_ArkUI_GestureInterrupter_GetUserData(ArkUI_GestureInterruptInfo*
 };
 #endif
 
-constexpr char kPropNameDirectionRow[] = "directionRow";
-constexpr char kPropNamePagingEnabled[] = "pagingEnabled";
-constexpr char kPropNameScrollEnabled[] = "scrollEnabled";
-constexpr char kPropNameVerticalBounces[] = "verticalbounces";
-constexpr char kPropNameHorizontalBounces[] = "horizontalbounces";
-constexpr char kPropNameBouncesEnable[] = "bouncesEnable";
-constexpr char kPropNameLimitHeaderBounces[] = "limitHeaderBounces";
-constexpr char kPropNameShowScrollerIndicator[] = "showScrollerIndicator";
-constexpr char kPropNameNestedScroll[] = "nestedScroll";
-constexpr char kPropNameFlingEnable[] = "flingEnable";
 constexpr char kPropKeyNestedScrollForward[] = "forward";
 constexpr char kPropKeyNestedScrollBackward[] = "backward";
 
-constexpr char kEventNameScroll[] = "scroll";
-constexpr char kEventNameDragBegin[] = "dragBegin";
-constexpr char kEventNameWillDragEnd[] = "willDragEnd";
-constexpr char kEventNameDragEnd[] = "dragEnd";
-constexpr char kEventNameScrollEnd[] = "scrollEnd";
 constexpr char kEventKeyOffsetX[] = "offsetX";
 constexpr char kEventKeyOffsetY[] = "offsetY";
 constexpr char kEventKeyContentWidth[] = "contentWidth";
@@ -123,13 +108,6 @@ void KRScrollerContentView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEven
     }
 }
 
-bool isBouncesEnableProp(const std::string &prop_key) {
-    auto prop_key_c_str = prop_key.c_str();
-    return std::strcmp(prop_key_c_str, kPropNameVerticalBounces) == 0 ||
-           std::strcmp(prop_key_c_str, kPropNameHorizontalBounces) == 0 ||
-           std::strcmp(prop_key_c_str, kPropNameBouncesEnable) == 0;
-}
-
 void KRScrollerView::SetRenderViewFrame(const KRRect &frame) {
     IKRRenderViewExport::SetRenderViewFrame(frame);
     if (!is_set_frame_) {
@@ -164,35 +142,38 @@ void KRScrollerView::DidInit() {
 
 bool KRScrollerView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                              const KRRenderCallback event_call_back) {
-    auto didHanded = false;
-    if (std::strcmp(prop_key.c_str(), kPropNameDirectionRow) == 0) {
-        didHanded = SetScrollDirection(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePagingEnabled) == 0) {
-        didHanded = SetPagingEnabled(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kEventNameScroll) == 0) {
-        didHanded = RegisterOnScrollEvent(event_call_back);
-    } else if (std::strcmp(prop_key.c_str(), kPropNameScrollEnabled) == 0) {
-        didHanded = SetScrollEnabled(prop_value);
-    } else if (isBouncesEnableProp(prop_key)) {
-        didHanded = SetBouncesEnable(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kPropNameShowScrollerIndicator) == 0) {
-        didHanded = SetShowScrollerIndicator(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameDragBegin)) {
-        didHanded = RegisterOnDragBeginEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameDragEnd)) {
-        didHanded = RegisterOnDragEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameScrollEnd)) {
-        didHanded = RegisterOnScrollEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameWillDragEnd)) {
-        didHanded = RegisterWillDragEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameLimitHeaderBounces)) {
-        didHanded = SetLimitHeaderBounces(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameNestedScroll)) {
-        didHanded = SetNestedScroll(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameFlingEnable)) {
-        didHanded = SetFlingEnable(prop_value->toBool());
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kDirectionRow:
+        return SetScrollDirection(prop_value);
+    case KRPropKey::kPagingEnabled:
+        return SetPagingEnabled(prop_value);
+    case KRPropKey::kScroll:
+        return RegisterOnScrollEvent(event_call_back);
+    case KRPropKey::kScrollEnabled:
+        return SetScrollEnabled(prop_value);
+    case KRPropKey::kVerticalBounces:
+    case KRPropKey::kHorizontalBounces:
+    case KRPropKey::kBouncesEnable:
+        return SetBouncesEnable(prop_value);
+    case KRPropKey::kShowScrollerIndicator:
+        return SetShowScrollerIndicator(prop_value);
+    case KRPropKey::kDragBegin:
+        return RegisterOnDragBeginEvent(event_call_back);
+    case KRPropKey::kDragEnd:
+        return RegisterOnDragEndEvent(event_call_back);
+    case KRPropKey::kScrollEnd:
+        return RegisterOnScrollEndEvent(event_call_back);
+    case KRPropKey::kWillDragEnd:
+        return RegisterWillDragEndEvent(event_call_back);
+    case KRPropKey::kLimitHeaderBounces:
+        return SetLimitHeaderBounces(prop_value);
+    case KRPropKey::kNestedScroll:
+        return SetNestedScroll(prop_value);
+    case KRPropKey::kFlingEnable:
+        return SetFlingEnable(prop_value->toBool());
+    default:
+        return false;
     }
-    return didHanded;
 }
 
 bool KRScrollerView::ResetProp(const std::string &prop_key) {
@@ -203,10 +184,11 @@ bool KRScrollerView::ResetProp(const std::string &prop_key) {
     first_animate_ = false;
     auto didHanded = IKRRenderViewExport::ResetProp(prop_key);
     if (!didHanded) {
-        if (prop_key == kPropNameNestedScroll) {
+        auto prop_id = PropIdOf(prop_key);
+        if (prop_id == KRPropKey::kNestedScroll) {
             didHanded = true;
             kuikly::util::ResetArkUINestedScroll(GetNode());
-        } else if (prop_key == kPropNameFlingEnable) {
+        } else if (prop_id == KRPropKey::kFlingEnable) {
             didHanded = true;
             SetFlingEnable(true);
         }
@@ -19,14 +19,6 @@
 
 #define NS_PER_MS 1000000
 
-constexpr char kPropNameTouchDown[] = "touchDown";
-constexpr char kPropNameTouchMove[] = "touchMove";
-constexpr char kPropNameTouchUp[] = "touchUp";
-constexpr char kPropNameTouchCancel[] = "touchCancel";
-constexpr char kPropNamePreventTouch[] = "preventTouch";
-constexpr char kPropNameSuperTouch[] = "superTouch";
-constexpr char kPropNameHitTestModeOhos[] = "hit-test-ohos";
-
 constexpr char kOhosHitTestModeDefault[] = "default";
 constexpr char kOhosHitTestModeBlock[] = "block";
 constexpr char kOhosHitTestModeNone[] = "none";
@@ -44,18 +36,23 @@ void KRView::WillReuse() {
 bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                      const KRRenderCallback event_call_back) {
     auto didHand = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kTouchDown:
         didHand = RegisterTouchDownEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
+        break;
+    case KRPropKey::kTouchMove:
         didHand = RegisterTouchMoveEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
+        break;
+    case KRPropKey::kTouchUp:
         didHand = RegisterTouchUpEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
+        break;
+    case KRPropKey::kPreventTouch:
         if (super_touch_handler_) {
             super_touch_handler_->PreventTouch(prop_value->toBool());
         }
         didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
+        break;
+    case KRPropKey::kSuperTouch:
         if (prop_value->toBool()) {
             if (!super_touch_handler_) {
                 super_touch_handler_ = std::make_shared<SuperTouchHandler>();
@@ -66,8 +63,12 @@ bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
             }
         }
         didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
+        break;
+    case KRPropKey::kHitTestModeOhos:
         didHand = SetTargetHitTestMode(prop_value->toString());
+        break;
+    default:
+        break;
     }
     return didHand;
 }
@@ -89,27 +90,35 @@ void KRView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_ty
 bool KRView::ResetProp(const std::string &prop_key) {
     auto didHande = false;
     register_touch_event_ = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
+    switch (PropIdOf(prop_key)) {
+    case KRPropKey::kTouchDown:
         touch_down_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
+        break;
+    case KRPropKey::kTouchMove:
         touch_move_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
+        break;
+    case KRPropKey::kTouchUp:
         touch_up_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
-        // reset handled by kPropNameSuperTouch, do nothing here
+        break;
+    case KRPropKey::kPreventTouch:
+        // reset handled by kSuperTouch, do nothing here
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
+        break;
+    case KRPropKey::kSuperTouch:
         super_touch_handler_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
+        break;
+    case KRPropKey::kHitTestModeOhos:
         target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
         UpdateHitTestMode(HasBaseEvent() || HasTouchEvent());
         didHande = true;
-    } else {
+        break;
+    default:
         didHande = IKRRenderViewExport::ResetProp(prop_key);
+        break;
     }
     return didHande;
 }
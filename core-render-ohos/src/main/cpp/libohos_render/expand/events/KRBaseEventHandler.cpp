@@ -17,17 +17,11 @@
 
 #include <arkui/native_node.h>
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
-constexpr char kClickEventName[] = "click";
-constexpr char kDoubleClickEventName[] = "doubleClick";
-constexpr char kLongPressEventName[] = "longPress";
-constexpr char kPanEventName[] = "pan";
-constexpr char kPinchEventName[] = "pinch";
-constexpr char kCaptureAttrName[] = "capture";
-
 constexpr char kParamKeyX[] = "x";
 constexpr char kParamKeyY[] = "y";
 constexpr char kParamKeyPageX[] = "pageX";
@@ -40,24 +34,28 @@ constexpr char kParamKeyScale[] = "scale";
 KRBaseEventHandler::KRBaseEventHandler(const std::shared_ptr<KRConfig> &kr_config) : kr_config_(kr_config) {}
 
 bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back) {
-    auto didHanded = false;
+                                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back,
+                                 KRPropKey prop_id) {
+    auto key = KRResolvePropKey(prop_id, prop_key);
     if (event_call_back != nullptr) {
-        if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-            didHanded = RegisterOnClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-            didHanded = RegisterOnDoubleClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-            didHanded = RegisterOnLongPress(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-            didHanded = RegisterOnPan(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-            didHanded = RegisterOnPinch(view_export, event_call_back);
+        switch (key) {
+        case KRPropKey::kClick:
+            return RegisterOnClick(view_export, event_call_back);
+        case KRPropKey::kDoubleClick:
+            return RegisterOnDoubleClick(view_export, event_call_back);
+        case KRPropKey::kLongPress:
+            return RegisterOnLongPress(view_export, event_call_back);
+        case KRPropKey::kPan:
+            return RegisterOnPan(view_export, event_call_back);
+        case KRPropKey::kPinch:
+            return RegisterOnPinch(view_export, event_call_back);
+        default:
+            return false;
         }
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
-        didHanded = SetCaptureRule(view_export, prop_value->toString());
+    } else if (key == KRPropKey::kCapture) {
+        return SetCaptureRule(view_export, prop_value->toString());
     }
-    return didHanded;
+    return false;
 }
 
 bool KRBaseEventHandler::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) {
@@ -85,29 +83,30 @@ bool KRBaseEventHandler::OnGestureEvent(const std::shared_ptr<KRGestureEventData
     return didHanded;
 }
 
-bool KRBaseEventHandler::ResetProp(const std::string &prop_key) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kClickEventName)) {
+bool KRBaseEventHandler::ResetProp(const std::string &prop_key, KRPropKey prop_id) {
+    switch (KRResolvePropKey(prop_id, prop_key)) {
+    case KRPropKey::kClick:
         click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
+        return true;
+    case KRPropKey::kDoubleClick:
         double_click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
+        return true;
+    case KRPropKey::kLongPress:
         long_press_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
+        return true;
+    case KRPropKey::kPan:
         pan_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
+        return true;
+    case KRPropKey::kPinch:
         pinch_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
+        return true;
+    case KRPropKey::kCapture:
         // KREventDispatchCenter has reset by view_export->UnregisterEvent()
         has_capture_rule_ = false;
-        didHanded = true;
+        return true;
+    default:
+        return false;
     }
-    return didHanded;
 }
 
 void KRBaseEventHandler::OnDestroy() {
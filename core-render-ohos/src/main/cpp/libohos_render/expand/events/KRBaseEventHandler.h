@@ -20,6 +20,7 @@
 #include <string>
 #include "gesture/KRGestueEventType.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -33,12 +34,13 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     KRBaseEventHandler &operator=(const KRBaseEventHandler &&) = delete;
 
     virtual bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr);
+                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr,
+                 KRPropKey prop_id = KRPropKey::kUnresolved);
     virtual bool OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type);
     virtual bool OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeCustomEventType &event_type);
     virtual bool OnGestureEvent(const std::shared_ptr<KRGestureEventData> &gesture_event_data,
                         const KRGestureEventType &event_type);
-    virtual bool ResetProp(const std::string &prop_key);
+    virtual bool ResetProp(const std::string &prop_key, KRPropKey prop_id = KRPropKey::kUnresolved);
     virtual void OnDestroy();
     // 是否含有手势事件监听
     virtual bool HasTouchEvent();
@@ -83,7 +85,8 @@ class KRArkTSBaseEventHandler : public KRBaseEventHandler {
             // blank
     }
     bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr) override {
+                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr,
+                 KRPropKey prop_id = KRPropKey::kUnresolved) override {
         return false;
     }
     bool OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) override {
@@ -96,7 +99,7 @@ class KRArkTSBaseEventHandler : public KRBaseEventHandler {
                         const KRGestureEventType &event_type) override {
         return false;
     }
-    bool ResetProp(const std::string &prop_key) override {
+    bool ResetProp(const std::string &prop_key, KRPropKey prop_id = KRPropKey::kUnresolved) override {
         return false;
     }
     void OnDestroy() override {
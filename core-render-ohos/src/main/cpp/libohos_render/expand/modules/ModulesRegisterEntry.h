@@ -25,6 +25,7 @@
 #include "libohos_render/expand/modules/network/KRNetworkModule.h"
 #include "libohos_render/expand/modules/performance/KRPerformanceModule.h"
 #include "libohos_render/expand/modules/preferences/KRSharedPreferencesModule.h"
+#include "libohos_render/expand/modules/vsync/KRVsyncModule.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 
 #endif  // CORE_RENDER_OHOS_MODULESREGISTERENTRY_H
@@ -60,4 +61,8 @@ static void ModulesRegisterEntry() {
         return std::make_shared<kuikly::module::KRBackPressModule>();
     });
 
+    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRVsyncModule::MODULE_NAME, [] {
+        return std::make_shared<kuikly::module::KRVsyncModule>();
+    });
+
 }
\ No newline at end of file
@@ -0,0 +1,223 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/modules/cache/KRImageMemoryCache.h"
+
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/utils/KRJSONCodec.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Remove this declaration if compatable api is raised to 18 and above
+extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
+#ifdef __cplusplus
+};
+#endif
+
+constexpr int kMemoryLevelModerate = 0;  // AbilityConstant.MemoryLevel.MEMORY_LEVEL_MODERATE
+
+KRPixelmapRef::KRPixelmapRef(OH_PixelmapNative *pixelmap) : pixelmap_(pixelmap) {
+    uint32_t row_stride = 0;
+    OH_Pixelmap_ImageInfo *info;
+    if (OH_PixelmapImageInfo_Create(&info) == IMAGE_SUCCESS) {
+        if (OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS) {
+            OH_PixelmapImageInfo_GetWidth(info, &width_);
+            OH_PixelmapImageInfo_GetHeight(info, &height_);
+            OH_PixelmapImageInfo_GetRowStride(info, &row_stride);
+        }
+        OH_PixelmapImageInfo_Release(info);
+    }
+    if (row_stride == 0) {
+        row_stride = width_ * 4;
+    }
+    byte_count_ = static_cast<size_t>(row_stride) * height_;
+}
+
+KRPixelmapRef::~KRPixelmapRef() {
+    if (OH_PixelmapNative_Destroy) {
+        OH_PixelmapNative_Destroy(&pixelmap_);
+    } else {
+        OH_PixelmapNative_Release(pixelmap_);
+    }
+}
+
+KRImageMemoryCache &KRImageMemoryCache::GetInstance() {
+    static KRImageMemoryCache *instance = new KRImageMemoryCache();  // 进程级单例，不析构
+    return *instance;
+}
+
+std::shared_ptr<KRPixelmapRef> KRImageMemoryCache::Get(const std::string &key, bool record_hit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto ref = FindLocked(key);
+    if (ref && record_hit) {
+        hit_count_++;
+    }
+    return ref;
+}
+
+std::shared_ptr<KRPixelmapRef> KRImageMemoryCache::LoadSync(const std::string &key, const Loader &loader) {
+    std::shared_ptr<InFlightLoad> load;
+    bool waiting = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto ref = FindLocked(key)) {
+            hit_count_++;
+            return ref;
+        }
+        auto it = in_flight_.find(key);
+        if (it != in_flight_.end()) {
+            dedup_count_++;
+            load = it->second;
+            waiting = true;
+        } else {
+            miss_count_++;
+            load = std::make_shared<InFlightLoad>();
+            load->future = load->promise.get_future().share();
+            in_flight_[key] = load;
+        }
+    }
+    if (waiting) {
+        return load->future.get();
+    }
+    return RunLoad(key, load, loader);
+}
+
+void KRImageMemoryCache::LoadAsync(const std::string &key, Loader loader, Completion completion) {
+    std::shared_ptr<KRPixelmapRef> ref;
+    std::shared_ptr<InFlightLoad> load;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ref = FindLocked(key);
+        if (ref) {
+            hit_count_++;
+        } else {
+            auto it = in_flight_.find(key);
+            if (it != in_flight_.end()) {
+                dedup_count_++;
+                it->second->completions.push_back(std::move(completion));
+                return;
+            }
+            miss_count_++;
+            load = std::make_shared<InFlightLoad>();
+            load->future = load->promise.get_future().share();
+            load->completions.push_back(std::move(completion));
+            in_flight_[key] = load;
+        }
+    }
+    if (ref) {
+        completion(ref);
+        return;
+    }
+    // cacheImage 为业务预加载，优先级低于可见内容的解码
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [key, load, loader = std::move(loader)] { KRImageMemoryCache::GetInstance().RunLoad(key, load, loader); },
+        KRQoS::kUtility);
+}
+
+std::shared_ptr<KRPixelmapRef> KRImageMemoryCache::RunLoad(const std::string &key,
+                                                           const std::shared_ptr<InFlightLoad> &load,
+                                                           const Loader &loader) {
+    OH_PixelmapNative *pixelmap = loader ? loader() : nullptr;
+    std::shared_ptr<KRPixelmapRef> ref = pixelmap ? std::make_shared<KRPixelmapRef>(pixelmap) : nullptr;
+    std::vector<Completion> completions;
+    std::vector<std::shared_ptr<KRPixelmapRef>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_.erase(key);
+        completions.swap(load->completions);
+        if (ref) {
+            cache_.Put(key, ref, ref->ByteCount(), evicted);  // 超过总容量的图片不缓存，仅交给请求方持有
+        }
+    }
+    load->promise.set_value(ref);
+    for (const auto &completion : completions) {
+        completion(ref);
+    }
+    return ref;
+}
+
+void KRImageMemoryCache::Remove(const std::string &key) {
+    std::vector<std::shared_ptr<KRPixelmapRef>> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.Remove(key, evicted);
+}
+
+void KRImageMemoryCache::SetMaxBytes(size_t max_bytes) {
+    std::vector<std::shared_ptr<KRPixelmapRef>> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.SetMaxBytes(max_bytes, evicted);
+}
+
+void KRImageMemoryCache::TrimToSize(size_t max_bytes) {
+    std::vector<std::shared_ptr<KRPixelmapRef>> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.TrimToSize(max_bytes, evicted);
+}
+
+void KRImageMemoryCache::OnMemoryLevel(int level) {
+    size_t max_bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_bytes = level <= kMemoryLevelModerate ? cache_.MaxBytes() / 2 : 0;
+    }
+    KR_LOG_INFO << "KRImageMemoryCache trim on memory level: " << level << ", trim to: " << max_bytes;
+    TrimToSize(max_bytes);
+}
+
+KRImageMemoryCache::Stats KRImageMemoryCache::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.hit_count = hit_count_;
+    stats.miss_count = miss_count_;
+    stats.dedup_count = dedup_count_;
+    stats.eviction_count = cache_.EvictionCount();
+    stats.entry_count = cache_.Size();
+    stats.total_bytes = cache_.TotalBytes();
+    stats.max_bytes = cache_.MaxBytes();
+    return stats;
+}
+
+std::string KRImageMemoryCache::GetStatsJson() {
+    auto stats = GetStats();
+    uint64_t request_count = stats.hit_count + stats.miss_count + stats.dedup_count;
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("hitCount");
+    writer.Int(stats.hit_count);
+    writer.Key("missCount");
+    writer.Int(stats.miss_count);
+    writer.Key("dedupCount");
+    writer.Int(stats.dedup_count);
+    writer.Key("hitRate");
+    writer.Double(request_count ? static_cast<double>(stats.hit_count) / request_count : 0);
+    writer.Key("evictionCount");
+    writer.Int(stats.eviction_count);
+    writer.Key("entryCount");
+    writer.Int(stats.entry_count);
+    writer.Key("totalBytes");
+    writer.Int(stats.total_bytes);
+    writer.Key("maxBytes");
+    writer.Int(stats.max_bytes);
+    writer.EndObject();
+    return json;
+}
+
+std::shared_ptr<KRPixelmapRef> KRImageMemoryCache::FindLocked(const std::string &key) {
+    auto ref = cache_.Get(key);
+    return ref ? *ref : nullptr;
+}
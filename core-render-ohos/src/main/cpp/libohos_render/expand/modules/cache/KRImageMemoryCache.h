@@ -0,0 +1,141 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRIMAGEMEMORYCACHE_H
+#define CORE_RENDER_OHOS_KRIMAGEMEMORYCACHE_H
+
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/utils/KRLruCache.h"
+
+/**
+ * 共享的 pixelmap，最后一个持有者释放时销毁
+ */
+class KRPixelmapRef {
+ public:
+    explicit KRPixelmapRef(OH_PixelmapNative *pixelmap);
+    ~KRPixelmapRef();
+    KRPixelmapRef(const KRPixelmapRef &) = delete;
+    KRPixelmapRef &operator=(const KRPixelmapRef &) = delete;
+
+    OH_PixelmapNative *Pixelmap() const {
+        return pixelmap_;
+    }
+    uint32_t Width() const {
+        return width_;
+    }
+    uint32_t Height() const {
+        return height_;
+    }
+    size_t ByteCount() const {
+        return byte_count_;
+    }
+
+ private:
+    OH_PixelmapNative *pixelmap_ = nullptr;
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    size_t byte_count_ = 0;
+};
+
+/**
+ * 进程级图片内存缓存，各页面的 KRMemoryCacheModule 共享：
+ * 按 pixelmap 字节数以 LRU 淘汰；同一 key 并发加载只解码一次
+ */
+class KRImageMemoryCache {
+ public:
+    using Loader = std::function<OH_PixelmapNative *()>;
+    using Completion = std::function<void(const std::shared_ptr<KRPixelmapRef> &)>;
+
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t dedup_count = 0;  // 合并到进行中加载的请求数
+        uint64_t eviction_count = 0;
+        size_t entry_count = 0;
+        size_t total_bytes = 0;
+        size_t max_bytes = 0;
+    };
+
+    static KRImageMemoryCache &GetInstance();
+
+    /**
+     * 仅查询缓存，不触发加载
+     * @param record_hit 命中时是否计入命中统计
+     */
+    std::shared_ptr<KRPixelmapRef> Get(const std::string &key, bool record_hit = false);
+
+    /**
+     * 同步加载：命中缓存直接返回；同 key 正在加载时等待其结果；否则在当前线程执行 loader
+     */
+    std::shared_ptr<KRPixelmapRef> LoadSync(const std::string &key, const Loader &loader);
+
+    /**
+     * 异步加载：命中缓存时立即回调；否则在后台线程执行 loader，completion 在加载线程回调
+     */
+    void LoadAsync(const std::string &key, Loader loader, Completion completion);
+
+    void Remove(const std::string &key);
+
+    /**
+     * 设置缓存容量上限（字节），超出部分立即淘汰
+     */
+    void SetMaxBytes(size_t max_bytes);
+
+    /**
+     * 淘汰最久未使用的条目直至总容量不超过 max_bytes
+     */
+    void TrimToSize(size_t max_bytes);
+
+    /**
+     * 系统内存告警回调，level 取值同 AbilityConstant.MemoryLevel
+     */
+    void OnMemoryLevel(int level);
+
+    Stats GetStats();
+
+    /**
+     * 统计数据的 JSON 字符串，用于性能数据上报
+     */
+    std::string GetStatsJson();
+
+ private:
+    struct InFlightLoad {
+        std::promise<std::shared_ptr<KRPixelmapRef>> promise;
+        std::shared_future<std::shared_ptr<KRPixelmapRef>> future;
+        std::vector<Completion> completions;
+    };
+
+    KRImageMemoryCache() = default;
+    std::shared_ptr<KRPixelmapRef> FindLocked(const std::string &key);
+    std::shared_ptr<KRPixelmapRef> RunLoad(const std::string &key, const std::shared_ptr<InFlightLoad> &load,
+                                           const Loader &loader);
+
+    std::mutex mutex_;
+    KRLruCache<std::string, std::shared_ptr<KRPixelmapRef>> cache_{64 * 1024 * 1024};
+    std::unordered_map<std::string, std::shared_ptr<InFlightLoad>> in_flight_;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t dedup_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRIMAGEMEMORYCACHE_H
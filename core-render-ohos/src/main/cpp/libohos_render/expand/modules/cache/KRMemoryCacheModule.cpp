@@ -17,21 +17,13 @@
 #include "libohos_render/expand/components/image/KRImageView.h"
 #include "libohos_render/expand/modules/codec/KRCodec.h"
 #include "libohos_render/expand/modules/network/KRNetworkModule.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRURIHelper.h"
 #include <cstdint>
 #include <multimedia/image_framework/image/image_source_native.h>
 #include <multimedia/image_framework/image/pixelmap_native.h>
 #include <shared_mutex>
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-// Remove this declaration if compatable api is raised to 18 and above
-extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
-#ifdef __cplusplus
-};
-#endif
-
 constexpr char kMethodNameSetObject[] = "setObject";
 constexpr char kMethodNameCacheImage[] = "cacheImage";
 constexpr char kParamNameKey[] = "key";
@@ -68,13 +60,20 @@ KRAnyValue KRMemoryCacheModule::Get(const std::string &key) {
 }
 
 OH_PixelmapNative *KRMemoryCacheModule::GetImage(const std::string &key) {
-    std::shared_lock<std::shared_mutex> lock(mtx_);
-    auto it = image_cache_map_.find(key);
-    if (it == image_cache_map_.end()) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx_);
+        auto it = image_refs_.find(key);
+        if (it != image_refs_.end()) {
+            return it->second->Pixelmap();
+        }
+    }
+    // 其他页面已缓存的图片
+    auto image = KRImageMemoryCache::GetInstance().Get(key);
+    if (!image) {
         return nullptr;
-    } else {
-        return it->second;
     }
+    HoldImage(key, image);
+    return image->Pixelmap();
 }
 
 KRAnyValue KRMemoryCacheModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
@@ -94,33 +93,26 @@ KRAnyValue KRMemoryCacheModule::SetObject(const KRAnyValue &params) {
     auto value = map[kParamNameValue];
     cache_map_[key] = value;
 
-    bool found = false;
+    std::shared_ptr<KRPixelmapRef> image;
     {
-        std::shared_lock<std::shared_mutex> lock(mtx_);
-        found = image_cache_map_.find(key) != image_cache_map_.end();
-    }
-    if (found) {
-        OH_PixelmapNative *pixelmap = nullptr;
-        {
-            std::unique_lock<std::shared_mutex> lock(mtx_);
-            auto it = image_cache_map_.find(key);
-            if (it != image_cache_map_.end()) {
-                pixelmap = it->second;
-                image_cache_map_.erase(it);
-            }
-        }
-        if (pixelmap) {
-            ReleasePixelmap(pixelmap);
+        std::unique_lock<std::shared_mutex> lock(mtx_);
+        auto it = image_refs_.find(key);
+        if (it != image_refs_.end()) {
+            image = std::move(it->second);
+            image_refs_.erase(it);
         }
     }
+    if (image) {
+        KRImageMemoryCache::GetInstance().Remove(key);
+    }
 
     return KREmptyValue();
 }
 
-OH_PixelmapNative *KRMemoryCacheModule::LoadPixelmapFromLocal(std::string &src) {
+OH_PixelmapNative *KRMemoryCacheModule::LoadPixelmapFromLocal(const std::string &src) {
     OH_PixelmapNative *pixelmap = nullptr;
     OH_ImageSourceNative *source;
-    auto code = OH_ImageSourceNative_CreateFromUri(src.data(), src.length(), &source);
+    auto code = OH_ImageSourceNative_CreateFromUri(const_cast<char *>(src.data()), src.length(), &source);
     if (code == IMAGE_SUCCESS) {
         // 通过图片解码参数创建PixelMap对象
         OH_DecodingOptions *ops;
@@ -143,10 +135,11 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     auto src = map[kParamNameSrc]->toString();
     auto cache_key = GenerateCacheKey(src);
 
-    OH_PixelmapNative *pixelmap = GetImage(cache_key);
-    if (pixelmap) {
+    auto &image_cache = KRImageMemoryCache::GetInstance();
+    if (auto image = image_cache.Get(cache_key, true)) {
         // already cached, return directly
-        auto result = GenerateResult(cache_key, pixelmap);
+        HoldImage(cache_key, image);
+        auto result = GenerateResult(cache_key, image);
         if (callback) {
             callback(NewKRRenderValue(result));
         }
@@ -164,25 +157,30 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
         }
     }
     if (!isNetwork(src)) {
-        pixelmap = LoadPixelmapFromLocal(src);
-        if (pixelmap) {
-            SetImage(cache_key, pixelmap);
-            auto result = GenerateResult(cache_key, pixelmap);
-            if (callback) {
-                callback(NewKRRenderValue(result));
-            }
-            return NewKRRenderValue(std::move(result));
+        auto loader = [src] { return LoadPixelmapFromLocal(src); };
+        auto sync_it = map.find(kParamNameSync);
+        bool sync = sync_it != map.end() && sync_it->second && sync_it->second->toInt() == 1;
+        if (!sync) {
+            LoadImageAsync(cache_key, loader, callback);
+            KRRenderValueMap result;
+            result[kStatusKeyState] = NewKRRenderValue(kCacheStateInProgress);
+            result[kStatusKeyErrorCode] = NewKRRenderValue(0);
+            result[kStatusKeyErrorMsg] = NewKRRenderValue("loading async");
+            return NewKRRenderValue(result);
+        }
+        KRRenderValueMap result;
+        if (auto image = image_cache.LoadSync(cache_key, loader)) {
+            HoldImage(cache_key, image);
+            result = GenerateResult(cache_key, image);
         } else {
-            KRRenderValueMap result = GenerateError(-1, "failed to load image from local: invalid src");
-            if (callback) {
-                callback(NewKRRenderValue(result));
-            }
-            return NewKRRenderValue(std::move(result));
+            result = GenerateError(-1, "failed to load image from local: invalid src");
         }
+        if (callback) {
+            callback(NewKRRenderValue(result));
+        }
+        return NewKRRenderValue(std::move(result));
     }
 
-    // auto sync = map[kParamNameSync]->toBool(); // FIXME: sync mode is not supported yet
-
     const auto &rootView = GetRootView().lock();
     if (rootView) {
         auto network_module = std::dynamic_pointer_cast<KRNetworkModule>(rootView->GetModuleOrCreate(kNetworkModuleName));
@@ -195,21 +193,15 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
                 } else {
                     return;
                 }
-                OH_PixelmapNative *pixelmap = nullptr;
-                if (res) {
-                    auto filePath = res->toString();
-                    pixelmap = module_self->LoadPixelmapFromLocal(filePath);
-                }
-                KRRenderValueMap result;
-                if (pixelmap) {
-                    module_self->SetImage(cache_key, pixelmap);
-                    result = module_self->GenerateResult(cache_key, pixelmap);
-                } else {
-                    result = module_self->GenerateError(-1, "fetch failed");
-                }
-                if (callback) {
-                    callback(NewKRRenderValue(result));
+                std::string file_path = res ? res->toString() : "";
+                if (file_path.empty()) {
+                    if (callback) {
+                        callback(NewKRRenderValue(module_self->GenerateError(-1, "fetch failed")));
+                    }
+                    return;
                 }
+                module_self->LoadImageAsync(cache_key, [file_path] { return LoadPixelmapFromLocal(file_path); },
+                                            callback);
             });
             KRRenderValueMap result;
             result[kStatusKeyState] = NewKRRenderValue(kCacheStateInProgress);
@@ -225,19 +217,36 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     return NewKRRenderValue(std::move(result));
 }
 
-void KRMemoryCacheModule::SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
-    OH_PixelmapNative *exist_pixelmap = nullptr;
-    {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        auto it = image_cache_map_.find(cache_key);
-        if (it != image_cache_map_.end()) {
-            exist_pixelmap = it->second;
-        }
-        image_cache_map_[cache_key] = pixelmap;
-    }
-    if (exist_pixelmap) {
-        ReleasePixelmap(exist_pixelmap);
-    }
+void KRMemoryCacheModule::LoadImageAsync(const std::string &cache_key, KRImageMemoryCache::Loader loader,
+                                         const KRRenderCallback &callback) {
+    std::weak_ptr<IKRRenderModuleExport> weak_self = shared_from_this();
+    KRImageMemoryCache::GetInstance().LoadAsync(
+        cache_key, std::move(loader),
+        [weak_self, cache_key, callback](const std::shared_ptr<KRPixelmapRef> &image) {
+            // 解码在后台线程完成，回到主线程更新页面状态并回调
+            KRMainThread::RunOnMainThread([weak_self, cache_key, callback, image] {
+                auto self = weak_self.lock();
+                if (!self) {
+                    return;
+                }
+                auto module_self = reinterpret_cast<KRMemoryCacheModule *>(self.get());
+                KRRenderValueMap result;
+                if (image) {
+                    module_self->HoldImage(cache_key, image);
+                    result = module_self->GenerateResult(cache_key, image);
+                } else {
+                    result = module_self->GenerateError(-1, "fetch failed");
+                }
+                if (callback) {
+                    callback(NewKRRenderValue(result));
+                }
+            });
+        });
+}
+
+void KRMemoryCacheModule::HoldImage(const std::string &cache_key, const std::shared_ptr<KRPixelmapRef> &image) {
+    std::unique_lock<std::shared_mutex> lock(mtx_);
+    image_refs_[cache_key] = image;
 }
 
 std::string KRMemoryCacheModule::GenerateCacheKey(const std::string &src) {
@@ -251,23 +260,14 @@ std::string KRMemoryCacheModule::GenerateCacheKey(const std::string &src) {
     return oss.str();
 }
 
-KRRenderValueMap KRMemoryCacheModule::GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
+KRRenderValueMap KRMemoryCacheModule::GenerateResult(const std::string &cache_key,
+                                                     const std::shared_ptr<KRPixelmapRef> &image) {
     KRRenderValueMap result;
     result[kStatusKeyState] = NewKRRenderValue(kCacheStateComplete);
     result[kStatusKeyErrorCode] = NewKRRenderValue(0);
     result[kStatusKeyCacheKey] = NewKRRenderValue(cache_key);
-    uint32_t width = 0;
-    uint32_t height = 0;
-    OH_Pixelmap_ImageInfo *info;
-    if (OH_PixelmapImageInfo_Create(&info) == IMAGE_SUCCESS) {
-        if (OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS) {
-            OH_PixelmapImageInfo_GetWidth(info, &width);
-            OH_PixelmapImageInfo_GetHeight(info, &height);
-        }
-        OH_PixelmapImageInfo_Release(info);
-    }
-    result[kStatusKeyWidth] = NewKRRenderValue(static_cast<int32_t>(width));
-    result[kStatusKeyHeight] = NewKRRenderValue(static_cast<int32_t>(height));
+    result[kStatusKeyWidth] = NewKRRenderValue(static_cast<int32_t>(image->Width()));
+    result[kStatusKeyHeight] = NewKRRenderValue(static_cast<int32_t>(image->Height()));
     return std::move(result);
 }
 
@@ -280,23 +280,10 @@ KRRenderValueMap KRMemoryCacheModule::GenerateError(int32_t code, const std::str
 }
 
 void KRMemoryCacheModule::OnDestroy() {
-    std::vector<OH_PixelmapNative *> to_destroy;
+    std::unordered_map<std::string, std::shared_ptr<KRPixelmapRef>> image_refs;
     {
         std::unique_lock<std::shared_mutex> lock(mtx_);
-        for (const auto &entry : image_cache_map_) {
-            to_destroy.push_back(entry.second);
-        }
-        image_cache_map_.clear();
-    }
-    for (OH_PixelmapNative *pixelmap : to_destroy) {
-        ReleasePixelmap(pixelmap);
-    }
-}
-
-void KRMemoryCacheModule::ReleasePixelmap(OH_PixelmapNative *pixelmap) {
-    if (OH_PixelmapNative_Destroy) {
-        OH_PixelmapNative_Destroy(&pixelmap);
-    } else {
-        OH_PixelmapNative_Release(pixelmap);
+        image_refs.swap(image_refs_);
     }
+    // 仅释放本页面的引用，图片仍保留在全局缓存中供其他页面复用
 }
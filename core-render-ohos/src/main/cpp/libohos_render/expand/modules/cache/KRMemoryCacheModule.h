@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <shared_mutex>
 
+#include "libohos_render/expand/modules/cache/KRImageMemoryCache.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 
 constexpr char kMemoryCacheModuleName[] = "KRMemoryCacheModule";
@@ -37,15 +38,17 @@ class KRMemoryCacheModule : public IKRRenderModuleExport {
     KRAnyValue SetObject(const KRAnyValue &params);
     KRAnyValue CacheImage(const KRAnyValue &params, const KRRenderCallback &callback);
     std::string GenerateCacheKey(const std::string &src);
-    void SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap);
-    KRRenderValueMap GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap);
+    void HoldImage(const std::string &cache_key, const std::shared_ptr<KRPixelmapRef> &image);
+    void LoadImageAsync(const std::string &cache_key, KRImageMemoryCache::Loader loader,
+                        const KRRenderCallback &callback);
+    KRRenderValueMap GenerateResult(const std::string &cache_key, const std::shared_ptr<KRPixelmapRef> &image);
     KRRenderValueMap GenerateError(int32_t code, const std::string &message);
-    OH_PixelmapNative *LoadPixelmapFromLocal(std::string &src);
-    void ReleasePixelmap(OH_PixelmapNative *pixelmap);
+    static OH_PixelmapNative *LoadPixelmapFromLocal(const std::string &src);
 
  private:
     std::unordered_map<std::string, KRAnyValue> cache_map_;
-    std::unordered_map<std::string, OH_PixelmapNative *> image_cache_map_;
+    // 本页面使用过的图片，页面存活期间不随全局缓存淘汰而释放
+    std::unordered_map<std::string, std::shared_ptr<KRPixelmapRef>> image_refs_;
     std::shared_mutex mtx_;
 };
 
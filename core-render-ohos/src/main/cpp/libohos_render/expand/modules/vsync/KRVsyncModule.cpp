@@ -0,0 +1,90 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/modules/vsync/KRVsyncModule.h"
+
+#include "libohos_render/utils/KRStringUtil.h"
+
+namespace kuikly {
+namespace module {
+
+const char KRVsyncModule::MODULE_NAME[] = "KRVsyncModule";
+const char KRVsyncModule::METHOD_REGISTER_VSYNC[] = "registerVsync";
+const char KRVsyncModule::METHOD_UNREGISTER_VSYNC[] = "unRegisterVsync";
+
+KRAnyValue KRVsyncModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
+                                     const KRRenderCallback &callback) {
+    if (kuikly::util::isEqual(method, METHOD_REGISTER_VSYNC)) {
+        RegisterVsync(callback);
+    } else if (kuikly::util::isEqual(method, METHOD_UNREGISTER_VSYNC)) {
+        UnRegisterVsync();
+    }
+    return KREmptyValue();
+}
+
+void KRVsyncModule::OnDestroy() {
+    UnRegisterVsync();
+}
+
+void KRVsyncModule::RegisterVsync(const KRRenderCallback &callback) {
+    std::weak_ptr<IKRRenderModuleExport> weak_self = shared_from_this();
+    KRMainThread::RunOnMainThread([weak_self, callback] {
+        auto self = weak_self.lock();
+        if (!self) {
+            return;
+        }
+        auto module_self = std::static_pointer_cast<KRVsyncModule>(self);
+        module_self->vsync_callback_ = callback;
+        if (module_self->frame_callback_id_ == 0) {
+            module_self->PostFrameCallback();
+        }
+    });
+}
+
+void KRVsyncModule::UnRegisterVsync() {
+    std::weak_ptr<IKRRenderModuleExport> weak_self = shared_from_this();
+    KRMainThread::RunOnMainThread([weak_self] {
+        auto self = weak_self.lock();
+        if (!self) {
+            return;
+        }
+        auto module_self = std::static_pointer_cast<KRVsyncModule>(self);
+        module_self->vsync_callback_ = nullptr;
+        if (module_self->frame_callback_id_ != 0) {
+            KRFrameClock::GetInstance().RemoveFrameCallback(module_self->frame_callback_id_);
+            module_self->frame_callback_id_ = 0;
+        }
+    });
+}
+
+void KRVsyncModule::PostFrameCallback() {
+    std::weak_ptr<IKRRenderModuleExport> weak_self = shared_from_this();
+    frame_callback_id_ = KRFrameClock::GetInstance().PostFrameCallback([weak_self](int64_t frameTimeNanos) {
+        auto self = weak_self.lock();
+        if (!self) {
+            return;
+        }
+        auto module_self = std::static_pointer_cast<KRVsyncModule>(self);
+        module_self->frame_callback_id_ = 0;
+        if (!module_self->vsync_callback_) {
+            return;
+        }
+        module_self->PostFrameCallback();  // 帧回调为一次性，先注册下一帧
+        module_self->vsync_callback_(nullptr);
+    });
+}
+
+}  // namespace module
+}  // namespace kuikly
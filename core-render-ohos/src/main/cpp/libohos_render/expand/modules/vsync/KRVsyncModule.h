@@ -0,0 +1,53 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVSYNCMODULE_H
+#define CORE_RENDER_OHOS_KRVSYNCMODULE_H
+
+#include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+
+namespace kuikly {
+namespace module {
+
+/**
+ * 监听 Vsync 回调，注册后每帧回调一次 Kotlin 侧
+ */
+class KRVsyncModule : public IKRRenderModuleExport {
+ public:
+    static const char MODULE_NAME[];
+
+    KRVsyncModule() = default;
+    KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
+                          const KRRenderCallback &callback) override;
+    void OnDestroy() override;
+
+ private:
+    static const char METHOD_REGISTER_VSYNC[];
+    static const char METHOD_UNREGISTER_VSYNC[];
+
+    void RegisterVsync(const KRRenderCallback &callback);
+    void UnRegisterVsync();
+    void PostFrameCallback();
+
+    // 以下成员仅在主线程访问
+    KRRenderCallback vsync_callback_;
+    KRFrameCallbackId frame_callback_id_ = 0;
+};
+
+}  // namespace module
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRVSYNCMODULE_H
@@ -163,7 +163,7 @@ void IKRRenderViewExport::DestroyTouchInterrupter() {
 }
 
 void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                                    const KRRenderCallback event_call_back) {
+                                    const KRRenderCallback event_call_back, KRPropKey prop_id) {
     if (node_ == nullptr) {
         return;
     }
@@ -172,11 +172,12 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
         CollectReuseKeyIfNeed(prop_key);
     }
 
+    prop_id = KRResolvePropKey(prop_id, prop_key);
     auto didHanded = false;
     if (base_props_handler_ != nullptr) {
-        auto isFrameProp = kuikly::util::isEqual(prop_key, "frame");
+        auto isFrameProp = prop_id == KRPropKey::kFrame;
         if (!(isFrameProp && CustomSetViewFrame())) {
-            didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
+            didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back, prop_id);  // 基础属性设置分发处理
         }
         if (isFrameProp) {
             const std::string &s = prop_value->toString();
@@ -185,11 +186,11 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
         }
     }
     if (!didHanded && base_event_handler_ != nullptr) {
-        didHanded = base_event_handler_->SetProp(shared_from_this(), prop_key, prop_value,
-                                                 event_call_back);  // 基础事件分发处理
+        didHanded = base_event_handler_->SetProp(shared_from_this(), prop_key, prop_value, event_call_back,
+                                                 prop_id);  // 基础事件分发处理
     }
     if (!didHanded) {
-        if (!SetProp(prop_key, prop_value, event_call_back)) {
+        if (!DispatchSetProp(prop_key, prop_value, event_call_back, prop_id)) {
             // prop not handled, pass it forward to extern handler
             if (gExternalPropHandlerOnSet) {
                 struct KRAnyDataInternal anyDataInternal;
@@ -201,6 +202,19 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
     DidSetProp(prop_key);
 }
 
+bool IKRRenderViewExport::DispatchSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+                                          const KRRenderCallback event_call_back, KRPropKey prop_id) {
+    // SetProp可能重入设置其他属性，结束后恢复
+    auto last_prop_key = dispatching_prop_key_;
+    auto last_prop_id = dispatching_prop_id_;
+    dispatching_prop_key_ = &prop_key;
+    dispatching_prop_id_ = prop_id;
+    auto handled = SetProp(prop_key, prop_value, event_call_back);
+    dispatching_prop_key_ = last_prop_key;
+    dispatching_prop_id_ = last_prop_id;
+    return handled;
+}
+
 bool IKRRenderViewExport::ResetProp(const std::string &prop_key) {
     return gExternalPropHandlerOnReset ? gExternalPropHandlerOnReset(GetNode(), prop_key.c_str()) : false;
 }
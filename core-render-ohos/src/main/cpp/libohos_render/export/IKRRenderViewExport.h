@@ -27,6 +27,7 @@
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -291,14 +292,28 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     }
 
     virtual bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                               const KRRenderCallback event_call_back = nullptr) {
+                               const KRRenderCallback event_call_back = nullptr,
+                               KRPropKey prop_id = KRPropKey::kUnresolved) {
         KREnsureMainThread();
 
-        return base_props_handler_->SetProp(prop_key, prop_value, event_call_back);
+        return base_props_handler_->SetProp(prop_key, prop_value, event_call_back, prop_id);
     }
 
+    /**
+     * 属性设置分发入口
+     * @param prop_id 桥接层解析好的内置属性ID，kUnresolved时在此解析一次，随后下传给基础属性/事件处理器，
+     *                组件的SetProp中可通过PropIdOf(prop_key)取得，无需再次比较字符串
+     */
     virtual void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                           const KRRenderCallback event_call_back = nullptr);
+                           const KRRenderCallback event_call_back = nullptr,
+                           KRPropKey prop_id = KRPropKey::kUnresolved);
+
+    /**
+     * 以已解析的prop_id调用组件SetProp，期间组件可通过PropIdOf(prop_key)直接取得该ID
+     * 供包装类组件把属性转发给内部子组件时复用ID
+     */
+    bool DispatchSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+                         const KRRenderCallback event_call_back, KRPropKey prop_id);
 #if 0  // implementation move to cpp file
     {
         if (node_ == nullptr) {
@@ -336,12 +351,13 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         if (node_ == nullptr) {
             return;
         }
+        auto prop_id = KRPropKeyFromString(prop_key);
         auto didHanded = false;
-        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(prop_key)) {
+        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(prop_key, prop_id)) {
             didHanded = true;
         }
         if (!didHanded && base_event_handler_ != nullptr) {
-            didHanded = base_event_handler_->ResetProp(prop_key);
+            didHanded = base_event_handler_->ResetProp(prop_key, prop_id);
         }
         if (!didHanded) {
             ResetProp(prop_key);
@@ -503,6 +519,14 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     }
 
  protected:
+    /**
+     * 组件SetProp中获取属性ID：prop_key为ToSetProp正在分发的属性时直接返回已解析的ID，
+     * 否则（如组件之间直接调用SetProp）按属性名解析
+     */
+    KRPropKey PropIdOf(const std::string &prop_key) const {
+        return &prop_key == dispatching_prop_key_ ? dispatching_prop_id_ : KRPropKeyFromString(prop_key);
+    }
+
     virtual std::shared_ptr<KRBaseEventHandler>  CreateBaseEventHandler(std::shared_ptr<IKRRenderView> rootView){
         if(rootView){
             return std::make_shared<KRBaseEventHandler>(rootView->GetContext()->Config());
@@ -550,6 +574,8 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     float interrupt_y_ = -1;
     bool handling_capture_event_ = false;
     bool is_leaf_node_ = true;
+    const std::string *dispatching_prop_key_ = nullptr;
+    KRPropKey dispatching_prop_id_ = KRPropKey::kUnknown;
  public:
     ArkUI_NodeContentHandle parent_node_content_handle_ = nullptr;
 };
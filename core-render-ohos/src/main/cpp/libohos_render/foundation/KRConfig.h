@@ -18,6 +18,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 #include "libohos_render/foundation/type/KRRenderValue.h"
 
 class KRConfig {
@@ -79,6 +80,26 @@ class KRConfig {
         if (ime_mode != map.end()) {
             ime_mode_ = ime_mode->second->toBool();
         }
+
+        auto ui_task_frame_budget = map.find("uiTaskFrameBudgetMs");
+        if (ui_task_frame_budget != map.end()) {
+            ui_task_frame_budget_ms_ = ui_task_frame_budget->second->toInt();
+        }
+
+        auto parallel_text_layout = map.find("parallelTextLayout");
+        if (parallel_text_layout != map.end()) {
+            parallel_text_layout_ = parallel_text_layout->second->toBool();
+        }
+
+        auto preload_font_families = map.find("preloadFontFamilies");
+        if (preload_font_families != map.end()) {
+            preload_font_families_.clear();
+            for (const auto &family : preload_font_families->second->toArray()) {
+                if (!family->toString().empty()) {
+                    preload_font_families_.push_back(family->toString());
+                }
+            }
+        }
     }
 
     /**
@@ -137,6 +158,27 @@ class KRConfig {
         return ime_mode_;
     }
 
+    /**
+     * 主线程 UI 任务每帧执行时长预算（毫秒），超出后让出主线程到下一帧继续执行；0 表示不限制
+     */
+    int GetUITaskFrameBudgetMs() {
+        return ui_task_frame_budget_ms_;
+    }
+
+    /**
+     * 是否开启文本预排版：文本属性到达后即在后台线程排版，测量时直接取用结果
+     */
+    bool IsParallelTextLayoutEnabled() {
+        return parallel_text_layout_;
+    }
+
+    /**
+     * 页面声明的需预加载的自定义字体族
+     */
+    const std::vector<std::string> &GetPreloadFontFamilies() {
+        return preload_font_families_;
+    }
+
  private:
     float vp2px_ = 0;
     float fontWeightScale_ = 1;
@@ -148,6 +190,9 @@ class KRConfig {
     std::string files_dir_;
     std::string assets_dir_;
     bool ime_mode_ = false;
+    int ui_task_frame_budget_ms_ = 0;
+    bool parallel_text_layout_ = false;
+    std::vector<std::string> preload_font_families_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRCONFIG_H
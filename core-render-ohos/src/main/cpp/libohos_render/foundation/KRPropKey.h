@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPROPKEY_H
+#define CORE_RENDER_OHOS_KRPROPKEY_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace kuikly {
+namespace util {
+/**
+ * 属性名哈希（FNV-1a），编译期与运行期结果一致
+ */
+constexpr uint32_t PropKeyHash(std::string_view key) {
+    uint32_t hash = 2166136261u;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+}  // namespace util
+}  // namespace kuikly
+
+/**
+ * 内置属性名列表（基础属性、基础事件及常用内置组件的属性与事件），新增内置属性时在此登记
+ */
+#define KR_BUILTIN_PROP_KEYS(X)                         \
+    X(kBackgroundColor, "backgroundColor")              \
+    X(kFrame, "frame")                                  \
+    X(kBorderRadius, "borderRadius")                    \
+    X(kBorder, "border")                                \
+    X(kBackgroundImage, "backgroundImage")              \
+    X(kTransform, "transform")                          \
+    X(kOpacity, "opacity")                              \
+    X(kVisibility, "visibility")                        \
+    X(kOverflow, "overflow")                            \
+    X(kZIndex, "zIndex")                                \
+    X(kTouchEnable, "touchEnable")                      \
+    X(kAccessibility, "accessibility")                  \
+    X(kBoxShadow, "boxShadow")                          \
+    X(kAnimation, "animation")                          \
+    X(kAnimationCompletion, "animationCompletion")      \
+    X(kClipPath, "clipPath")                            \
+    X(kClick, "click")                                  \
+    X(kDoubleClick, "doubleClick")                      \
+    X(kLongPress, "longPress")                          \
+    X(kPan, "pan")                                      \
+    X(kPinch, "pinch")                                  \
+    X(kCapture, "capture")                              \
+    X(kTouchDown, "touchDown")                          \
+    X(kTouchMove, "touchMove")                          \
+    X(kTouchUp, "touchUp")                              \
+    X(kPreventTouch, "preventTouch")                    \
+    X(kSuperTouch, "superTouch")                        \
+    X(kHitTestModeOhos, "hit-test-ohos")                \
+    X(kSrc, "src")                                      \
+    X(kResize, "resize")                                \
+    X(kDragEnable, "dragEnable")                        \
+    X(kBlurRadius, "blurRadius")                        \
+    X(kTintColor, "tintColor")                          \
+    X(kCapInsets, "capInsets")                          \
+    X(kDotNineImage, "dotNineImage")                    \
+    X(kMaskLinearGradient, "maskLinearGradient")        \
+    X(kLoadSuccess, "loadSuccess")                      \
+    X(kLoadResolution, "loadResolution")                \
+    X(kLoadFailure, "loadFailure")                      \
+    X(kDirectionRow, "directionRow")                    \
+    X(kPagingEnabled, "pagingEnabled")                  \
+    X(kScrollEnabled, "scrollEnabled")                  \
+    X(kVerticalBounces, "verticalbounces")              \
+    X(kHorizontalBounces, "horizontalbounces")          \
+    X(kBouncesEnable, "bouncesEnable")                  \
+    X(kLimitHeaderBounces, "limitHeaderBounces")        \
+    X(kShowScrollerIndicator, "showScrollerIndicator")  \
+    X(kNestedScroll, "nestedScroll")                    \
+    X(kFlingEnable, "flingEnable")                      \
+    X(kScroll, "scroll")                                \
+    X(kDragBegin, "dragBegin")                          \
+    X(kWillDragEnd, "willDragEnd")                      \
+    X(kDragEnd, "dragEnd")                              \
+    X(kScrollEnd, "scrollEnd")                          \
+    X(kText, "text")                                    \
+    X(kPlaceholder, "placeholder")                      \
+    X(kPlaceholderColor, "placeholderColor")            \
+    X(kFontSize, "fontSize")                            \
+    X(kFontWeight, "fontWeight")                        \
+    X(kColor, "color")                                  \
+    X(kEditable, "editable")                            \
+    X(kTextAlign, "textAlign")                          \
+    X(kKeyboardType, "keyboardType")                    \
+    X(kReturnKeyType, "returnKeyType")                  \
+    X(kMaxTextLength, "maxTextLength")                  \
+    X(kTextDidChange, "textDidChange")                  \
+    X(kInputFocus, "inputFocus")                        \
+    X(kInputBlur, "inputBlur")                          \
+    X(kInputReturn, "inputReturn")                      \
+    X(kTextLengthBeyondLimit, "textLengthBeyondLimit")  \
+    X(kKeyboardHeightChange, "keyboardHeightChange")
+
+/**
+ * 内置属性ID，取值为属性名的编译期哈希，可直接用于switch分发；
+ * 哈希冲突会在KRPropKeyFromString的switch中产生重复case编译错误
+ */
+enum class KRPropKey : uint32_t {
+    kUnknown = 0,
+    kUnresolved = 0xFFFFFFFFu,  // 调用方未预先解析，需按属性名解析
+#define KR_PROP_KEY_ENUM(id, name) id = kuikly::util::PropKeyHash(name),
+    KR_BUILTIN_PROP_KEYS(KR_PROP_KEY_ENUM)
+#undef KR_PROP_KEY_ENUM
+};
+
+/**
+ * 属性名转内置属性ID，非内置属性返回KRPropKey::kUnknown
+ */
+inline KRPropKey KRPropKeyFromString(std::string_view prop_key) {
+    auto key = static_cast<KRPropKey>(kuikly::util::PropKeyHash(prop_key));
+    switch (key) {
+#define KR_PROP_KEY_CASE(id, name) \
+    case KRPropKey::id:            \
+        return prop_key == std::string_view(name) ? key : KRPropKey::kUnknown;
+        KR_BUILTIN_PROP_KEYS(KR_PROP_KEY_CASE)
+#undef KR_PROP_KEY_CASE
+    case KRPropKey::kUnknown:     // 保留值，内置属性哈希与其冲突时编译报错
+    case KRPropKey::kUnresolved:
+    default:
+        return KRPropKey::kUnknown;
+    }
+}
+
+/**
+ * 桥接层已解析过的ID直接返回，kUnresolved时按属性名解析
+ */
+inline KRPropKey KRResolvePropKey(KRPropKey prop_id, std::string_view prop_key) {
+    return prop_id == KRPropKey::kUnresolved ? KRPropKeyFromString(prop_key) : prop_id;
+}
+
+#endif  // CORE_RENDER_OHOS_KRPROPKEY_H
@@ -0,0 +1,93 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KREXECUTIONTOKEN_H
+#define CORE_RENDER_OHOS_KREXECUTIONTOKEN_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * Context 任务执行权：同一时刻只有一个线程执行 Context 任务。
+ * 外部线程（主线程）同步等待时优先获得执行权，工作线程在任务间隙通过 HasWaiter 检查并让出
+ */
+class KRExecutionToken {
+ public:
+    /**
+     * 外部线程阻塞获取执行权
+     * @return 工作线程正同步等待主线程时返回 false，此时同步执行会死锁，调用方需改为异步派发
+     */
+    bool AcquireForCaller() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiting_count_.fetch_add(1);
+        condition_.wait(lock, [this] { return !executing_ || worker_waiting_main_; });
+        waiting_count_.fetch_sub(1);
+        if (executing_) {
+            return false;
+        }
+        executing_ = true;
+        return true;
+    }
+
+    /**
+     * 工作线程阻塞获取执行权，有外部线程等待时先让其执行
+     */
+    void AcquireForWorker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return !executing_ && waiting_count_.load() == 0; });
+        executing_ = true;
+    }
+
+    void Release() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            executing_ = false;
+        }
+        condition_.notify_all();
+    }
+
+    /**
+     * 是否有外部线程在等待执行权，工作线程据此在任务间隙让出
+     */
+    bool HasWaiter() const {
+        return waiting_count_.load() != 0;
+    }
+
+    /**
+     * 工作线程开始同步等待主线程，期间外部线程的获取请求失败返回，避免互相等待
+     */
+    void BeginWaitMainThread() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            worker_waiting_main_ = true;
+        }
+        condition_.notify_all();
+    }
+
+    void EndWaitMainThread() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        worker_waiting_main_ = false;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;  // 执行权释放或工作线程开始等待主线程时通知
+    bool executing_ = false;             // 是否有线程持有执行权
+    bool worker_waiting_main_ = false;   // 工作线程是否正同步等待主线程
+    std::atomic<int> waiting_count_{0};  // 等待执行权的外部线程数
+};
+
+#endif  // CORE_RENDER_OHOS_KREXECUTIONTOKEN_H
@@ -0,0 +1,83 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+
+KRFrameClock &KRFrameClock::GetInstance() {
+    static KRFrameClock *instance = new KRFrameClock();  // 进程级单例，不析构
+    return *instance;
+}
+
+void KRFrameClock::SetFrameSource(std::shared_ptr<IKRFrameSource> source) {
+    if (!source) {
+        source = IKRFrameSource::CreateSystemSource();
+    }
+    std::shared_ptr<IKRFrameSource> old_source;  // 在锁外析构旧信号源
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        old_source = std::move(source_);
+        source_ = source;
+        // 旧信号源的请求可能不再回调，有待执行的回调时向新信号源重新请求
+        frame_requested_ = !callbacks_.empty();
+        if (!frame_requested_) {
+            return;
+        }
+    }
+    source->RequestFrame();
+}
+
+KRFrameCallbackId KRFrameClock::PostFrameCallback(KRFrameCallback callback) {
+    KRFrameCallbackId id;
+    std::shared_ptr<IKRFrameSource> source;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        id = next_id_++;
+        callbacks_.emplace_back(id, std::move(callback));
+        if (frame_requested_) {
+            return id;
+        }
+        frame_requested_ = true;
+        if (!source_) {
+            source_ = IKRFrameSource::CreateSystemSource();
+        }
+        source = source_;
+    }
+    source->RequestFrame();
+    return id;
+}
+
+void KRFrameClock::RemoveFrameCallback(KRFrameCallbackId id) {
+    KRFrameCallback removed;  // 在锁外析构回调
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
+        if (it->first == id) {
+            removed = std::move(it->second);
+            callbacks_.erase(it);
+            return;
+        }
+    }
+}
+
+void KRFrameClock::OnFrame(int64_t frameTimeNanos) {
+    std::vector<std::pair<KRFrameCallbackId, KRFrameCallback>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frame_requested_ = false;
+        callbacks.swap(callbacks_);
+    }
+    for (auto &callback : callbacks) {
+        callback.second(frameTimeNanos);
+    }
+}
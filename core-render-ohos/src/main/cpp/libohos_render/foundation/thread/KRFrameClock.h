@@ -0,0 +1,80 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMECLOCK_H
+#define CORE_RENDER_OHOS_KRFRAMECLOCK_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using KRFrameCallback = std::function<void(int64_t frameTimeNanos)>;
+using KRFrameCallbackId = uint64_t;
+
+/**
+ * 帧信号源，默认为系统 Vsync；可替换为手动驱动的时钟（如 Linux 下的单测）
+ */
+class IKRFrameSource {
+ public:
+    virtual ~IKRFrameSource() = default;
+    /**
+     * 请求下一帧信号，信号到达后需在主线程调用 KRFrameClock::OnFrame
+     */
+    virtual void RequestFrame() = 0;
+
+    /**
+     * 创建系统 Vsync 信号源，实现见 KRNativeVsyncSource.cpp
+     */
+    static std::shared_ptr<IKRFrameSource> CreateSystemSource();
+};
+
+/**
+ * 主线程帧时钟：注册的回调在下一帧信号到达时于主线程统一执行，回调均为一次性
+ */
+class KRFrameClock {
+ public:
+    static KRFrameClock &GetInstance();
+
+    /**
+     * 替换帧信号源，传 nullptr 恢复系统 Vsync
+     */
+    void SetFrameSource(std::shared_ptr<IKRFrameSource> source);
+
+    /**
+     * 注册下一帧回调，可在任意线程调用；帧回调执行期间注册的回调在再下一帧执行
+     */
+    KRFrameCallbackId PostFrameCallback(KRFrameCallback callback);
+
+    void RemoveFrameCallback(KRFrameCallbackId id);
+
+    /**
+     * 帧信号到达，仅在主线程调用
+     */
+    void OnFrame(int64_t frameTimeNanos);
+
+ private:
+    KRFrameClock() = default;
+
+    std::mutex mutex_;
+    std::vector<std::pair<KRFrameCallbackId, KRFrameCallback>> callbacks_;
+    KRFrameCallbackId next_id_ = 1;
+    bool frame_requested_ = false;
+    std::shared_ptr<IKRFrameSource> source_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRFRAMECLOCK_H
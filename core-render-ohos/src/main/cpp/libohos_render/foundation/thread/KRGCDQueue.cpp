@@ -13,4 +13,199 @@
  * limitations under the License.
  */
 
-#include "KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+#include <algorithm>
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
+#include "libohos_render/utils/KRJSONCodec.h"
+
+namespace {
+constexpr size_t kMinThreadCount = 2;
+constexpr size_t kMaxThreadCount = 8;
+constexpr size_t kNotWorker = SIZE_MAX;
+thread_local size_t gCurrentWorkerIndex = kNotWorker;
+thread_local const void *gCurrentQueue = nullptr;
+const char *kQoSNames[] = {"userInitiated", "utility", "background"};
+}  // namespace
+
+KRGCDQueue &KRGCDQueue::GetInstance() {
+    static KRGCDQueue *instance = new KRGCDQueue([] {
+        // 保留一个核心给主线程
+        size_t cores = std::thread::hardware_concurrency();
+        size_t count = cores > 1 ? cores - 1 : kMinThreadCount;
+        return std::min(std::max(count, kMinThreadCount), kMaxThreadCount);
+    }());  // 进程级单例，不析构，退出时不等待后台线程
+    return *instance;
+}
+
+KRGCDQueue::KRGCDQueue(size_t thread_count) {
+    for (size_t i = 0; i < thread_count; i++) {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        workers_[i]->thread = std::thread([this, i] { Run(i); });
+        pthread_setname_np(workers_[i]->thread.native_handle(), ("kuiklybg" + std::to_string(i)).c_str());
+    }
+}
+
+KRGCDQueue::~KRGCDQueue() {
+    Shutdown();
+}
+
+void KRGCDQueue::DispatchAsync(KRTask task, KRQoS qos, const KRCancellationToken &token) {
+    // 工作线程派发的任务放入自身队列，其他线程轮流分配
+    size_t index = gCurrentQueue == this ? gCurrentWorkerIndex : next_worker_.fetch_add(1) % workers_.size();
+    {
+        auto &worker = *workers_[index];
+        std::unique_lock<std::mutex> lock(worker.mutex);
+        // 在队列锁内检查，Shutdown 持有全部队列锁置位 stop_，入队成功的任务必定在线程退出前执行
+        if (stop_.load()) {
+            lock.unlock();
+            task();
+            return;
+        }
+        worker.queues[static_cast<size_t>(qos)].PushBack(
+            Job{std::move(task), token, std::chrono::steady_clock::now(), qos});
+        worker.sizes[static_cast<size_t>(qos)].fetch_add(1, std::memory_order_relaxed);
+        pending_.fetch_add(1);  // 与出队在同一把锁内增减，避免其他线程看到计数却取不到任务而空转
+    }
+    if (sleeping_.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);  // 与等待条件检查互斥，避免丢失唤醒
+        }
+        sleep_condition_.notify_one();
+    }
+}
+
+void KRGCDQueue::Shutdown() {
+    std::call_once(shutdown_flag_, [this] {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            std::vector<std::unique_lock<std::mutex>> worker_locks;
+            for (auto &worker : workers_) {
+                worker_locks.emplace_back(worker->mutex);
+            }
+            stop_.store(true);
+        }
+        sleep_condition_.notify_all();
+        for (auto &worker : workers_) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+    });
+}
+
+void KRGCDQueue::Run(size_t index) {
+    gCurrentWorkerIndex = index;
+    gCurrentQueue = this;
+    Job job;
+    while (true) {
+        if (TakeJob(index, job)) {
+            RunJob(job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleeping_.fetch_add(1);
+        sleep_condition_.wait(lock, [this] { return stop_.load() || pending_.load() > 0; });
+        sleeping_.fetch_sub(1);
+        if (stop_.load() && pending_.load() == 0) {
+            return;
+        }
+    }
+}
+
+bool KRGCDQueue::TakeJob(size_t index, Job &job) {
+    size_t count = workers_.size();
+    for (size_t qos = 0; qos < kQoSCount; qos++) {
+        // 先取自身队列头部，再从其他线程队列尾部窃取，与队列所有者错开
+        for (size_t offset = 0; offset < count; offset++) {
+            auto &worker = *workers_[(index + offset) % count];
+            if (worker.sizes[qos].load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            auto &queue = worker.queues[qos];
+            if (queue.Empty()) {
+                continue;
+            }
+            if (offset == 0) {
+                job = queue.PopFront();
+            } else {
+                job = queue.PopBack();
+                steal_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+            worker.sizes[qos].fetch_sub(1, std::memory_order_relaxed);
+            pending_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void KRGCDQueue::RunJob(Job &job) {
+    if (job.token.IsCancelled()) {
+        cancelled_count_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        auto latency = std::chrono::steady_clock::now() - job.enqueue_time;
+        auto latency_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+        int64_t queued_us =
+            KRThreadTrace::IsEnabled() ? KRThreadTrace::NowMicros() - static_cast<int64_t>(latency_us) : 0;
+        KRTraceScope trace("BackgroundTask", kQoSNames[static_cast<size_t>(job.qos)], nullptr, queued_us);
+        auto &stats = latency_[static_cast<size_t>(job.qos)];
+        stats.count.fetch_add(1, std::memory_order_relaxed);
+        stats.total_us.fetch_add(latency_us, std::memory_order_relaxed);
+        auto max_us = stats.max_us.load(std::memory_order_relaxed);
+        while (latency_us > max_us && !stats.max_us.compare_exchange_weak(max_us, latency_us)) {
+        }
+        job.task();
+        executed_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    job = Job();  // 在线程内释放任务捕获的资源
+}
+
+KRGCDQueue::Stats KRGCDQueue::GetStats() const {
+    Stats stats;
+    stats.thread_count = workers_.size();
+    stats.queue_depth = pending_.load();
+    stats.executed_count = executed_count_.load();
+    stats.steal_count = steal_count_.load();
+    stats.cancelled_count = cancelled_count_.load();
+    for (size_t i = 0; i < kQoSCount; i++) {
+        auto count = latency_[i].count.load();
+        stats.avg_latency_ms[i] = count > 0 ? latency_[i].total_us.load() / 1000.0 / count : 0;
+        stats.max_latency_ms[i] = latency_[i].max_us.load() / 1000.0;
+    }
+    return stats;
+}
+
+std::string KRGCDQueue::GetStatsJson() const {
+    auto stats = GetStats();
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("threadCount");
+    writer.Int(stats.thread_count);
+    writer.Key("queueDepth");
+    writer.Int(stats.queue_depth);
+    writer.Key("executedCount");
+    writer.Int(stats.executed_count);
+    writer.Key("stealCount");
+    writer.Int(stats.steal_count);
+    writer.Key("cancelledCount");
+    writer.Int(stats.cancelled_count);
+    writer.Key("latency");
+    writer.BeginObject();
+    for (size_t i = 0; i < kQoSCount; i++) {
+        writer.Key(kQoSNames[i]);
+        writer.BeginObject();
+        writer.Key("avgMs");
+        writer.Double(stats.avg_latency_ms[i]);
+        writer.Key("maxMs");
+        writer.Double(stats.max_latency_ms[i]);
+        writer.EndObject();
+    }
+    writer.EndObject();
+    writer.EndObject();
+    return json;
+}
@@ -17,66 +17,173 @@
 #define CORE_RENDER_OHOS_KRGCDQUEUE_H
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
-#include <iostream>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
 #include <thread>
 #include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
 
+/**
+ * 后台任务服务等级，数值越小越优先
+ */
+enum class KRQoS : uint8_t {
+    kUserInitiated = 0,  // 用户可见内容的解码等任务
+    kUtility,            // 文件读取、预加载等后台I/O（默认）
+    kBackground,         // 对象释放等清理任务
+    kCount,
+};
+
+/**
+ * 任务取消令牌，可拷贝，拷贝间共享取消状态；默认构造的令牌不可取消
+ */
+class KRCancellationToken {
+ public:
+    KRCancellationToken() = default;
+
+    static KRCancellationToken Create() {
+        KRCancellationToken token;
+        token.cancelled_ = std::make_shared<std::atomic<bool>>(false);
+        return token;
+    }
+
+    void Cancel() const {
+        if (cancelled_) {
+            cancelled_->store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool IsCancelled() const {
+        return cancelled_ && cancelled_->load(std::memory_order_relaxed);
+    }
+
+ private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+/**
+ * 后台线程池：线程数按CPU核数确定，每个线程持有按QoS划分的任务队列，空闲线程从其他线程队列窃取任务。
+ * 线程优先执行高QoS任务（含窃取），同QoS内按入队顺序执行。
+ */
 class KRGCDQueue {
  public:
-    // 删除拷贝构造函数和赋值操作符
+    struct Stats {
+        size_t thread_count = 0;
+        size_t queue_depth = 0;
+        uint64_t executed_count = 0;
+        uint64_t steal_count = 0;
+        uint64_t cancelled_count = 0;
+        double avg_latency_ms[static_cast<size_t>(KRQoS::kCount)] = {};  // 入队到开始执行
+        double max_latency_ms[static_cast<size_t>(KRQoS::kCount)] = {};
+    };
+
     KRGCDQueue(const KRGCDQueue &) = delete;
     KRGCDQueue &operator=(const KRGCDQueue &) = delete;
 
-    // 提供一个静态方法来获取类的唯一实例
-    static KRGCDQueue &GetInstance() {
-        static KRGCDQueue instance(4);  // 最大4条线程并行
-        return instance;
-    }
+    static KRGCDQueue &GetInstance();
 
-    ~KRGCDQueue() {}
+    ~KRGCDQueue();
 
     /**
      * 切换到多线程环境执行任务
      * @param task 任务
+     * @param qos 服务等级
+     * @param token 取消令牌，任务开始执行前已取消则丢弃
      */
-    void DispatchAsync(std::function<void()> task) {
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            tasks.emplace(task);
-        }
-        condition.notify_one();
-    }
+    void DispatchAsync(KRTask task, KRQoS qos = KRQoS::kUtility, const KRCancellationToken &token = {});
+
+    /**
+     * 停止接收新任务，执行完已入队任务后退出全部线程；之后派发的任务在调用线程直接执行
+     */
+    void Shutdown();
+
+    Stats GetStats() const;
+    std::string GetStatsJson() const;
 
  private:
-    // 将构造函数设为私有
-    explicit KRGCDQueue(size_t num_threads) {
-        for (size_t i = 0; i < num_threads; ++i) {
-            threads.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex);
-                        condition.wait(lock, [this] { return !tasks.empty(); });
-                        if (tasks.empty()) {
-                            return;
-                        }
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-                    task();
-                }
-            });
+    static constexpr size_t kQoSCount = static_cast<size_t>(KRQoS::kCount);
+
+    struct Job {
+        KRTask task;
+        KRCancellationToken token;
+        std::chrono::steady_clock::time_point enqueue_time;
+        KRQoS qos = KRQoS::kUtility;
+    };
+
+    /**
+     * 双端取出的任务队列，取空后复用已分配的容量，避免 std::deque 频繁分配块
+     */
+    class JobQueue {
+     public:
+        bool Empty() const {
+            return head_ == jobs_.size();
         }
-    }
+        void PushBack(Job &&job) {
+            jobs_.push_back(std::move(job));
+        }
+        Job PopFront() {
+            Job job = std::move(jobs_[head_++]);
+            Compact();
+            return job;
+        }
+        Job PopBack() {
+            Job job = std::move(jobs_.back());
+            jobs_.pop_back();
+            Compact();
+            return job;
+        }
+
+     private:
+        void Compact() {
+            if (head_ == jobs_.size()) {
+                jobs_.clear();
+                head_ = 0;
+            } else if (head_ >= kCompactThreshold && head_ * 2 >= jobs_.size()) {
+                jobs_.erase(jobs_.begin(), jobs_.begin() + head_);
+                head_ = 0;
+            }
+        }
+
+        static constexpr size_t kCompactThreshold = 256;
+        std::vector<Job> jobs_;
+        size_t head_ = 0;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        JobQueue queues[kQoSCount];
+        std::atomic<size_t> sizes[kQoSCount] = {};  // 队列长度，用于无锁跳过空队列
+        std::thread thread;
+    };
+
+    struct LatencyStats {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_us{0};
+        std::atomic<uint64_t> max_us{0};
+    };
+
+    explicit KRGCDQueue(size_t thread_count);
+
+    void Run(size_t index);
+    bool TakeJob(size_t index, Job &job);
+    void RunJob(Job &job);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> sleeping_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::atomic<bool> stop_{false};
+    std::once_flag shutdown_flag_;
 
-    std::vector<std::thread> threads;
-    std::queue<std::function<void()>> tasks;
-    std::mutex queue_mutex;
-    std::condition_variable condition;
+    std::atomic<uint64_t> executed_count_{0};
+    std::atomic<uint64_t> steal_count_{0};
+    std::atomic<uint64_t> cancelled_count_{0};
+    LatencyStats latency_[kQoSCount];
 };
 
 #endif  // CORE_RENDER_OHOS_KRGCDQUEUE_H
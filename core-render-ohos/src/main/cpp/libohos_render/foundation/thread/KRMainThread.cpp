@@ -16,14 +16,13 @@
 #include "KRMainThread.h"
 
 #include <hilog/log.h>
-#include "KRDelayThread.h"
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 
 
 napi_threadsafe_function g_threadsafe_func_handle = NULL;
 // 延时Api
 static void DispatchAsync(std::function<void()> task, int delayMilliseconds = 0) {
-    static KRDelayThread *gDelayThread = new KRDelayThread("kuiklyasync");
-    gDelayThread->DispatchAsync(task, delayMilliseconds);
+    KRTimerWheel::GetInstance().Schedule(delayMilliseconds, std::move(task));
 }
 class MainThreadTask {
  public:
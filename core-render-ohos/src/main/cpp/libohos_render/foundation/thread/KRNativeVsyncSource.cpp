@@ -0,0 +1,67 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+
+#include <native_vsync/native_vsync.h>
+#include <chrono>
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+constexpr char kVsyncName[] = "kuikly_vsync";
+constexpr int kFallbackFrameIntervalMs = 16;
+
+/**
+ * 系统 Vsync 信号源，Vsync 回调在系统线程，需切回主线程分发
+ */
+class KRNativeVsyncSource : public IKRFrameSource {
+ public:
+    KRNativeVsyncSource() {
+        vsync_ = OH_NativeVSync_Create(kVsyncName, sizeof(kVsyncName) - 1);
+        if (vsync_ == nullptr) {
+            KR_LOG_ERROR << "OH_NativeVSync_Create failed, fallback to main thread timer";
+        }
+    }
+
+    ~KRNativeVsyncSource() override {
+        if (vsync_) {
+            OH_NativeVSync_Destroy(vsync_);
+        }
+    }
+
+    void RequestFrame() override {
+        if (vsync_ && OH_NativeVSync_RequestFrame(vsync_, &KRNativeVsyncSource::OnVsync, nullptr) == 0) {
+            return;
+        }
+        // Vsync 不可用时按 60Hz 兜底，保证帧回调不会丢失
+        KRMainThread::RunOnMainThread(
+            [] {
+                auto now = std::chrono::steady_clock::now().time_since_epoch();
+                KRFrameClock::GetInstance().OnFrame(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+            },
+            kFallbackFrameIntervalMs);
+    }
+
+ private:
+    static void OnVsync(long long timestamp, void *data) {  // NOLINT
+        KRMainThread::RunOnMainThread([timestamp] { KRFrameClock::GetInstance().OnFrame(timestamp); });
+    }
+
+    OH_NativeVSync *vsync_ = nullptr;
+};
+
+std::shared_ptr<IKRFrameSource> IKRFrameSource::CreateSystemSource() {
+    return std::make_shared<KRNativeVsyncSource>();
+}
@@ -0,0 +1,143 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASK_H
+#define CORE_RENDER_OHOS_KRTASK_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 仅可移动的无参任务，闭包不超过 kInlineSize 时存放在对象内部，避免堆分配；
+ * 可由任意 void() 可调用对象（包括 std::function）隐式构造
+ */
+class KRTask {
+ public:
+    static constexpr size_t kInlineSize = 48;
+
+    KRTask() = default;
+    KRTask(std::nullptr_t) {}  // NOLINT
+
+    template <typename F, typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same<Fn, KRTask>::value && std::is_invocable_r<void, Fn &>::value>>
+    KRTask(F &&f) {  // NOLINT
+        Init<Fn>(std::forward<F>(f));
+    }
+
+    KRTask(KRTask &&other) noexcept {
+        MoveFrom(other);
+    }
+
+    KRTask &operator=(KRTask &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    KRTask(const KRTask &) = delete;
+    KRTask &operator=(const KRTask &) = delete;
+
+    ~KRTask() {
+        Reset();
+    }
+
+    explicit operator bool() const {
+        return ops_ != nullptr;
+    }
+
+    void operator()() {
+        ops_->invoke(Target());
+    }
+
+    void Reset() {
+        if (ops_) {
+            ops_->destroy(Target(), heap_ != nullptr);
+            ops_ = nullptr;
+            heap_ = nullptr;
+        }
+    }
+
+ private:
+    struct Ops {
+        void (*invoke)(void *target);
+        void (*move)(void *from, void *to);  // 仅用于内联存储
+        void (*destroy)(void *target, bool heap);
+    };
+
+    template <typename Fn> static constexpr bool IsInline() {
+        return sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible<Fn>::value;
+    }
+
+    template <typename Fn> static const Ops *OpsFor() {
+        static const Ops ops = {
+            [](void *target) { (*static_cast<Fn *>(target))(); },
+            [](void *from, void *to) {
+                new (to) Fn(std::move(*static_cast<Fn *>(from)));
+                static_cast<Fn *>(from)->~Fn();
+            },
+            [](void *target, bool heap) {
+                if (heap) {
+                    delete static_cast<Fn *>(target);
+                } else {
+                    static_cast<Fn *>(target)->~Fn();
+                }
+            },
+        };
+        return &ops;
+    }
+
+    template <typename Fn, typename F> void Init(F &&f) {
+        if constexpr (std::is_pointer<Fn>::value || std::is_member_pointer<Fn>::value) {
+            if (f == nullptr) {
+                return;
+            }
+        } else if constexpr (std::is_constructible<bool, const Fn &>::value) {
+            if (!static_cast<bool>(f)) {  // 空的 std::function
+                return;
+            }
+        }
+        if constexpr (IsInline<Fn>()) {
+            new (storage_) Fn(std::forward<F>(f));
+        } else {
+            heap_ = new Fn(std::forward<F>(f));
+        }
+        ops_ = OpsFor<Fn>();
+    }
+
+    void MoveFrom(KRTask &other) {
+        ops_ = other.ops_;
+        heap_ = other.heap_;
+        if (ops_ && !heap_) {
+            ops_->move(other.storage_, storage_);
+        }
+        other.ops_ = nullptr;
+        other.heap_ = nullptr;
+    }
+
+    void *Target() {
+        return heap_ ? heap_ : static_cast<void *>(storage_);
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+    const Ops *ops_ = nullptr;
+    void *heap_ = nullptr;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASK_H
@@ -0,0 +1,129 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASKLANES_H
+#define CORE_RENDER_OHOS_KRTASKLANES_H
+
+#include <cstddef>
+#include <cstdint>
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
+
+/**
+ * Context 任务优先级，数值越小越优先
+ */
+enum class KRTaskPriority : uint8_t {
+    kInput = 0,  // 触摸、手势、滚动等输入事件
+    kLayout,     // 布局与 UI 任务同步
+    kCallback,   // 页面生命周期事件、模块回调等普通任务（默认）
+    kTimer,      // setTimeout 等定时回调
+    kIdle,       // 空闲任务，如延迟销毁，其他通道繁忙时按 kMaxIdleSkippedCount 限定最长等待
+    kCount,
+};
+
+/**
+ * 按优先级分通道的任务队列：任意线程入队，工作线程收取后按优先级逐个执行，同一通道内保持 FIFO。
+ * 被跳过的通道累计次数，达到阈值后先执行一次，避免饿死
+ */
+class KRTaskLanes {
+ public:
+    static constexpr uint32_t kMaxSkippedCount = 8;
+    static constexpr uint32_t kMaxIdleSkippedCount = 64;
+
+    /**
+     * 任意线程入队
+     * @return 该通道入队前是否为空，为空时需要唤醒工作线程
+     */
+    bool Push(KRTask task, KRTaskPriority priority) {
+        return queued_[static_cast<size_t>(priority)].Push(std::move(task));
+    }
+
+    /**
+     * 是否有尚未收取的任务，任意线程可调用
+     */
+    bool HasQueued() const {
+        for (const auto &lane : queued_) {
+            if (!lane.Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * 以下方法仅限工作线程调用
+     */
+    bool HasPending() const {
+        for (const auto &pending : pending_) {
+            if (!pending.Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * 将各通道新入队的任务移入待执行批次
+     * @return 是否有待执行任务
+     */
+    bool Collect() {
+        bool has_pending = false;
+        for (size_t i = 0; i < kLaneCount; i++) {
+            if (!queued_[i].Empty()) {
+                pending_[i].Append(queued_[i].TakeAll());
+            }
+            has_pending = has_pending || !pending_[i].Empty();
+        }
+        return has_pending;
+    }
+
+    /**
+     * 选出并执行下一个待执行任务，调用前需确认 Collect 返回 true
+     */
+    void RunNext() {
+        size_t next = kLaneCount;
+        for (size_t i = 0; i < kLaneCount; i++) {
+            if (pending_[i].Empty()) {
+                continue;
+            }
+            if (next == kLaneCount) {
+                next = i;
+            }
+            if (skipped_count_[i] >= MaxSkippedCount(i)) {
+                next = i;
+                break;
+            }
+        }
+        for (size_t i = 0; i < kLaneCount; i++) {
+            if (i != next && !pending_[i].Empty()) {
+                skipped_count_[i]++;
+            }
+        }
+        skipped_count_[next] = 0;
+        pending_[next].RunFront();
+    }
+
+ private:
+    static constexpr size_t kLaneCount = static_cast<size_t>(KRTaskPriority::kCount);
+
+    static constexpr uint32_t MaxSkippedCount(size_t lane) {
+        return lane == static_cast<size_t>(KRTaskPriority::kIdle) ? kMaxIdleSkippedCount : kMaxSkippedCount;
+    }
+
+    KRTaskQueue queued_[kLaneCount];           // 各优先级的入队通道
+    KRTaskQueue::Batch pending_[kLaneCount];   // 已收取、待执行的任务
+    uint32_t skipped_count_[kLaneCount] = {};  // 通道连续被跳过次数
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASKLANES_H
@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASKQUEUE_H
+#define CORE_RENDER_OHOS_KRTASKQUEUE_H
+
+#include <atomic>
+#include "libohos_render/foundation/thread/KRTask.h"
+#include "libohos_render/utils/KRFixedBlockPool.h"
+
+/**
+ * 无锁多生产者单消费者任务队列：生产者以 CAS 压入链表头，消费者一次性交换出全部任务并反转为 FIFO 批次。
+ * 链表节点从 KRFixedBlockPool 复用，入队不走系统堆（池的空闲链表由自旋锁保护，临界区只有一次指针交换）
+ */
+class KRTaskQueue {
+ public:
+    struct Node {
+        KRTask task;
+        Node *next = nullptr;
+
+        static void *operator new(size_t) {
+            return KRFixedBlockPool<sizeof(Node)>::GetInstance().Allocate();
+        }
+        static void operator delete(void *ptr) {
+            KRFixedBlockPool<sizeof(Node)>::GetInstance().Deallocate(ptr);
+        }
+    };
+
+    /**
+     * 按入队顺序排列的一批任务，析构时释放未执行的任务
+     */
+    class Batch {
+     public:
+        Batch() = default;
+        Batch(Node *head, Node *tail) : head_(head), tail_(tail) {}
+        Batch(Batch &&other) noexcept : head_(other.head_), tail_(other.tail_) {
+            other.head_ = nullptr;
+            other.tail_ = nullptr;
+        }
+        Batch &operator=(Batch &&other) noexcept {
+            std::swap(head_, other.head_);
+            std::swap(tail_, other.tail_);
+            return *this;
+        }
+        Batch(const Batch &) = delete;
+        Batch &operator=(const Batch &) = delete;
+        ~Batch() {
+            while (!Empty()) {
+                delete PopNode();
+            }
+        }
+
+        bool Empty() const {
+            return head_ == nullptr;
+        }
+
+        /**
+         * 将另一批任务接到队尾
+         */
+        void Append(Batch &&other) {
+            if (other.Empty()) {
+                return;
+            }
+            if (Empty()) {
+                head_ = other.head_;
+            } else {
+                tail_->next = other.head_;
+            }
+            tail_ = other.tail_;
+            other.head_ = nullptr;
+            other.tail_ = nullptr;
+        }
+
+        /**
+         * 执行并移除队首任务
+         */
+        void RunFront() {
+            Node *node = PopNode();
+            node->task();
+            delete node;
+        }
+
+     private:
+        Node *PopNode() {
+            Node *node = head_;
+            head_ = node->next;
+            if (head_ == nullptr) {
+                tail_ = nullptr;
+            }
+            return node;
+        }
+
+        Node *head_ = nullptr;
+        Node *tail_ = nullptr;
+    };
+
+    KRTaskQueue() = default;
+    KRTaskQueue(const KRTaskQueue &) = delete;
+    KRTaskQueue &operator=(const KRTaskQueue &) = delete;
+    ~KRTaskQueue() {
+        TakeAll();
+    }
+
+    /**
+     * 任意线程入队
+     * @return 入队前队列是否为空，为空时需要唤醒消费者
+     */
+    bool Push(KRTask task) {
+        Node *node = new Node{std::move(task), head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return node->next == nullptr;
+    }
+
+    bool Empty() const {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /**
+     * 消费者线程取出当前全部任务
+     */
+    Batch TakeAll() {
+        Node *node = head_.exchange(nullptr, std::memory_order_acquire);
+        Node *tail = node;
+        Node *reversed = nullptr;
+        while (node) {
+            Node *next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+        return Batch(reversed, tail);
+    }
+
+ private:
+    std::atomic<Node *> head_{nullptr};
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASKQUEUE_H
@@ -16,17 +16,20 @@
 #ifndef CORE_RENDER_OHOS_KRTHREAD_H
 #define CORE_RENDER_OHOS_KRTHREAD_H
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <mutex>
-#include <queue>
+#include <memory>
 #include <thread>
-#include "KRDelayThread.h"
+#include "libohos_render/foundation/thread/KRExecutionToken.h"
+#include "libohos_render/foundation/thread/KRTaskLanes.h"
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 
-#include "libohos_render/utils/KRRenderLoger.h"
 class KRThread {
  public:
     explicit KRThread(const std::string &name) : m_stop(false) {
@@ -35,13 +38,12 @@ class KRThread {
             this->Worker();
         });
         pthread_setname_np(m_workerThread.native_handle(), name.c_str());
-
-        m_delayThread = new KRDelayThread(name + "d");
     }
 
+    /**
+     * 注：已添加的延时任务持有 this，需先取消延时任务再析构
+     */
     ~KRThread() {
-        delete m_delayThread;
-        m_delayThread = nullptr;
         {
             std::unique_lock<std::mutex> lock(m_mutex);
             m_stop = true;
@@ -50,90 +52,67 @@ class KRThread {
         m_workerThread.join();
     }
 
-    void DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
+    /**
+     * 异步派发任务
+     * @return 延时任务的定时器ID，可通过 KRTimerWheel::Cancel 取消；不延时返回 kKRInvalidTimerId
+     */
+    KRTimerId DispatchAsync(KRTask task, int delayMilliseconds = 0,
+                            KRTaskPriority priority = KRTaskPriority::kCallback) {
         if (delayMilliseconds > 0) {
-            m_delayThread->DispatchAsync([task, this] { this->DispatchAsync(task, 0); }, delayMilliseconds);
-            return;
+            return KRTimerWheel::GetInstance().Schedule(
+                delayMilliseconds, [task = std::move(task), priority, this]() mutable {
+                    this->DispatchAsync(std::move(task), 0, priority);
+                });
         }
-        if (IsCurrentThreadWorkerThread()) {
-            // 如果当前线程已经是工作线程，直接将任务添加到队列
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_tasks.emplace(task);
-        } else {
-            // 否则，将任务添加到队列
+        // 队列由空变为非空时才需要唤醒工作线程；工作线程自身入队时会在执行下一个任务前取走
+        if (m_lanes.Push(std::move(task), priority) && !IsCurrentThreadWorkerThread()) {
             {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_tasks.emplace(task);
+                std::unique_lock<std::mutex> lock(m_mutex);  // 与工作线程的等待条件检查互斥，避免丢失唤醒
             }
             m_condition.notify_one();
         }
+        return kKRInvalidTimerId;
     }
 
-    void DispatchSync(const std::function<void()> &task) {
-        DirectRunOnCurThread(task);
-        return;
+    bool DispatchSync(const std::function<void()> &task) {
+        return DirectRunOnCurThread(task);
     }
 
-    void DirectRunOnCurThread(const std::function<void()> &task) {
-        if (m_isExecutingTask.load()) {
+    /**
+     * 在当前线程同步执行 Context 任务：等待工作线程让出执行权后执行，执行期间工作线程不会执行其他任务。
+     * 工作线程在任务间隙检查主线程等待并优先让出，等待时长不超过一个任务的执行时间。
+     * 若工作线程正同步等待主线程（见 BeginWaitMainThread），同步执行会死锁，此时退化为异步派发。
+     * @return 是否已同步执行，退化为异步派发时返回 false
+     */
+    bool DirectRunOnCurThread(const std::function<void()> &task) {
+        if (m_isExecutingTask.load() || IsCurrentThreadWorkerThread()) {
+            task();  // 当前线程已持有执行权
+            return true;
+        }
+        int64_t queued_us = KRThreadTrace::IsEnabled() ? KRThreadTrace::NowMicros() : 0;
+        if (!m_execToken.AcquireForCaller()) {
+            DispatchAsync(task);
+            return false;
+        }
+        m_isExecutingTask.store(true);  // 设置正在执行任务标志
+        {
+            KRTraceScope trace("DirectRun", "sync", nullptr, queued_us);  // 排队时长即等待执行权的时长
             task();
-        } else {
-            auto start = std::chrono::steady_clock::now();  // 记录开始时间
-            bool didHandleTask = false;
-            while (!SyncMainTaskMutex(false, false, false)) {
-                // 检查是否超时
-                auto now = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-                if (duration.count() > 100) {
-                    break;  // 超时，跳出循环
-                }
-                // 尝试获取互斥锁
-                if (TaskMutex(true, false, false)) {
-                    m_isExecutingTask.store(true);  // 设置正在执行任务标志
-                    task();
-                    m_isExecutingTask.store(false);  // 清除正在执行任务标志
-                    TaskMutex(false, true, false);
-                    didHandleTask = true;
-                    break;  // 任务执行完成，跳出循环
-                }
-            }
-            if (!didHandleTask) {
-                KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
-                DispatchAsync(task);
-            }
         }
+        m_isExecutingTask.store(false);  // 清除正在执行任务标志
+        m_execToken.Release();
+        return true;
     }
 
-    bool TaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_taskMutex);
-        if (try_lock) {
-            if (m_mutex_locked) {
-                return false;
-            } else {
-                m_mutex_locked = true;
-                return true;
-            }
-        }
-        if (is_set) {
-            m_mutex_locked = value;
-        }
-        return m_mutex_locked;
+    /**
+     * 工作线程开始同步等待主线程，期间主线程的同步执行请求退化为异步，避免互相等待
+     */
+    void BeginWaitMainThread() {
+        m_execToken.BeginWaitMainThread();
     }
 
-    bool SyncMainTaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_syncMainTaskMutex);
-        if (try_lock) {
-            if (m_sync_main_task_locked) {
-                return false;
-            } else {
-                m_sync_main_task_locked = true;
-                return true;
-            }
-        }
-        if (is_set) {
-            m_sync_main_task_locked = value;
-        }
-        return m_sync_main_task_locked;
+    void EndWaitMainThread() {
+        m_execToken.EndWaitMainThread();
     }
 
     bool IsCurrentThreadWorkerThread() const {
@@ -147,47 +126,30 @@ class KRThread {
  private:
     void Worker() {
         while (true) {
-            std::queue<std::function<void()>> tasks;
-            {
+            if (!m_lanes.HasPending()) {
                 std::unique_lock<std::mutex> lock(m_mutex);
-                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                m_condition.wait(lock, [this] { return m_stop || m_lanes.HasQueued(); });
 
-                if (m_stop && m_tasks.empty()) {
+                if (m_stop && !m_lanes.HasQueued()) {
                     break;
                 }
-
-                std::swap(tasks, m_tasks);  // 将m_tasks所有任务一次性移动到tasks
             }
-            {
-                if (TaskMutex(true, false, false)) {
-                    while (!tasks.empty()) {
-                        auto &task = tasks.front();
-                        task();
-                        tasks.pop();
-                    }
-                    TaskMutex(false, true, false);
-                } else {
-                    std::unique_lock<std::mutex> lock(m_mutex);
-                    while (!tasks.empty()) {
-                        m_tasks.push(std::move(tasks.front()));
-                        tasks.pop();
-                    }
-                }
+            m_execToken.AcquireForWorker();
+            // 每执行一个任务前重新收取各通道，保证新到的高优先级任务能插队；主线程等待时让出执行权
+            while (m_lanes.Collect() && !m_execToken.HasWaiter()) {
+                m_lanes.RunNext();
             }
+            m_execToken.Release();
         }
     }
 
-    std::queue<std::function<void()>> m_tasks;
-    std::mutex m_mutex;
-    std::mutex m_taskMutex;
-    bool m_mutex_locked = false;
-    std::mutex m_syncMainTaskMutex;
-    bool m_sync_main_task_locked = false;
+    KRTaskLanes m_lanes;           // 各优先级的任务通道
+    std::mutex m_mutex;            // 仅用于工作线程等待
+    KRExecutionToken m_execToken;  // Context 任务执行权，主线程同步执行与工作线程互斥
     std::condition_variable m_condition;
     bool m_stop = false;
     std::thread m_workerThread;
     std::thread::id m_workerThreadId;
-    KRDelayThread *m_delayThread = nullptr;
     std::atomic<bool> m_isExecutingTask{false};
 };
 
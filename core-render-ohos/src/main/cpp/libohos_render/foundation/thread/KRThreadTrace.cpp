@@ -0,0 +1,265 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
+
+#include <pthread.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "libohos_render/utils/KRJSONCodec.h"
+
+namespace {
+
+constexpr size_t kRingCapacity = 4096;  // 需为 2 的幂
+constexpr size_t kInstanceIdSize = 24;
+constexpr size_t kThreadNameSize = 16;
+
+struct TraceEvent {
+    const char *name;
+    const char *category;
+    const char *arg_name;
+    int64_t queued_us;
+    int64_t start_us;
+    int64_t end_us;
+    int64_t arg;
+    char instance_id[kInstanceIdSize];
+};
+
+/**
+ * 单写多读环形缓冲区：每个槽位带序号（写入中为奇数），读者发现序号变化即丢弃该槽位；
+ * 事件按字存放在原子变量中，读写并发时不存在数据竞争
+ */
+struct TraceRing {
+    static constexpr size_t kEventWords = (sizeof(TraceEvent) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint32_t> seq{0};
+        std::atomic<uint64_t> words[kEventWords];
+    };
+
+    Slot slots[kRingCapacity];
+    std::atomic<uint64_t> write_index{0};
+    int tid = 0;
+    char thread_name[kThreadNameSize] = {};
+
+    void Write(const TraceEvent &event) {
+        uint64_t words[kEventWords] = {};
+        memcpy(words, &event, sizeof(TraceEvent));
+        uint64_t index = write_index.load(std::memory_order_relaxed);
+        Slot &slot = slots[index & (kRingCapacity - 1)];
+        uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kEventWords; i++) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.seq.store(seq + 2, std::memory_order_release);
+        write_index.store(index + 1, std::memory_order_release);
+    }
+
+    template <typename Visitor> void ForEach(Visitor &&visitor) const {
+        uint64_t end = write_index.load(std::memory_order_acquire);
+        uint64_t begin = end > kRingCapacity ? end - kRingCapacity : 0;
+        for (uint64_t i = begin; i < end; i++) {
+            const Slot &slot = slots[i & (kRingCapacity - 1)];
+            uint32_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq & 1) {
+                continue;
+            }
+            uint64_t words[kEventWords];
+            for (size_t w = 0; w < kEventWords; w++) {
+                words[w] = slot.words[w].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq) {
+                continue;  // 读取期间被覆盖
+            }
+            TraceEvent event;
+            memcpy(&event, words, sizeof(TraceEvent));
+            visitor(event);
+        }
+    }
+};
+
+/**
+ * 缓冲区在线程首次记录时创建，进程内不释放，线程退出后仍可导出
+ */
+class TraceRegistry {
+ public:
+    static TraceRegistry &GetInstance() {
+        static TraceRegistry *instance = new TraceRegistry();  // 进程级单例，不析构
+        return *instance;
+    }
+
+    TraceRing *CurrentRing() {
+        thread_local TraceRing *ring = nullptr;
+        if (ring == nullptr) {
+            auto created = std::make_unique<TraceRing>();
+            pthread_getname_np(pthread_self(), created->thread_name, kThreadNameSize);
+            std::lock_guard<std::mutex> lock(mutex_);
+            created->tid = static_cast<int>(rings_.size()) + 1;
+            ring = created.get();
+            rings_.push_back(std::move(created));
+        }
+        return ring;
+    }
+
+    std::vector<TraceRing *> Rings() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TraceRing *> rings;
+        for (auto &ring : rings_) {
+            rings.push_back(ring.get());
+        }
+        return rings;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<TraceRing>> rings_;
+};
+
+}  // namespace
+
+void KRThreadTrace::SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t KRThreadTrace::NowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void KRThreadTrace::Record(const char *name, const char *category, const std::string *instance_id,
+                           int64_t queued_us, int64_t start_us, int64_t end_us, const char *arg_name, int64_t arg) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.arg_name = arg_name;
+    event.queued_us = queued_us;
+    event.start_us = start_us;
+    event.end_us = end_us;
+    event.arg = arg;
+    event.instance_id[0] = '\0';
+    if (instance_id) {
+        size_t length = std::min(instance_id->size(), kInstanceIdSize - 1);
+        memcpy(event.instance_id, instance_id->data(), length);
+        event.instance_id[length] = '\0';
+    }
+    TraceRegistry::GetInstance().CurrentRing()->Write(event);
+}
+
+std::string KRThreadTrace::ToChromeTraceJson() {
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    int pid = static_cast<int>(getpid());
+    writer.BeginObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.Key("traceEvents");
+    writer.BeginArray();
+    for (auto ring : TraceRegistry::GetInstance().Rings()) {
+        writer.BeginObject();
+        writer.Key("name");
+        writer.String("thread_name");
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Int(pid);
+        writer.Key("tid");
+        writer.Int(ring->tid);
+        writer.Key("args");
+        writer.BeginObject();
+        writer.Key("name");
+        writer.String(ring->thread_name);
+        writer.EndObject();
+        writer.EndObject();
+
+        ring->ForEach([&writer, pid, ring](const TraceEvent &event) {
+            writer.BeginObject();
+            writer.Key("name");
+            writer.String(event.name);
+            writer.Key("cat");
+            writer.String(event.category);
+            writer.Key("ph");
+            writer.String("X");
+            writer.Key("ts");
+            writer.Int(event.start_us);
+            writer.Key("dur");
+            writer.Int(event.end_us - event.start_us);
+            writer.Key("pid");
+            writer.Int(pid);
+            writer.Key("tid");
+            writer.Int(ring->tid);
+            writer.Key("args");
+            writer.BeginObject();
+            writer.Key("waitUs");
+            writer.Int(event.start_us - event.queued_us);
+            if (event.instance_id[0] != '\0') {
+                writer.Key("page");
+                writer.String(event.instance_id);
+            }
+            if (event.arg_name) {
+                writer.Key(event.arg_name);
+                writer.Int(event.arg);
+            }
+            writer.EndObject();
+            writer.EndObject();
+        });
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return json;
+}
+
+bool KRThreadTrace::DumpChromeTrace(const std::string &path) {
+    std::string json = ToChromeTraceJson();
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = fwrite(json.data(), 1, json.size(), file) == json.size();
+    fclose(file);
+    return ok;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * 开关线程任务追踪
+ * @param enabled 非0开启
+ */
+void KRSetThreadTraceEnabled(int enabled) {
+    KRThreadTrace::SetEnabled(enabled != 0);
+}
+
+/**
+ * 导出线程任务追踪数据为 Chrome Trace JSON 文件，可用 chrome://tracing 或 Perfetto 打开
+ * @param path 文件路径，需可写（如应用沙箱目录）
+ * @return 成功返回1
+ */
+int KRDumpThreadTrace(const char *path) {
+    return path && KRThreadTrace::DumpChromeTrace(path) ? 1 : 0;
+}
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,98 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTHREADTRACE_H
+#define CORE_RENDER_OHOS_KRTHREADTRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * 线程任务追踪：各线程把任务的排队、执行耗时记录到线程私有的无锁环形缓冲区，可导出为 Chrome Trace（Perfetto）JSON。
+ * 运行时开关，关闭时埋点只有一次原子读。
+ */
+class KRThreadTrace {
+ public:
+    static bool IsEnabled() {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    static void SetEnabled(bool enabled);
+
+    /**
+     * 单调时钟，微秒
+     */
+    static int64_t NowMicros();
+
+    /**
+     * 记录一个已结束的事件，仅在开启时调用
+     * @param name 事件名，需为静态字符串
+     * @param category 分类，需为静态字符串
+     * @param instance_id 所属页面，可为空
+     * @param queued_us 入队时间，不经过排队时与 start_us 相同
+     * @param arg_name 附加参数名，需为静态字符串，可为空
+     */
+    static void Record(const char *name, const char *category, const std::string *instance_id, int64_t queued_us,
+                       int64_t start_us, int64_t end_us, const char *arg_name = nullptr, int64_t arg = 0);
+
+    /**
+     * 导出各线程缓冲区中的事件，可在任意线程调用，不阻塞记录线程
+     */
+    static std::string ToChromeTraceJson();
+
+    static bool DumpChromeTrace(const std::string &path);
+
+ private:
+    static inline std::atomic<bool> enabled_{false};
+};
+
+/**
+ * 作用域事件，析构时记录
+ */
+class KRTraceScope {
+ public:
+    KRTraceScope(const char *name, const char *category, const std::string *instance_id = nullptr,
+                 int64_t queued_us = 0)
+        : name_(name), category_(category), instance_id_(instance_id),
+          start_us_(KRThreadTrace::IsEnabled() ? KRThreadTrace::NowMicros() : 0),
+          queued_us_(queued_us > 0 ? queued_us : start_us_) {}
+
+    ~KRTraceScope() {
+        if (start_us_ > 0) {
+            KRThreadTrace::Record(name_, category_, instance_id_, queued_us_, start_us_, KRThreadTrace::NowMicros(),
+                                  arg_name_, arg_);
+        }
+    }
+
+    void SetArg(const char *arg_name, int64_t arg) {
+        arg_name_ = arg_name;
+        arg_ = arg;
+    }
+
+    KRTraceScope(const KRTraceScope &) = delete;
+    KRTraceScope &operator=(const KRTraceScope &) = delete;
+
+ private:
+    const char *name_;
+    const char *category_;
+    const std::string *instance_id_;
+    int64_t start_us_;
+    int64_t queued_us_;
+    const char *arg_name_ = nullptr;
+    int64_t arg_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTHREADTRACE_H
@@ -0,0 +1,213 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
+
+#include <algorithm>
+#include <vector>
+
+KRTimerWheel &KRTimerWheel::GetInstance() {
+    static KRTimerWheel *instance = new KRTimerWheel();  // 进程内常驻，避免退出时析构顺序问题
+    return *instance;
+}
+
+KRTimerWheel::KRTimerWheel() : epoch_(std::chrono::steady_clock::now()) {
+    thread_ = std::thread([this] { Run(); });
+    pthread_setname_np(thread_.native_handle(), "kuiklytimer");
+}
+
+KRTimerWheel::~KRTimerWheel() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+    for (auto &item : timers_) {
+        delete item.second;
+    }
+}
+
+uint64_t KRTimerWheel::NowTick() const {
+    auto elapsed = std::chrono::steady_clock::now() - epoch_;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
+KRTimerId KRTimerWheel::Schedule(int delayMilliseconds, KRTask task) {
+    uint64_t delay = delayMilliseconds > 0 ? static_cast<uint64_t>(delayMilliseconds) : 0;
+    // 当前时刻向上取整到tick，保证不早于延时触发
+    auto elapsed = std::chrono::steady_clock::now() - epoch_;
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    uint64_t expire_tick = static_cast<uint64_t>((elapsed_us + 999) / 1000) + delay;
+    bool need_wake = false;
+    KRTimerId timer_id;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        timer_id = ++next_id_;
+        auto timer = new Timer{timer_id, expire_tick, std::move(task)};
+        AddTimer(timer);
+        timers_.emplace(timer_id, timer);
+        // 新定时器早于线程预计唤醒时间时才需要唤醒
+        need_wake = timer->expire_tick < wake_tick_;
+    }
+    if (need_wake) {
+        condition_.notify_one();
+    }
+    return timer_id;
+}
+
+bool KRTimerWheel::Cancel(KRTimerId timer_id) {
+    Timer *timer = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = timers_.find(timer_id);
+        if (it == timers_.end()) {
+            return false;
+        }
+        timer = it->second;
+        timers_.erase(it);
+        RemoveTimer(timer);
+    }
+    delete timer;  // 在锁外释放任务闭包捕获的资源
+    return true;
+}
+
+void KRTimerWheel::AddTimer(Timer *timer) {
+    if (timer->expire_tick < current_tick_) {
+        timer->expire_tick = current_tick_;
+    }
+    uint64_t delta = timer->expire_tick - current_tick_;
+    // 超出时间轮范围的定时器先放入最高层的最远槽，下沉时按真实到期时间重新入轮
+    uint64_t place_tick = delta > kMaxDelayTicks ? current_tick_ + kMaxDelayTicks : timer->expire_tick;
+    delta = place_tick - current_tick_;
+    int level = 0;
+    while (level < kLevelCount - 1 && delta >= (1ULL << (kSlotBits * (level + 1)))) {
+        level++;
+    }
+    auto slot = static_cast<uint8_t>((place_tick >> (kSlotBits * level)) & kSlotMask);
+    timer->level = static_cast<uint8_t>(level);
+    timer->slot = slot;
+    timer->prev = slot_tails_[level][slot];
+    timer->next = nullptr;
+    if (timer->prev) {
+        timer->prev->next = timer;
+    } else {
+        slots_[level][slot] = timer;
+    }
+    slot_tails_[level][slot] = timer;
+}
+
+void KRTimerWheel::RemoveTimer(Timer *timer) {
+    if (timer->prev) {
+        timer->prev->next = timer->next;
+    } else {
+        slots_[timer->level][timer->slot] = timer->next;
+    }
+    if (timer->next) {
+        timer->next->prev = timer->prev;
+    } else {
+        slot_tails_[timer->level][timer->slot] = timer->prev;
+    }
+    timer->prev = nullptr;
+    timer->next = nullptr;
+}
+
+void KRTimerWheel::Cascade(int level, uint64_t tick) {
+    auto slot = (tick >> (kSlotBits * level)) & kSlotMask;
+    Timer *timer = slots_[level][slot];
+    slots_[level][slot] = nullptr;
+    slot_tails_[level][slot] = nullptr;
+    while (timer) {
+        Timer *next = timer->next;
+        AddTimer(timer);
+        timer = next;
+    }
+}
+
+uint64_t KRTimerWheel::NextEventTick() const {
+    if (timers_.empty()) {
+        return UINT64_MAX;
+    }
+    uint64_t next_tick = UINT64_MAX;
+    for (int level = 0; level < kLevelCount; level++) {
+        int shift = kSlotBits * level;
+        uint64_t block = current_tick_ >> shift;
+        // 高层槽在其区间起点下沉；当前区间若恰好从current_tick_开始，下沉尚未发生
+        uint64_t first = (level == 0 || (current_tick_ & ((1ULL << shift) - 1)) == 0) ? 0 : 1;
+        for (uint64_t offset = first; offset < first + kSlotCount; offset++) {
+            uint64_t tick = (block + offset) << shift;
+            if (tick >= next_tick) {
+                break;
+            }
+            if (slots_[level][(block + offset) & kSlotMask]) {
+                next_tick = tick;
+                break;
+            }
+        }
+    }
+    return next_tick;
+}
+
+void KRTimerWheel::Run() {
+    std::vector<Timer *> expired;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        uint64_t now_tick = NowTick();
+        uint64_t next_tick = NextEventTick();
+        if (next_tick > now_tick) {
+            // 到now_tick为止没有到期或需要下沉的槽，直接跳过
+            current_tick_ = std::max(current_tick_, now_tick + 1);
+            wake_tick_ = next_tick;
+            if (next_tick == UINT64_MAX) {
+                condition_.wait(lock);
+            } else {
+                condition_.wait_until(lock, epoch_ + std::chrono::milliseconds(next_tick));
+            }
+            wake_tick_ = 0;
+            continue;
+        }
+        current_tick_ = next_tick;
+        for (int level = kLevelCount - 1; level > 0; level--) {
+            if ((current_tick_ & ((1ULL << (kSlotBits * level)) - 1)) == 0) {
+                Cascade(level, current_tick_);
+            }
+        }
+        auto slot = current_tick_ & kSlotMask;
+        Timer *timer = slots_[0][slot];
+        slots_[0][slot] = nullptr;
+        slot_tails_[0][slot] = nullptr;
+        while (timer) {
+            expired.push_back(timer);
+            timers_.erase(timer->id);
+            timer = timer->next;
+        }
+        current_tick_++;
+        if (expired.empty()) {
+            continue;
+        }
+        // 从高层下沉的定时器追加在槽尾，可能排在之后添加、直接落在低层的定时器后面；定时器ID按添加顺序递增
+        auto by_id = [](const Timer *a, const Timer *b) { return a->id < b->id; };
+        if (!std::is_sorted(expired.begin(), expired.end(), by_id)) {
+            std::sort(expired.begin(), expired.end(), by_id);
+        }
+        lock.unlock();
+        for (auto expired_timer : expired) {
+            expired_timer->task();
+            delete expired_timer;
+        }
+        expired.clear();
+        lock.lock();
+    }
+}
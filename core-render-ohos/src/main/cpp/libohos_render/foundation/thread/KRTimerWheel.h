@@ -0,0 +1,99 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTIMERWHEEL_H
+#define CORE_RENDER_OHOS_KRTIMERWHEEL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+using KRTimerId = uint64_t;
+constexpr KRTimerId kKRInvalidTimerId = 0;
+
+/**
+ * 全局分层时间轮：精度 1ms，4 层 × 64 槽，覆盖约 4.6 小时（更长的延时到期前会重新入轮）。
+ * 添加与取消均为 O(1)，同一毫秒到期的定时器在一次唤醒中按添加顺序批量触发，无定时器时线程不会被唤醒。
+ * 定时任务在时间轮线程上执行，只应做线程切换等轻量操作。
+ */
+class KRTimerWheel {
+ public:
+    static KRTimerWheel &GetInstance();
+
+    KRTimerWheel(const KRTimerWheel &) = delete;
+    KRTimerWheel &operator=(const KRTimerWheel &) = delete;
+
+    /**
+     * 添加定时任务
+     * @param delayMilliseconds 延时毫秒，小于等于0时在下一次唤醒立即执行
+     * @param task 到期后在时间轮线程执行的任务
+     * @return 定时器ID，可用于取消
+     */
+    KRTimerId Schedule(int delayMilliseconds, KRTask task);
+
+    /**
+     * 取消尚未触发的定时任务
+     * @return 是否取消成功，已触发或不存在时返回false
+     */
+    bool Cancel(KRTimerId timer_id);
+
+ private:
+    static constexpr int kLevelCount = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlotCount = 1 << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlotCount - 1;
+    static constexpr uint64_t kMaxDelayTicks = (1ULL << (kSlotBits * kLevelCount)) - 1;
+
+    struct Timer {
+        KRTimerId id;
+        uint64_t expire_tick;
+        KRTask task;
+        Timer *prev = nullptr;
+        Timer *next = nullptr;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+    };
+
+    KRTimerWheel();
+    ~KRTimerWheel();
+
+    uint64_t NowTick() const;
+    void Run();
+    void AddTimer(Timer *timer);
+    void RemoveTimer(Timer *timer);
+    void Cascade(int level, uint64_t tick);
+    /**
+     * 下一个需要处理的tick（最近的到期槽或需要下沉的高层槽），无定时器时返回UINT64_MAX
+     */
+    uint64_t NextEventTick() const;
+
+    std::chrono::steady_clock::time_point epoch_;
+    uint64_t current_tick_ = 0;  // 下一个待处理的tick
+    uint64_t wake_tick_ = UINT64_MAX;  // 时间轮线程预计唤醒的tick
+    KRTimerId next_id_ = kKRInvalidTimerId;
+    Timer *slots_[kLevelCount][kSlotCount] = {};
+    Timer *slot_tails_[kLevelCount][kSlotCount] = {};  // 槽内链表尾，新定时器追加在尾部
+    std::unordered_map<KRTimerId, Timer *> timers_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTIMERWHEEL_H
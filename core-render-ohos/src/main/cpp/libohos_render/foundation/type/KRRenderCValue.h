@@ -52,5 +52,6 @@ extern int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin);
 extern const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue arg0, KRRenderCValue arg1,
                                                           KRRenderCValue arg2, KRRenderCValue arg3, KRRenderCValue arg4,
                                                           KRRenderCValue arg5);
+extern void com_tencent_kuikly_CallNativeBatch(const char *pagerId, const uint8_t *buffer, int32_t length);
 }
 #endif  // CORE_RENDER_OHOS_KRRENDERCVALUE_H
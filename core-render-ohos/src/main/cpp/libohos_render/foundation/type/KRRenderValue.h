@@ -24,18 +24,22 @@
 #include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 #include "KRRenderCValue.h"
 #include "libohos_render/foundation/ark_ts.h"
 #include "libohos_render/foundation/type/KRRenderCValue.h"
+#include "libohos_render/utils/KRFixedBlockPool.h"
+#include "libohos_render/utils/KRJSONCodec.h"
 #include "libohos_render/utils/KRJsUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/NAPIUtil.h"
-#include "thirdparty/cJSON/cJSON.h"
 
 // Test cases : 1.0, 100000.0, 9999999900.0, 0.01, 0.020, 0.01234560, 12345670.0123456
 static std::string DoubleToString(double value) {
@@ -67,8 +71,9 @@ struct NapiValue {
  * kotlin 侧与 Render 侧数据通信类型转换类
  * 设计上是一个 AnyValue to AnyValue 类的思想
  * 通过使用 toXX api, 可把值转换为对应的 value
+ * 标量、短字符串（SSO）、数组与二进制均内联存储，体积较大的 Map 放到堆上，转换缓存按需分配
  */
-class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
+class KRRenderValue {
  public:
     using Map = std::unordered_map<std::string, std::shared_ptr<KRRenderValue>>;
     using Array = std::vector<std::shared_ptr<KRRenderValue>>;
@@ -76,8 +81,6 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
 
     KRRenderValue() {
         value_ = std::monostate();
-        json_to_map_or_array_value_ = std::monostate();
-        c_value_.type = KRRenderCValue::Type::NULL_VALUE;
     }
 
     explicit KRRenderValue(std::nullptr_t) : KRRenderValue() {}
@@ -106,18 +109,30 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         value_ = value;
     }
 
+    explicit KRRenderValue(std::string &&value) : KRRenderValue() {
+        value_ = std::move(value);
+    }
+
     explicit KRRenderValue(const char *value) : KRRenderValue() {
         value_ = std::string(value);
     }
 
     explicit KRRenderValue(const Map &value) : KRRenderValue() {
-        value_ = value;
+        value_ = std::make_unique<Map>(value);
+    }
+
+    explicit KRRenderValue(Map &&value) : KRRenderValue() {
+        value_ = std::make_unique<Map>(std::move(value));
     }
 
     explicit KRRenderValue(const Array &value) : KRRenderValue() {
         value_ = value;
     }
 
+    explicit KRRenderValue(Array &&value) : KRRenderValue() {
+        value_ = std::move(value);
+    }
+
     explicit KRRenderValue(const ByteArray &value) : KRRenderValue() {
         value_ = value;
     }
@@ -136,20 +151,17 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (cValue.type == KRRenderCValue::Type::STRING) {
             value_ = std::string(cValue.value.stringValue);
         } else if (cValue.type == KRRenderCValue::Type::BYTES) {
-            auto length = cValue.size;
-            auto start_address = cValue.value.bytesValue;
-            auto bytes = std::make_shared<std::vector<uint8_t>>();
-            for (int i = 0; i < length; i++) {
-                bytes->push_back(*(reinterpret_cast<uint8_t *>(start_address + i)));
-            }
-            value_ = bytes;
+            auto length = cValue.size > 0 ? cValue.size : 0;
+            auto start_address = reinterpret_cast<const uint8_t *>(cValue.value.bytesValue);
+            value_ = std::make_shared<std::vector<uint8_t>>(start_address, start_address + length);
         } else if (cValue.type == KRRenderCValue::Type::ARRAY) {
             auto array_size = cValue.size;
             Array array;
+            array.reserve(array_size > 0 ? array_size : 0);
             for (int i = 0; i < array_size; i++) {
-                array.push_back(std::make_shared<KRRenderValue>(cValue.value.arrayValue[i]));
+                array.push_back(Make(cValue.value.arrayValue[i]));
             }
-            value_ = array;
+            value_ = std::move(array);
         } else {
             value_ = std::monostate();
         }
@@ -296,6 +308,23 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
+    /**
+     * 复用当前对象承载新的标量值并清空转换缓存，仅限持有唯一引用时调用（如批量指令解码）
+     */
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>> void Reset(T value) {
+        value_ = value;
+        cache_.reset();
+    }
+
+    void Reset(std::string_view value) {
+        if (auto str = std::get_if<std::string>(&value_)) {
+            str->assign(value.data(), value.size());  // 复用已有的字符串容量
+        } else {
+            value_ = std::string(value);
+        }
+        cache_.reset();
+    }
+
     bool isNull() const {
         return std::holds_alternative<std::monostate>(value_);
     }
@@ -325,7 +354,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     bool isMap() const {
-        return std::holds_alternative<Map>(value_);
+        return std::holds_alternative<MapPtr>(value_);
     }
 
     bool isArray() const {
@@ -412,74 +441,73 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             return std::get<std::string>(value_);
         }
         if (isBool() || isInt() || isDouble() || isFloat() || isLong()) {  // number to string
+            auto &cache = Cache();
             auto numberString = DoubleToString(toDouble());
             if (numberString == "0") {
-                outputToStringResult_ = std::string("");
-                return outputToStringResult_;
+                cache.output_to_string_result_.clear();
+                return cache.output_to_string_result_;
             }
-            outputToStringResult_ = numberString;
-            return outputToStringResult_;
+            cache.output_to_string_result_ = std::move(numberString);
+            return cache.output_to_string_result_;
         }
         if (isMap() || isArray()) {  // map or array to string
-            cJSON* cjson = toJson( shared_from_this());
-            if(char* p = cJSON_Print(cjson)){
-                outputToStringResult_ = p;
-                cJSON_free(p);
-            }
-            cJSON_Delete(cjson);
-            return outputToStringResult_;
+            // 保持 cJSON_Print 的格式化输出；Long/Float 不再像 cJSON 时代那样截断为 int，按原值输出
+            auto &cache = Cache();
+            cache.output_to_string_result_.clear();
+            kuikly::util::JSONWriter writer(cache.output_to_string_result_, kuikly::util::JSONWriter::Format::kPretty);
+            WriteJson(writer, *this);
+            return cache.output_to_string_result_;
         }
-        outputToStringResult_ = "";
-        return outputToStringResult_;
+        static const std::string kEmptyString;
+        return kEmptyString;
     }
 
     const Map &toMap() const {
         if (isMap()) {
-            return std::get<Map>(value_);
-        } else if (std::holds_alternative<Map>(json_to_map_or_array_value_)) {
-            return std::get<Map>(json_to_map_or_array_value_);
-        } else if (isString()) {
-            cJSON *cjson = cJSON_Parse(toString().c_str());
-            if(cjson == nullptr){
-                json_to_map_or_array_value_ = Map();
-                return std::get<Map>(json_to_map_or_array_value_);
-            }
+            return *std::get<MapPtr>(value_);
+        }
+        if (!isString()) {
+            static const Map kEmptyMap;
+            return kEmptyMap;
+        }
+        auto &cache = Cache();
+        if (!std::holds_alternative<Map>(cache.json_to_map_or_array_value_)) {
             Map map;
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                map[item->string] = fromJsonValue(item);
+            kuikly::util::JSONReader reader(toString());
+            bool success = reader.ReadObject([&reader, &map](std::string_view key) {
+                map.insert_or_assign(std::string(key), ReadJson(reader));
+                return reader.IsValid();
+            });
+            if (!success) {
+                map.clear();
             }
-            cJSON_Delete(cjson);
-            json_to_map_or_array_value_ = map;
-            cJSON_Delete(cjson);
-            return std::get<Map>(json_to_map_or_array_value_);
-        } else {
-            json_to_map_or_array_value_ = Map();
-            return std::get<Map>(json_to_map_or_array_value_);
+            cache.json_to_map_or_array_value_ = std::move(map);
         }
+        return std::get<Map>(cache.json_to_map_or_array_value_);
     }
 
     const Array &toArray() const {
         if (isArray()) {
             return std::get<Array>(value_);
-        } else if (std::holds_alternative<Array>(json_to_map_or_array_value_)) {
-            return std::get<Array>(json_to_map_or_array_value_);
-        } else if (isString()) {
-            cJSON *cjson = cJSON_Parse(toString().c_str());
-            if(cjson == nullptr){
-                json_to_map_or_array_value_ = Array();
-                return std::get<Array>(json_to_map_or_array_value_);
-            }
+        }
+        if (!isString()) {
+            static const Array kEmptyArray;
+            return kEmptyArray;
+        }
+        auto &cache = Cache();
+        if (!std::holds_alternative<Array>(cache.json_to_map_or_array_value_)) {
             Array json_vec;
-            for(int i = 0; i < cJSON_GetArraySize(cjson); ++i){
-                json_vec.push_back(fromJsonValue(cJSON_GetArrayItem(cjson, i)));
+            kuikly::util::JSONReader reader(toString());
+            bool success = reader.ReadArray([&reader, &json_vec](size_t) {
+                json_vec.push_back(ReadJson(reader));
+                return reader.IsValid();
+            });
+            if (!success) {
+                json_vec.clear();
             }
-            json_to_map_or_array_value_ = json_vec;
-            cJSON_Delete(cjson);
-            return std::get<Array>(json_to_map_or_array_value_);
-        } else {
-            json_to_map_or_array_value_ = Array();
-            return std::get<Array>(json_to_map_or_array_value_);
+            cache.json_to_map_or_array_value_ = std::move(json_vec);
         }
+        return std::get<Array>(cache.json_to_map_or_array_value_);
     }
 
     const ByteArray toByteArray() const {
@@ -491,54 +519,60 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     const KRRenderCValue &toCValue() const {
-        if (c_value_.type != KRRenderCValue::Type::NULL_VALUE) {
-            return c_value_;
+        if (isNull()) {
+            static const KRRenderCValue kNullCValue = {KRRenderCValue::Type::NULL_VALUE};
+            return kNullCValue;
+        }
+        auto &cache = Cache();
+        auto &c_value = cache.c_value_;
+        if (c_value.type != KRRenderCValue::Type::NULL_VALUE) {
+            return c_value;
         }
 
         if (isBool()) {
-            c_value_.type = KRRenderCValue::Type::BOOL;
-            c_value_.value.boolValue = toBool() ? 1 : 0;
+            c_value.type = KRRenderCValue::Type::BOOL;
+            c_value.value.boolValue = toBool() ? 1 : 0;
         } else if (isInt()) {
-            c_value_.type = KRRenderCValue::Type::INT;
-            c_value_.value.intValue = toInt();
+            c_value.type = KRRenderCValue::Type::INT;
+            c_value.value.intValue = toInt();
         } else if (isLong()) {
-            c_value_.type = KRRenderCValue::Type::LONG;
-            c_value_.value.longValue = toLong();
+            c_value.type = KRRenderCValue::Type::LONG;
+            c_value.value.longValue = toLong();
         } else if (isFloat()) {
-            c_value_.type = KRRenderCValue::Type::FLOAT;
-            c_value_.value.floatValue = toFloat();
+            c_value.type = KRRenderCValue::Type::FLOAT;
+            c_value.value.floatValue = toFloat();
         } else if (isDouble()) {
-            c_value_.type = KRRenderCValue::Type::DOUBLE;
-            c_value_.value.doubleValue = toDouble();
+            c_value.type = KRRenderCValue::Type::DOUBLE;
+            c_value.value.doubleValue = toDouble();
         } else if (isString()) {
-            c_value_.type = KRRenderCValue::Type::STRING;
-            c_value_.value.stringValue = const_cast<char *>(toString().c_str());
+            c_value.type = KRRenderCValue::Type::STRING;
+            c_value.value.stringValue = const_cast<char *>(toString().c_str());
         } else if (isByteArray()) {
-            c_value_.type = KRRenderCValue::Type::BYTES;
+            c_value.type = KRRenderCValue::Type::BYTES;
             auto byte_array = std::get<ByteArray>(value_).get();
-            c_value_.size = byte_array->size();
-            c_value_.value.bytesValue = reinterpret_cast<char *>(byte_array->data());
+            c_value.size = byte_array->size();
+            c_value.value.bytesValue = reinterpret_cast<char *>(byte_array->data());
         } else if (isMap()) {
             ToJsonMapOrArray();
         } else if (isArray()) {
             auto &array = toArray();
             if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
-                c_value_.type = KRRenderCValue::Type::ARRAY;
-                c_value_.size = array.size();
-                array_ptr_ = new KRRenderCValue[c_value_.size];
-                for (int i = 0; i < c_value_.size; i++) {
+                c_value.type = KRRenderCValue::Type::ARRAY;
+                c_value.size = array.size();
+                cache.array_ptr_.reset(new KRRenderCValue[c_value.size]);
+                for (int i = 0; i < c_value.size; i++) {
                     auto &item = array[i];
-                    array_ptr_[i] = item->toCValue();
+                    cache.array_ptr_[i] = item->toCValue();
                 }
-                c_value_.value.arrayValue = array_ptr_;
+                c_value.value.arrayValue = cache.array_ptr_.get();
             } else {
                 ToJsonMapOrArray();
             }
         } else {
-            c_value_.type = KRRenderCValue::Type::NULL_VALUE;
+            c_value.type = KRRenderCValue::Type::NULL_VALUE;
         }
 
-        return c_value_;
+        return c_value;
     }
 
     void ToJsVmValue(JSVM_Env js_env, JSVM_Value *js_value, JSVM_Status &js_status) const {
@@ -644,53 +678,66 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
-    ~KRRenderValue() {
-        if (array_ptr_) {
-            delete[] array_ptr_;
-            array_ptr_ = nullptr;
-        }
+    ~KRRenderValue() = default;
+
+    /**
+     * 从内存块池构造共享值，控制块与对象一次分配且释放后复用，用于桥接参数等高频短生命周期的值
+     */
+    template <typename... Args>
+    static std::shared_ptr<KRRenderValue> Make(Args &&...args) {
+        return std::allocate_shared<KRRenderValue>(KRPoolAllocator<KRRenderValue>(), std::forward<Args>(args)...);
     }
 
  private:
-    std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, Map, Array, void *, ByteArray,
+    using MapPtr = std::unique_ptr<Map>;
+    std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, MapPtr, Array, ByteArray,
                  NapiValue>
         value_;
-    mutable std::string map_or_array_json_value_;  // 缓存经过序列化的 map或者 array, 用于缓存经过序列化的std::string
-    mutable KRRenderCValue c_value_;
-    mutable std::variant<std::monostate, Map, Array> json_to_map_or_array_value_;
-    mutable std::string outputToStringResult_;
-    mutable KRRenderCValue *array_ptr_ = nullptr;  // 指向数组的指针, 用于防止数组元素copy
+    /**
+     * 类型转换结果缓存，仅在首次发生转换时分配，使桥接调用中大量的标量与短字符串值保持紧凑
+     */
+    struct ConversionCache {
+        ConversionCache() {
+            c_value_.type = KRRenderCValue::Type::NULL_VALUE;
+        }
+        std::string map_or_array_json_value_;  // 缓存经过序列化的 map或者 array, 用于缓存经过序列化的std::string
+        KRRenderCValue c_value_;
+        std::variant<std::monostate, Map, Array> json_to_map_or_array_value_;
+        std::string output_to_string_result_;
+        std::unique_ptr<KRRenderCValue[]> array_ptr_;  // 指向数组的指针, 用于防止数组元素copy
+    };
+    mutable std::unique_ptr<ConversionCache> cache_;
+
+    ConversionCache &Cache() const {
+        if (!cache_) {
+            cache_ = std::make_unique<ConversionCache>();
+        }
+        return *cache_;
+    }
+
+    const std::string &SerializeMapOrArray() const {
+        auto &json = Cache().map_or_array_json_value_;
+        json.clear();
+        kuikly::util::JSONWriter writer(json);
+        WriteJson(writer, *this);
+        return json;
+    }
 
     const void ToJsonMapOrArray() const {
-        cJSON* cjson = toJson( shared_from_this());
-        char* p = cJSON_PrintUnformatted(cjson);
-        map_or_array_json_value_ = p;
-        c_value_.type = KRRenderCValue::Type::STRING;
-        c_value_.value.stringValue = const_cast<char *>(map_or_array_json_value_.c_str());
-        cJSON_free(p);
-        cJSON_Delete(cjson);
+        auto &json = SerializeMapOrArray();
+        auto &cache = Cache();
+        cache.c_value_.type = KRRenderCValue::Type::STRING;
+        cache.c_value_.value.stringValue = const_cast<char *>(json.c_str());
     }
 
     const JSVM_Status ToJsonMapOrArray(JSVM_Env js_env, JSVM_Value *js_value) const {
-        cJSON* cjson = toJson( shared_from_this());
-        if(char* p = cJSON_PrintUnformatted(cjson)){
-            map_or_array_json_value_ = p;
-            cJSON_free(p);
-        }
-        cJSON_Delete(cjson);
-        return OH_JSVM_CreateStringUtf8(js_env, map_or_array_json_value_.c_str(), map_or_array_json_value_.length(),
-                                        js_value);
+        auto &json = SerializeMapOrArray();
+        return OH_JSVM_CreateStringUtf8(js_env, json.c_str(), json.length(), js_value);
     }
 
     const napi_status ToJsonMapOrArray(const napi_env &env, napi_value *nvalue) const {
-        cJSON* cjson = toJson( shared_from_this());
-        if(char* p = cJSON_PrintUnformatted(cjson)){
-            map_or_array_json_value_ = p;
-            cJSON_free(p);
-        }
-        cJSON_Delete(cjson);
-        return napi_create_string_utf8(env, map_or_array_json_value_.c_str(), map_or_array_json_value_.length(),
-                                       nvalue);
+        auto &json = SerializeMapOrArray();
+        return napi_create_string_utf8(env, json.c_str(), json.length(), nvalue);
     }
 
     const bool HadByteArrayElement(const Array &array) const {
@@ -701,66 +748,76 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
         return false;
     }
-    static cJSON *toJson(const std::shared_ptr<const KRRenderValue> &value) {
-        if (value->isMap()) {
-            cJSON* obj = cJSON_CreateObject();
-            const auto &map = value->toMap();
-            for (const auto &entry : map) {
-                cJSON* child = toJson(entry.second);
-                cJSON_AddItemToObject(obj, entry.first.c_str(), child);
+    static void WriteJson(kuikly::util::JSONWriter &writer, const KRRenderValue &value) {
+        if (value.isMap()) {
+            writer.BeginObject();
+            for (const auto &entry : value.toMap()) {
+                writer.Key(entry.first);
+                WriteJson(writer, *entry.second);
             }
-            return obj;
-        } else if (value->isArray()) {
-            cJSON* arr = cJSON_CreateArray();
-            const auto &array = value->toArray();
-            for (const auto &element : array) {
-                cJSON* child = toJson( element);
-                cJSON_AddItemToArray(arr, child);
+            writer.EndObject();
+        } else if (value.isArray()) {
+            writer.BeginArray();
+            for (const auto &element : value.toArray()) {
+                WriteJson(writer, *element);
             }
-            return arr;
-        } else if (value->isBool()) {
-            return cJSON_CreateBool(value->toBool());
-        } else if (value->isInt()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isLong()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isFloat()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isDouble()) {
-            return cJSON_CreateNumber(value->toDouble());
-        } else if (value->isString()) {
-            return cJSON_CreateString(value->toString().c_str());
+            writer.EndArray();
+        } else if (value.isBool()) {
+            writer.Bool(value.toBool());
+        } else if (value.isInt()) {
+            writer.Int(value.toInt());
+        } else if (value.isLong()) {
+            writer.Int(value.toLong());
+        } else if (value.isFloat() || value.isDouble()) {
+            writer.Double(value.toDouble());
+        } else if (value.isString()) {
+            writer.String(value.toString());
         } else {
-            return cJSON_CreateNull();
+            writer.Null();
         }
     }
 
-    static std::shared_ptr<KRRenderValue> fromJsonValue(const cJSON *cjson) {
-        if(cjson == nullptr){
-            return std::make_shared<KRRenderValue>();;
-        }
-        if (cJSON_IsBool(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_IsTrue(cjson));
-        } else if (cJSON_IsNumber(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_GetNumberValue(cjson));
-        } else if (cJSON_IsString(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_GetStringValue(cjson));
-        } else if (cJSON_IsObject(cjson)) {
-            Map map_obj;
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                map_obj[item->string] = fromJsonValue(item);
+    static std::shared_ptr<KRRenderValue> ReadJson(kuikly::util::JSONReader &reader) {
+        using ValueType = kuikly::util::JSONReader::ValueType;
+        switch (reader.PeekType()) {
+            case ValueType::kBool: {
+                bool value = false;
+                reader.ReadBool(value);
+                return Make(value);
             }
-            return std::make_shared<KRRenderValue>(map_obj);
-        } else if (cJSON_IsArray(cjson)) {
-            Array vec_obj;
-            for(int i = 0; i < cJSON_GetArraySize(cjson); ++i){
-                vec_obj.push_back(fromJsonValue(cJSON_GetArrayItem(cjson, i)));
+            case ValueType::kNumber: {
+                double value = 0;
+                reader.ReadNumber(value);
+                return Make(value);
             }
-            return std::make_shared<KRRenderValue>(vec_obj);
-        } else {
-            return std::make_shared<KRRenderValue>();  // Null JSValue
+            case ValueType::kString: {
+                std::string value;
+                reader.ReadString(value);
+                return Make(std::move(value));
+            }
+            case ValueType::kObject: {
+                Map map_obj;
+                reader.ReadObject([&reader, &map_obj](std::string_view key) {
+                    map_obj.insert_or_assign(std::string(key), ReadJson(reader));
+                    return reader.IsValid();
+                });
+                return Make(std::move(map_obj));
+            }
+            case ValueType::kArray: {
+                Array vec_obj;
+                reader.ReadArray([&reader, &vec_obj](size_t) {
+                    vec_obj.push_back(ReadJson(reader));
+                    return reader.IsValid();
+                });
+                return Make(std::move(vec_obj));
+            }
+            default:
+                reader.ReadNull();
+                return Make();  // Null JSValue
         }
     }
 };
 
+static_assert(sizeof(KRRenderValue) <= 48, "KRRenderValue should stay compact, keep large members out of line");
+
 #endif  // CORE_RENDER_OHOS_KRRENDERVALUE_H
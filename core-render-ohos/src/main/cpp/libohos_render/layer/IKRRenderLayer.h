@@ -26,6 +26,7 @@
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/view/IKRRenderView.h"
 
 class IKRRenderLayer {
@@ -60,18 +61,20 @@ class IKRRenderLayer {
     /**
      * 设置渲染视图属性
      * @param tag 视图 ID
+     * @param prop_id 桥接层解析好的内置属性 ID
      * @param propKey 属性 key
      * @param propValue 属性值
      */
-    virtual void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
+    virtual void SetProp(int tag, KRPropKey prop_id, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
 
     /**
      * 设置渲染视图事件
      * @param tag 视图 ID
+     * @param prop_id 桥接层解析好的内置属性 ID
      * @param propKey 属性 key
      * @param propValue 事件
      */
-    virtual void SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) = 0;
+    virtual void SetEvent(int tag, KRPropKey prop_id, const std::string &prop_key, const KRRenderCallback &callback) = 0;
 
     /**
      * 设置 view 对应的 shadow 对象
@@ -15,6 +15,9 @@
 
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 
+#include <chrono>
+#include "libohos_render/foundation/thread/KRMainThread.h"
+
 /**
  * 初始化
  * @param rootView 渲染根容器view
@@ -23,6 +26,11 @@ void KRRenderLayerHandler::Init(std::weak_ptr<IKRRenderView> root_view,
                                 std::shared_ptr<KRRenderContextParams> &context) {
     context_ = context;
     root_view_ = root_view;
+    if (auto root = root_view.lock()) {
+        if (auto performance_manager = root->GetPerformanceManager()) {
+            bridge_stats_ = performance_manager->GetBridgeStats();
+        }
+    }
 }
 
 /**
@@ -79,9 +87,8 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
     } else {
         // 触摸事件分发子系统涉及多个子系统，存在衔接问题，表现上5.0.0.102版本后比较容易出现节点析构后系统内部会因为事件派发出现crash，
         // 这里暂时做个兜底，延缓两帧再销毁view，后续系统OK后再恢复回来。
-        KRContextScheduler::ScheduleTask(false, 32, [view]() {
-            KRContextScheduler::ScheduleTaskOnMainThread(false, [view]() { view->ToDestroy(); });
-        });
+        // 直接在主线程延时销毁，不占用 Context 线程，也不受页面销毁后丢弃任务的影响
+        KRMainThread::RunOnMainThread([view]() { view->ToDestroy(); }, 32);
     }
 }
 
@@ -109,26 +116,30 @@ void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, in
 /**
  * 设置渲染视图属性
  * @param tag 视图 ID
+ * @param prop_id 内置属性 ID
  * @param propKey 属性 key
  * @param propValue 属性值
  */
-void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
+void KRRenderLayerHandler::SetProp(int tag, KRPropKey prop_id, const std::string &prop_key,
+                                   const KRAnyValue &prop_value) {
     auto &view = view_registry_[tag];
     if (view != nullptr) {
-        view->ToSetProp(prop_key, prop_value, nullptr);
+        view->ToSetProp(prop_key, prop_value, nullptr, prop_id);
     }
 }
 
 /**
  * 设置渲染视图事件
  * @param tag 视图 ID
+ * @param prop_id 内置属性 ID
  * @param propKey 属性 key
  * @param propValue 事件
  */
-void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) {
+void KRRenderLayerHandler::SetEvent(int tag, KRPropKey prop_id, const std::string &prop_key,
+                                    const KRRenderCallback &callback) {
     auto &view = view_registry_[tag];
     if (view != nullptr) {
-        view->ToSetProp(prop_key, nullptr, callback);
+        view->ToSetProp(prop_key, nullptr, callback, prop_id);
     }
 }
 
@@ -180,7 +191,15 @@ KRAnyValue KRRenderLayerHandler::CallModuleMethod(bool sync, const std::string &
                                                   bool callback_keep_alive) {
     auto module = GetModuleOrCreate(module_name);
     if (module != nullptr) {
-        return module->CallMethod(sync, method, params, callback, callback_keep_alive);
+        if (!bridge_stats_) {
+            return module->CallMethod(sync, method, params, callback, callback_keep_alive);
+        }
+        auto start = std::chrono::steady_clock::now();
+        auto result = module->CallMethod(sync, method, params, callback, callback_keep_alive);
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        bridge_stats_->RecordModuleMethod(module_name, method, sync, latency.count(),
+                                          KRBridgeStats::PayloadBytes(params));
+        return result;
     }
     return std::make_shared<KRRenderValue>(nullptr);
 }
@@ -19,6 +19,7 @@
 #include <shared_mutex>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/performance/KRBridgeStats.h"
 
 class KRRenderLayerHandler : public IKRRenderLayer {
  public:
@@ -56,7 +57,7 @@ class KRRenderLayerHandler : public IKRRenderLayer {
      * @param propKey 属性 key
      * @param propValue 属性值
      */
-    void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) override;
+    void SetProp(int tag, KRPropKey prop_id, const std::string &prop_key, const KRAnyValue &prop_value) override;
 
     /**
      * 设置渲染视图事件
@@ -64,7 +65,7 @@ class KRRenderLayerHandler : public IKRRenderLayer {
      * @param propKey 属性 key
      * @param propValue 事件
      */
-    void SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) override;
+    void SetEvent(int tag, KRPropKey prop_id, const std::string &prop_key, const KRRenderCallback &callback) override;
 
     /**
      * 设置 view 对应的 shadow 对象
@@ -190,6 +191,7 @@ class KRRenderLayerHandler : public IKRRenderLayer {
     std::unordered_map<int, std::shared_ptr<IKRRenderShadowExport>> shadow_registry_;
     mutable std::shared_mutex module_rw_mutex_;  // 用于module读写安全用的读写锁
     bool destroying_ = false;
+    std::shared_ptr<KRBridgeStats> bridge_stats_;  // Kotlin调用Module方法统计，由页面性能管理器持有
 
     /** 从复用队列中弹出一个view */
     std::shared_ptr<IKRRenderViewExport> PopViewFromReuseQueue(const std::string &view_name);
@@ -0,0 +1,224 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/performance/KRBridgeStats.h"
+
+#include <functional>
+#include <map>
+
+namespace {
+// 下标为 KuiklyRenderNativeMethod 的数值
+const char *kNativeMethodNames[] = {
+    "unknown",
+    "createRenderView",
+    "removeRenderView",
+    "insertSubRenderView",
+    "setViewProp",
+    "setRenderViewFrame",
+    "calculateRenderViewSize",
+    "callViewMethod",
+    "callModuleMethod",
+    "createShadow",
+    "removeShadow",
+    "setShadowProp",
+    "setShadowForView",
+    "setTimeout",
+    "callShadowMethod",
+    "fireFatalException",
+    "syncFlushUI",
+    "callTDFNativeMethod",
+};
+
+size_t BucketIndex(int64_t latency_ns, size_t bucket_count) {
+    size_t index = 0;
+    auto value = static_cast<uint64_t>(latency_ns > 0 ? latency_ns : 0);
+    while (value > 0 && index + 1 < bucket_count) {
+        value >>= 1;
+        index++;
+    }
+    return index;  // 第 i 桶覆盖 [2^(i-1), 2^i) ns
+}
+}  // namespace
+
+void KRBridgeStats::MethodStats::Record(bool sync, int64_t latency_ns, size_t payload_bytes) {
+    count_.fetch_add(1, std::memory_order_relaxed);
+    if (sync) {
+        sync_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    total_ns_.fetch_add(static_cast<uint64_t>(latency_ns > 0 ? latency_ns : 0), std::memory_order_relaxed);
+    payload_bytes_.fetch_add(payload_bytes, std::memory_order_relaxed);
+    buckets_[BucketIndex(latency_ns, kBucketCount)].fetch_add(1, std::memory_order_relaxed);
+}
+
+double KRBridgeStats::MethodStats::P99Us() const {
+    uint64_t counts[kBucketCount];
+    uint64_t total = 0;
+    for (size_t i = 0; i < kBucketCount; i++) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t threshold = total - total / 100;  // 至少覆盖 99% 的调用
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < kBucketCount; i++) {
+        accumulated += counts[i];
+        if (accumulated >= threshold) {
+            return static_cast<double>(uint64_t(1) << i) / 1000.0;
+        }
+    }
+    return static_cast<double>(uint64_t(1) << (kBucketCount - 1)) / 1000.0;
+}
+
+void KRBridgeStats::MethodStats::WriteJson(kuikly::util::JSONWriter &writer) const {
+    auto count = count_.load(std::memory_order_relaxed);
+    auto total_ns = total_ns_.load(std::memory_order_relaxed);
+    writer.BeginObject();
+    writer.Key("count");
+    writer.Int(count);
+    writer.Key("syncCount");
+    writer.Int(sync_count_.load(std::memory_order_relaxed));
+    writer.Key("totalMs");
+    writer.Double(total_ns / 1e6);
+    writer.Key("avgUs");
+    writer.Double(count > 0 ? total_ns / 1e3 / count : 0);
+    writer.Key("p99Us");
+    writer.Double(P99Us());
+    writer.Key("payloadBytes");
+    writer.Int(payload_bytes_.load(std::memory_order_relaxed));
+    writer.EndObject();
+}
+
+void KRBridgeStats::RecordNativeMethod(int method, bool sync, int64_t latency_ns, size_t payload_bytes) {
+    if (method < 0 || method >= static_cast<int>(kNativeMethodCount)) {
+        method = 0;
+    }
+    native_methods_[method].Record(sync, latency_ns, payload_bytes);
+}
+
+void KRBridgeStats::RecordModuleMethod(const std::string &module_name, const std::string &method, bool sync,
+                                       int64_t latency_ns, size_t payload_bytes) {
+    std::hash<std::string_view> hasher;
+    size_t hash = hasher(module_name) * 31 + hasher(method);
+    MethodStats *stats = FindModuleMethod(hash, module_name, method);
+    if (!stats) {
+        stats = CreateModuleMethod(hash, module_name, method);
+    }
+    stats->Record(sync, latency_ns, payload_bytes);
+}
+
+KRBridgeStats::MethodStats *KRBridgeStats::FindModuleMethod(size_t hash, std::string_view module_name,
+                                                            std::string_view method) const {
+    for (size_t i = 0; i < kModuleMethodSlotCount; i++) {
+        auto entry = module_method_slots_[(hash + i) & (kModuleMethodSlotCount - 1)].load(std::memory_order_acquire);
+        if (!entry) {
+            return nullptr;
+        }
+        if (entry->hash == hash && entry->method == method && entry->module_name == module_name) {
+            return &entry->stats;
+        }
+    }
+    return nullptr;
+}
+
+KRBridgeStats::MethodStats *KRBridgeStats::CreateModuleMethod(size_t hash, const std::string &module_name,
+                                                              const std::string &method) {
+    std::lock_guard<std::mutex> lock(module_mutex_);
+    if (auto stats = FindModuleMethod(hash, module_name, method)) {
+        return stats;  // 其他线程已创建
+    }
+    if (module_method_entries_.size() >= kMaxModuleMethodCount) {
+        return &other_module_methods_;
+    }
+    auto entry = std::unique_ptr<ModuleMethodEntry>(new ModuleMethodEntry{hash, module_name, method, {}});
+    for (size_t i = 0; i < kModuleMethodSlotCount; i++) {
+        auto &slot = module_method_slots_[(hash + i) & (kModuleMethodSlotCount - 1)];
+        if (!slot.load(std::memory_order_relaxed)) {
+            slot.store(entry.get(), std::memory_order_release);
+            break;
+        }
+    }
+    module_method_entries_.push_back(std::move(entry));
+    return &module_method_entries_.back()->stats;
+}
+
+std::string KRBridgeStats::ToJson() const {
+    std::string json;
+    kuikly::util::JSONWriter writer(json);
+    writer.BeginObject();
+    writer.Key("nativeMethods");
+    writer.BeginObject();
+    for (size_t i = 0; i < kNativeMethodCount; i++) {
+        if (native_methods_[i].Count() == 0) {
+            continue;
+        }
+        writer.Key(kNativeMethodNames[i]);
+        native_methods_[i].WriteJson(writer);
+    }
+    writer.EndObject();
+    writer.Key("modules");
+    writer.BeginObject();
+    std::map<std::string_view, std::map<std::string_view, const MethodStats *>> modules;
+    for (const auto &slot : module_method_slots_) {
+        if (auto entry = slot.load(std::memory_order_acquire)) {
+            modules[entry->module_name][entry->method] = &entry->stats;
+        }
+    }
+    for (const auto &module : modules) {
+        writer.Key(module.first);
+        writer.BeginObject();
+        for (const auto &method : module.second) {
+            writer.Key(method.first);
+            method.second->WriteJson(writer);
+        }
+        writer.EndObject();
+    }
+    writer.EndObject();
+    if (other_module_methods_.Count() > 0) {
+        writer.Key("otherModuleMethods");
+        other_module_methods_.WriteJson(writer);
+    }
+    writer.EndObject();
+    return json;
+}
+
+size_t KRBridgeStats::PayloadBytes(const std::shared_ptr<KRRenderValue> &value) {
+    if (!value || value->isNull()) {
+        return 0;
+    }
+    if (value->isString()) {
+        return value->toString().size();
+    }
+    if (value->isByteArray()) {
+        auto bytes = value->toByteArray();
+        return bytes ? bytes->size() : 0;
+    }
+    if (value->isMap()) {
+        size_t bytes = 0;
+        for (const auto &item : value->toMap()) {
+            bytes += item.first.size() + PayloadBytes(item.second);
+        }
+        return bytes;
+    }
+    if (value->isArray()) {
+        size_t bytes = 0;
+        for (const auto &item : value->toArray()) {
+            bytes += PayloadBytes(item);
+        }
+        return bytes;
+    }
+    return sizeof(int64_t);
+}
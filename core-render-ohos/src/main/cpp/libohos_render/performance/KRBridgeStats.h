@@ -0,0 +1,97 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBRIDGESTATS_H
+#define CORE_RENDER_OHOS_KRBRIDGESTATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+/**
+ * 页面级 Kotlin -> Native 调用统计，按 KuiklyRenderNativeMethod 及 Module 方法分别累计，
+ * 可在 Context 线程与主线程并发记录
+ */
+class KRBridgeStats {
+ public:
+    /**
+     * 单个方法的统计，记录为无锁原子操作；耗时按 2 的幂分桶，p99 取所在桶上界的近似值
+     */
+    class MethodStats {
+     public:
+        void Record(bool sync, int64_t latency_ns, size_t payload_bytes);
+        uint64_t Count() const {
+            return count_.load(std::memory_order_relaxed);
+        }
+        void WriteJson(kuikly::util::JSONWriter &writer) const;
+
+     private:
+        static constexpr size_t kBucketCount = 32;  // 最后一桶为 >= 2^30ns
+        double P99Us() const;
+
+        std::atomic<uint64_t> count_{0};
+        std::atomic<uint64_t> sync_count_{0};
+        std::atomic<uint64_t> total_ns_{0};
+        std::atomic<uint64_t> payload_bytes_{0};
+        std::atomic<uint64_t> buckets_[kBucketCount] = {};
+    };
+
+    /**
+     * @param method KuiklyRenderNativeMethod 的数值
+     */
+    void RecordNativeMethod(int method, bool sync, int64_t latency_ns, size_t payload_bytes);
+    /**
+     * 每个 (module, method) 仅首次记录时加锁创建统计项，之后无锁查找并累计
+     */
+    void RecordModuleMethod(const std::string &module_name, const std::string &method, bool sync,
+                            int64_t latency_ns, size_t payload_bytes);
+    std::string ToJson() const;
+
+    /**
+     * 估算参数字节数：字符串与字节数组取长度，数值按 8 字节计，Map/Array 按键与元素递归累计
+     */
+    static size_t PayloadBytes(const std::shared_ptr<KRRenderValue> &value);
+
+ private:
+    static constexpr size_t kNativeMethodCount = 18;  // 与 KuiklyRenderNativeMethod 对应
+    static constexpr size_t kModuleMethodSlotCount = 256;  // 需为 2 的幂
+    static constexpr size_t kMaxModuleMethodCount = kModuleMethodSlotCount * 3 / 4;  // 超出后并入 others
+
+    struct ModuleMethodEntry {
+        size_t hash;
+        std::string module_name;
+        std::string method;
+        MethodStats stats;
+    };
+
+    /**
+     * 开放寻址表，条目发布后不再修改与释放，读者无锁查找
+     */
+    MethodStats *FindModuleMethod(size_t hash, std::string_view module_name, std::string_view method) const;
+    MethodStats *CreateModuleMethod(size_t hash, const std::string &module_name, const std::string &method);
+
+    MethodStats native_methods_[kNativeMethodCount];
+    std::atomic<ModuleMethodEntry *> module_method_slots_[kModuleMethodSlotCount] = {};
+    std::mutex module_mutex_;  // 仅创建条目时使用
+    std::vector<std::unique_ptr<ModuleMethodEntry>> module_method_entries_;
+    MethodStats other_module_methods_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRBRIDGESTATS_H
@@ -31,6 +31,10 @@ KRPerformanceData::KRPerformanceData(std::string page_name, int excute_mode, int
     : page_name_(page_name), excute_mode_(excute_mode), spent_time_(spent_time), is_cold_launch_(is_cold_launch),
       is_page_cold_launch_(is_page_cold_launch), launch_data_(launch_data) {}
 
+void KRPerformanceData::AddStats(const std::string &name, const std::string &stats_json) {
+    extra_stats_.emplace_back(name, stats_json);
+}
+
 std::string KRPerformanceData::ToJsonString() {
     cJSON *performance_data = cJSON_CreateObject();
     cJSON_AddNumberToObject(performance_data, kKeyMode, excute_mode_);
@@ -38,6 +42,9 @@ std::string KRPerformanceData::ToJsonString() {
     cJSON_AddBoolToObject(performance_data, kKeyIsFirstPageProcess, is_cold_launch_);
     cJSON_AddBoolToObject(performance_data, kKeyIsFirstPageLaunch, is_page_cold_launch_);
     cJSON_AddStringToObject(performance_data, kKeyPageLoadTime, launch_data_.c_str());
+    for (const auto &stats : extra_stats_) {
+        cJSON_AddRawToObject(performance_data, stats.first.c_str(), stats.second.c_str());
+    }
     std::string result = cJSON_Print(performance_data);
     cJSON_Delete(performance_data);
     return result;
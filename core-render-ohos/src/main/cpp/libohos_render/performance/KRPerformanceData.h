@@ -17,6 +17,8 @@
 #define CORE_RENDER_OHOS_KRPERFORMANCEDATA_H
 
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * 该类用于组织所有性能采集的数据对外输出
@@ -25,6 +27,12 @@ class KRPerformanceData {
  public:
     KRPerformanceData(std::string page_name, int excute_mode, int spent_time, bool is_cold_launch,
                       bool is_page_cold_launch, std::string lanch_data);
+    /**
+     * 追加统计数据（缓存、线程池、调用统计等）
+     * @param name 统计项名称，作为输出 JSON 的 key
+     * @param stats_json 统计数据 JSON 字符串
+     */
+    void AddStats(const std::string &name, const std::string &stats_json);
     std::string ToJsonString();
 
  private:
@@ -34,5 +42,6 @@ class KRPerformanceData {
     bool is_page_cold_launch_;
     int excute_mode_;
     std::string launch_data_ = "{}";
+    std::vector<std::pair<std::string, std::string>> extra_stats_;
 };
 #endif  // CORE_RENDER_OHOS_KRPERFORMANCEDATA_H
@@ -15,8 +15,20 @@
 
 #include "KRPerformanceManager.h"
 
+#include "libohos_render/expand/components/apng/APNGCache.h"
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+#include "libohos_render/expand/modules/cache/KRImageMemoryCache.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
 #include "libohos_render/performance/KRPerformanceData.h"
 
+constexpr char kKeyApngCache[] = "apngCache";
+constexpr char kKeyImageCache[] = "imageCache";
+constexpr char kKeyBackgroundQueue[] = "backgroundQueue";
+constexpr char kKeyBridge[] = "bridge";
+constexpr char kKeyTextMeasureCache[] = "textMeasureCache";
+constexpr char kKeyFont[] = "font";
+
 bool KRPerformanceManager::cold_launch_flag = true;
 std::list<std::string> KRPerformanceManager::page_record_;
 
@@ -108,6 +120,12 @@ std::string KRPerformanceManager::GetPerformanceData() {  //  收集所有性能
         KRPerformanceData performance =
             KRPerformanceData(page_name_, kuikly_core_mode_value, spent_time, is_cold_launch, is_page_cold_launch,
                               monitor->GetMonitorData());
+        performance.AddStats(kKeyApngCache, APNGCache::GetInstance().GetStatsJson());
+        performance.AddStats(kKeyImageCache, KRImageMemoryCache::GetInstance().GetStatsJson());
+        performance.AddStats(kKeyBackgroundQueue, KRGCDQueue::GetInstance().GetStatsJson());
+        performance.AddStats(kKeyBridge, bridge_stats_->ToJson());
+        performance.AddStats(kKeyTextMeasureCache, KRTextMeasureCache::GetInstance().GetStatsJson());
+        performance.AddStats(kKeyFont, KRFontCollectionManager::GetInstance()->GetStatsJson());
         return performance.ToJsonString();
     }
     return "{}";
@@ -20,6 +20,7 @@
 #include <string>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/expand/modules/performance/KRPageCreateTrace.h"
+#include "libohos_render/performance/KRBridgeStats.h"
 #include "libohos_render/performance/launch/KRLaunchMonitor.h"
 
 enum class MonitorType { kLaunch = 0, KFrame = 1, KMemory = 2 };
@@ -43,6 +44,9 @@ class KRPerformanceManager {
     std::string GetPerformanceData();
     std::shared_ptr<KRMonitor> GetMonitor(std::string monitor_name);
     void SetArkLaunchTime(int64_t launch_time);
+    const std::shared_ptr<KRBridgeStats> &GetBridgeStats() const {
+        return bridge_stats_;
+    }
 
  private:
     std::string page_name_ = "";
@@ -51,6 +55,7 @@ class KRPerformanceManager {
     bool is_cold_launch = false;       //  是否是冷启动
     bool is_page_cold_launch = false;  //  页面是否是首次启动
     std::unordered_map<std::string, std::shared_ptr<KRMonitor>> monitors_;
+    std::shared_ptr<KRBridgeStats> bridge_stats_ = std::make_shared<KRBridgeStats>();  // Kotlin调用Native统计
     static std::list<std::string> page_record_;  // 静态变量，全局记录页面是否曾经加载过
     static bool cold_launch_flag;                // 静态变量，用于标识进程是否首次启动
 };
@@ -15,77 +15,170 @@
 
 #include "libohos_render/scheduler/KRContextScheduler.h"
 
+#include <algorithm>
+#include <vector>
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
+#include "libohos_render/scheduler/KRInstanceShards.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 class KRContextSchedulerInternal {
  public:
     virtual ~KRContextSchedulerInternal() = default;
-    virtual void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) = 0;
+    /**
+     * @param shard 页面缓存的分片，为 nullptr 时按 instanceId 查找
+     */
+    virtual KRTimerId ScheduleTask(const std::string &instanceId, const KRInstanceShard *shard, bool sync,
+                                   int delayMs, const KRSchedulerTask &task, KRTaskPriority priority) = 0;
     virtual void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) = 0;
-    virtual void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) = 0;
+    virtual void DirectRunOnMainThread(const std::string &instanceId, const KRInstanceShard *shard, bool isSync,
+                                       const KRSchedulerTask &task) = 0;
 
-    virtual bool IsCurrentOnContextThread() = 0;
+    virtual bool IsCurrentOnContextThread(const std::string &instanceId) = 0;
+    virtual std::shared_ptr<KRInstanceShard> RegisterInstance(const std::string &instanceId) {
+        return nullptr;
+    }
+    virtual void ReleaseInstance(const std::string &instanceId) {}
 };
 
 class KRContextSchedulerMultiThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    explicit KRContextSchedulerMultiThreaded(size_t threadCount);
+    KRTimerId ScheduleTask(const std::string &instanceId, const KRInstanceShard *shard, bool sync, int delayMs,
+                           const KRSchedulerTask &task, KRTaskPriority priority) override;
     void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
-    void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
-    bool IsCurrentOnContextThread() override;
+    void DirectRunOnMainThread(const std::string &instanceId, const KRInstanceShard *shard, bool isSync,
+                               const KRSchedulerTask &task) override;
+    bool IsCurrentOnContextThread(const std::string &instanceId) override;
+    std::shared_ptr<KRInstanceShard> RegisterInstance(const std::string &instanceId) override;
+    void ReleaseInstance(const std::string &instanceId) override;
 
  private:
-    static KRThread *GetContextThread() {
-        static KRThread *gContextThread = new KRThread("kuikly");
-        return gContextThread;
-    }
-    static std::atomic_bool runningOnMainThread;
-    static std::thread::id mainThreadId;
+    /**
+     * 获取页面所属的Context线程；instanceId为空时使用首个线程，页面未注册或已释放时返回nullptr
+     * @param shard 页面缓存的分片，非空时直接读取，不查表
+     */
+    KRThread *GetContextThread(const std::string &instanceId, const KRInstanceShard *shard = nullptr);
+    /**
+     * 当前线程正在执行任务的Context线程，不在Context线程返回nullptr
+     */
+    KRThread *CurrentContextThread();
+    KRThread *CurrentWorkerThread();
+
+    std::vector<KRThread *> threads_;  // 创建后不再变化，线程常驻
+    KRInstanceShards shards_;
+    static thread_local KRThread *directRunThread;  // 主线程同步执行Context任务时所属的Context线程
 };
 
-std::atomic_bool KRContextSchedulerMultiThreaded::runningOnMainThread{false};
-std::thread::id KRContextSchedulerMultiThreaded::mainThreadId;
+thread_local KRThread *KRContextSchedulerMultiThreaded::directRunThread = nullptr;
+
+KRContextSchedulerMultiThreaded::KRContextSchedulerMultiThreaded(size_t threadCount)
+    : shards_(threadCount) {
+    for (size_t i = 0; i < threadCount; i++) {
+        threads_.push_back(new KRThread(i == 0 ? "kuikly" : "kuikly" + std::to_string(i)));
+    }
+}
+
+KRThread *KRContextSchedulerMultiThreaded::GetContextThread(const std::string &instanceId,
+                                                            const KRInstanceShard *shard) {
+    if (threads_.size() == 1 || instanceId.empty()) {
+        return threads_[0];
+    }
+    size_t index = shard != nullptr ? shard->Index() : shards_.Find(instanceId);
+    return index == KRInstanceShards::kNoShard ? nullptr : threads_[index];
+}
+
+std::shared_ptr<KRInstanceShard> KRContextSchedulerMultiThreaded::RegisterInstance(const std::string &instanceId) {
+    if (threads_.size() > 1) {
+        return shards_.Acquire(instanceId);
+    }
+    return nullptr;
+}
 
-void KRContextSchedulerMultiThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+void KRContextSchedulerMultiThreaded::ReleaseInstance(const std::string &instanceId) {
+    if (threads_.size() > 1) {
+        shards_.Release(instanceId);
+    }
+}
+
+KRThread *KRContextSchedulerMultiThreaded::CurrentWorkerThread() {
+    for (auto thread : threads_) {
+        if (thread->IsCurrentThreadWorkerThread()) {
+            return thread;
+        }
+    }
+    return nullptr;
+}
+
+KRThread *KRContextSchedulerMultiThreaded::CurrentContextThread() {
+    return directRunThread ? directRunThread : CurrentWorkerThread();
+}
+
+void KRContextSchedulerMultiThreaded::DirectRunOnMainThread(const std::string &instanceId,
+                                                            const KRInstanceShard *shard, bool isSync,
+                                                            const KRSchedulerTask &task) {
+    auto thread = GetContextThread(instanceId, shard);
+    if (thread == nullptr) {
+        return;  // 页面已销毁
+    }
     if (isSync) {
-        GetContextThread()->DirectRunOnCurThread([task]() {
-            mainThreadId = std::this_thread::get_id();
-            runningOnMainThread.store(true);
+        bool ran = thread->DirectRunOnCurThread([thread, task]() {
+            auto previous = directRunThread;
+            directRunThread = thread;
             task();
-            runningOnMainThread.store(false);
+            directRunThread = previous;
         });
+        if (!ran) {
+            KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
+        }
     } else {
-        GetContextThread()->DispatchAsync(task, 0);
+        thread->DispatchAsync(task, 0);
     }
 }
 
-void KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+KRTimerId KRContextSchedulerMultiThreaded::ScheduleTask(const std::string &instanceId, const KRInstanceShard *shard,
+                                                        bool sync, int delayMs, const KRSchedulerTask &task,
+                                                        KRTaskPriority priority) {
+    auto thread = GetContextThread(instanceId, shard);
+    if (thread == nullptr) {
+        return kKRInvalidTimerId;  // 页面已销毁，丢弃其后续任务
+    }
     if (sync) {
-        GetContextThread()->DispatchSync(task);
-    } else {
-        GetContextThread()->DispatchAsync(task, delayMs);
+        if (!thread->DispatchSync(task)) {
+            KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
+        }
+        return kKRInvalidTimerId;
     }
+    return thread->DispatchAsync(task, delayMs, priority);
 }
 
 void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
+    auto worker = CurrentWorkerThread();
     if (sync) {
-        if (GetContextThread()->IsCurrentThreadWorkerThread()) {
-            GetContextThread()->SyncMainTaskMutex(true, false, false);
+        if (worker) {
+            worker->BeginWaitMainThread();
             std::mutex mtx;
-            mtx.lock();  // 同步
-            KRMainThread::RunOnMainThread([task, &mtx] {
+            std::condition_variable cv;
+            bool done = false;
+            KRMainThread::RunOnMainThread([task, &mtx, &cv, &done] {
                 task();
-                mtx.unlock();
+                {
+                    std::unique_lock<std::mutex> lock(mtx);
+                    done = true;
+                }
+                cv.notify_one();
             });
-            mtx.lock();
-            mtx.unlock();
-            GetContextThread()->SyncMainTaskMutex(false, true, false);
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [&done] { return done; });
+            }
+            worker->EndWaitMainThread();
         } else {
             // 说明在主线程, 直接同步
             task();
         }
     } else {
-        if (GetContextThread()->IsCurrentThreadWorkerThread()) {
+        if (worker) {
             KRMainThread::RunOnMainThread([task] { task(); });
         } else {
             task();
@@ -93,23 +186,28 @@ void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const
     }
 }
 
-bool KRContextSchedulerMultiThreaded::IsCurrentOnContextThread() {
-    if (runningOnMainThread.load()) {
-        return std::this_thread::get_id() == mainThreadId;
+bool KRContextSchedulerMultiThreaded::IsCurrentOnContextThread(const std::string &instanceId) {
+    auto current = CurrentContextThread();
+    if (current == nullptr || instanceId.empty()) {
+        return current != nullptr;
     }
-    return GetContextThread()->IsCurrentThreadWorkerThread();
+    return current == GetContextThread(instanceId);
 }
 
 class KRContextSchedulerSingleThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    KRTimerId ScheduleTask(const std::string &instanceId, const KRInstanceShard *shard, bool sync, int delayMs,
+                           const KRSchedulerTask &task, KRTaskPriority priority) override;
     void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
-    void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
-    bool IsCurrentOnContextThread() override;
+    void DirectRunOnMainThread(const std::string &instanceId, const KRInstanceShard *shard, bool isSync,
+                               const KRSchedulerTask &task) override;
+    bool IsCurrentOnContextThread(const std::string &instanceId) override;
     std::thread::id mainThreadId;
 };
 
-void KRContextSchedulerSingleThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+void KRContextSchedulerSingleThreaded::DirectRunOnMainThread(const std::string &instanceId,
+                                                             const KRInstanceShard *shard, bool isSync,
+                                                             const KRSchedulerTask &task) {
     mainThreadId = std::this_thread::get_id();
     if (isSync) {
         task();
@@ -118,12 +216,18 @@ void KRContextSchedulerSingleThreaded::DirectRunOnMainThread(bool isSync, const
     }
 }
 
-void KRContextSchedulerSingleThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+KRTimerId KRContextSchedulerSingleThreaded::ScheduleTask(const std::string &instanceId, const KRInstanceShard *shard,
+                                                         bool sync, int delayMs, const KRSchedulerTask &task,
+                                                         KRTaskPriority priority) {
+    // 任务由主线程消息循环调度，不区分页面与优先级
     if (sync) {
         task();
+    } else if (delayMs > 0) {
+        return KRTimerWheel::GetInstance().Schedule(delayMs, [task] { KRMainThread::RunOnMainThread(task); });
     } else {
-        KRMainThread::RunOnMainThread(task, delayMs);
+        KRMainThread::RunOnMainThread(task);
     }
+    return kKRInvalidTimerId;
 }
 
 void KRContextSchedulerSingleThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
@@ -134,41 +238,93 @@ void KRContextSchedulerSingleThreaded::ScheduleTaskOnMainThread(bool sync, const
     }
 }
 
-bool KRContextSchedulerSingleThreaded::IsCurrentOnContextThread() {
+bool KRContextSchedulerSingleThreaded::IsCurrentOnContextThread(const std::string &instanceId) {
     return mainThreadId == std::this_thread::get_id();
 }
 
+/**
+ * 记录异步任务的排队与执行耗时，延时任务的排队时长从到期时间算起
+ */
+static KRSchedulerTask TraceTask(const std::string &instanceId, int delayMs, const KRSchedulerTask &task,
+                                 KRTaskPriority priority) {
+    static const char *kPriorityNames[] = {"input", "layout", "callback", "timer", "idle"};
+    int64_t queued_us = KRThreadTrace::NowMicros() + static_cast<int64_t>(delayMs) * 1000;
+    const char *category = kPriorityNames[static_cast<size_t>(priority)];
+    return [instanceId, queued_us, category, task] {
+        KRTraceScope trace("ContextTask", category, &instanceId, queued_us);
+        task();
+    };
+}
+
 static KRContextScheduler::ThreadingMode gThreadingMode = KRContextScheduler::ThreadingMode::MultiThread;
+static size_t gContextThreadCount = 1;
+// Kotlin 侧 BridgeManager、PagerManager 的全局状态（currentPageId、nativeBridgeMap 等）未加锁，
+// 多条Context线程并发调用会串页，在其改为按线程隔离或加锁前，Context线程数固定为1
+static constexpr size_t kMaxContextThreadCount = 1;
 
 void KRContextScheduler::SetThreadingMode(ThreadingMode mode) {
     // 仅应在初始化前调用一次，并仅仅使用一次，无需考虑多线程问题
     gThreadingMode = mode;
 }
 
+void KRContextScheduler::SetContextThreadCount(size_t count) {
+    // 同SetThreadingMode，仅应在初始化前调用
+    gContextThreadCount = std::min(std::max<size_t>(count, 1), kMaxContextThreadCount);
+}
+
 std::shared_ptr<KRContextSchedulerInternal> KRContextScheduler::GetInstance() {
     static std::shared_ptr<KRContextSchedulerInternal> instance_ = nullptr;
     static std::once_flag flag;
     std::call_once(flag, []() {
         instance_ = gThreadingMode == KRContextScheduler::ThreadingMode::MultiThread
                         ? std::dynamic_pointer_cast<KRContextSchedulerInternal>(
-                              std::make_shared<KRContextSchedulerMultiThreaded>())
+                              std::make_shared<KRContextSchedulerMultiThreaded>(gContextThreadCount))
                         : std::dynamic_pointer_cast<KRContextSchedulerInternal>(
                               std::make_shared<KRContextSchedulerSingleThreaded>());
     });
     return instance_;
 }
 
-void KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
-    GetInstance()->ScheduleTask(sync, delayMs, task);
+KRTimerId KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task,
+                                           KRTaskPriority priority) {
+    return ScheduleTask("", sync, delayMs, task, priority);
+}
+KRTimerId KRContextScheduler::ScheduleTask(const std::string &instanceId, bool sync, int delayMs,
+                                           const KRSchedulerTask &task, KRTaskPriority priority) {
+    return ScheduleTask(instanceId, nullptr, sync, delayMs, task, priority);
+}
+KRTimerId KRContextScheduler::ScheduleTask(const std::string &instanceId, const std::shared_ptr<KRInstanceShard> &shard,
+                                           bool sync, int delayMs, const KRSchedulerTask &task,
+                                           KRTaskPriority priority) {
+    if (!sync && KRThreadTrace::IsEnabled()) {
+        return GetInstance()->ScheduleTask(instanceId, shard.get(), sync, delayMs,
+                                           TraceTask(instanceId, delayMs, task, priority), priority);
+    }
+    return GetInstance()->ScheduleTask(instanceId, shard.get(), sync, delayMs, task, priority);
+}
+void KRContextScheduler::CancelTask(KRTimerId timer_id) {
+    KRTimerWheel::GetInstance().Cancel(timer_id);
 }
 void KRContextScheduler::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
     GetInstance()->ScheduleTaskOnMainThread(sync, task);
 }
-void KRContextScheduler::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
-    GetInstance()->DirectRunOnMainThread(isSync, task);
+void KRContextScheduler::DirectRunOnMainThread(const std::string &instanceId, bool isSync,
+                                               const KRSchedulerTask &task) {
+    GetInstance()->DirectRunOnMainThread(instanceId, nullptr, isSync, task);
+}
+void KRContextScheduler::DirectRunOnMainThread(const std::string &instanceId,
+                                               const std::shared_ptr<KRInstanceShard> &shard, bool isSync,
+                                               const KRSchedulerTask &task) {
+    GetInstance()->DirectRunOnMainThread(instanceId, shard.get(), isSync, task);
+}
+bool KRContextScheduler::IsCurrentOnContextThread(const std::string &instanceId) {
+    return GetInstance()->IsCurrentOnContextThread(instanceId);
+}
+std::shared_ptr<KRInstanceShard> KRContextScheduler::RegisterInstance(const std::string &instanceId) {
+    return GetInstance()->RegisterInstance(instanceId);
 }
-bool KRContextScheduler::IsCurrentOnContextThread() {
-    return GetInstance()->IsCurrentOnContextThread();
+void KRContextScheduler::ReleaseInstance(const std::string &instanceId) {
+    GetInstance()->ReleaseInstance(instanceId);
 }
 
 EXTERN_C_START
@@ -181,4 +337,14 @@ EXTERN_C_START
 void KRSetThreadingMode(int mode) {
     KRContextScheduler::SetThreadingMode(static_cast<KRContextScheduler::ThreadingMode>(!!mode));
 }
+
+/**
+ * 设置多线程模式下的Context线程数，初始化kuikly前调用。
+ * @param count 线程数，默认1（所有页面共用一条Context线程）；大于1时页面按instanceId分配到不同线程并行执行
+ *
+ * Kotlin侧全局状态尚不支持多线程并发访问，目前超过1的取值按1处理，与线程模式一样暂不暴露到头文件。
+ */
+void KRSetContextThreadCount(int count) {
+    KRContextScheduler::SetContextThreadCount(count > 0 ? static_cast<size_t>(count) : 1);
+}
 EXTERN_C_END
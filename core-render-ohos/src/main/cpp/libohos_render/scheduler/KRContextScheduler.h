@@ -16,9 +16,11 @@
 #ifndef CORE_RENDER_OHOS_KRCONTEXTSCHEDULER_H
 #define CORE_RENDER_OHOS_KRCONTEXTSCHEDULER_H
 
+#include <string>
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/foundation/thread/KRThread.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
+#include "libohos_render/scheduler/KRInstanceShards.h"
 
 class KRContextSchedulerInternal;
 class KRContextScheduler {
@@ -33,8 +35,31 @@ class KRContextScheduler {
      * @param sync 是否同步执行
      * @param delayMs 延时毫秒，0为不延时
      * @param task 任务闭包
+     * @param priority 异步任务的优先级，高优先级任务先于已排队的低优先级任务执行；单线程模式下忽略
+     * @return 延时任务的定时器ID，可用于 CancelTask；非延时任务返回 kKRInvalidTimerId
      */
-    static void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task);
+    static KRTimerId ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task,
+                                  KRTaskPriority priority = KRTaskPriority::kCallback);
+
+    /**
+     * 调度页面任务到该页面所属的Context线程执行（见 SetContextThreadCount）
+     * @param instanceId 页面实例ID，页面未注册或已销毁时任务被丢弃
+     */
+    static KRTimerId ScheduleTask(const std::string &instanceId, bool sync, int delayMs, const KRSchedulerTask &task,
+                                  KRTaskPriority priority = KRTaskPriority::kCallback);
+
+    /**
+     * 同上，使用 RegisterInstance 返回的分片定位Context线程，免去按 instanceId 查表
+     */
+    static KRTimerId ScheduleTask(const std::string &instanceId, const std::shared_ptr<KRInstanceShard> &shard,
+                                  bool sync, int delayMs, const KRSchedulerTask &task,
+                                  KRTaskPriority priority = KRTaskPriority::kCallback);
+
+    /**
+     * 取消尚未到期的延时任务
+     * @param timer_id ScheduleTask 返回的定时器ID
+     */
+    static void CancelTask(KRTimerId timer_id);
 
     /**
      * Context线程调度任务到主线程执行(注：该方法只能在主线程或Context线程被调用)
@@ -44,15 +69,30 @@ class KRContextScheduler {
     static void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task);
     /**
      * 直接在主线线程同步执行在Context线程安全的任务
+     * @param instanceId 页面实例ID
      * @param sync 是否同步执行
      * @param task 任务闭包
      */
-    static void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task);
+    static void DirectRunOnMainThread(const std::string &instanceId, bool isSync, const KRSchedulerTask &task);
+    static void DirectRunOnMainThread(const std::string &instanceId, const std::shared_ptr<KRInstanceShard> &shard,
+                                      bool isSync, const KRSchedulerTask &task);
 
     /**
      * 判断当前是否在Context线程
+     * @param instanceId 页面实例ID，非空时判断是否在该页面所属的Context线程
      */
-    static bool IsCurrentOnContextThread();
+    static bool IsCurrentOnContextThread(const std::string &instanceId = "");
+
+    /**
+     * 页面创建时分配其Context线程，需早于该页面的任何调度
+     * @return 页面所属分片，可缓存后用于调度；所有页面共用一条Context线程时返回 nullptr
+     */
+    static std::shared_ptr<KRInstanceShard> RegisterInstance(const std::string &instanceId);
+
+    /**
+     * 页面销毁后释放其Context线程分配，此后该页面的任务被丢弃
+     */
+    static void ReleaseInstance(const std::string &instanceId);
 
     /**
      * 设置线程模型，初始化kuikly前调用，初始化后调用无作用
@@ -60,6 +100,12 @@ class KRContextScheduler {
      */
     static void SetThreadingMode(ThreadingMode mode);
 
+    /**
+     * 设置多线程模式下的Context线程数，初始化kuikly前调用，初始化后调用无作用
+     * @param count 线程数，为1时所有页面共用一条Context线程；目前上限为1（见 kMaxContextThreadCount）
+     */
+    static void SetContextThreadCount(size_t count);
+
  private:
     static std::shared_ptr<KRContextSchedulerInternal> GetInstance();
 };
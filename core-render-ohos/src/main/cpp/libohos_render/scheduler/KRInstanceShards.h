@@ -0,0 +1,112 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRINSTANCESHARDS_H
+#define CORE_RENDER_OHOS_KRINSTANCESHARDS_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 页面分到的分片，页面释放后 Index() 返回 KRInstanceShards::kNoShard。
+ * 页面侧缓存该对象后调度时无需再按 instanceId 加锁查表
+ */
+class KRInstanceShard {
+ public:
+    explicit KRInstanceShard(size_t index) : index_(index) {}
+
+    size_t Index() const {
+        return index_.load(std::memory_order_acquire);
+    }
+
+ private:
+    friend class KRInstanceShards;
+    std::atomic<size_t> index_;
+};
+
+/**
+ * 页面到 Context 线程分片的分配表：页面创建时分配到页面数最少的分片，销毁后释放。
+ * 未分配或已释放的页面查不到分片，调用方据此丢弃页面销毁后才到达的任务
+ */
+class KRInstanceShards {
+ public:
+    static constexpr size_t kNoShard = static_cast<size_t>(-1);
+
+    explicit KRInstanceShards(size_t shard_count) : instance_counts_(shard_count, 0) {}
+
+    /**
+     * 为页面分配分片，已分配时返回原分片
+     */
+    size_t Assign(const std::string &instance_id) {
+        return Acquire(instance_id)->Index();
+    }
+
+    /**
+     * 同 Assign，返回可供页面缓存的分片对象
+     */
+    std::shared_ptr<KRInstanceShard> Acquire(const std::string &instance_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = shards_.find(instance_id);
+        if (it != shards_.end()) {
+            return it->second;
+        }
+        size_t shard = 0;
+        for (size_t i = 1; i < instance_counts_.size(); i++) {
+            if (instance_counts_[i] < instance_counts_[shard]) {
+                shard = i;
+            }
+        }
+        instance_counts_[shard]++;
+        auto result = std::make_shared<KRInstanceShard>(shard);
+        shards_.emplace(instance_id, result);
+        return result;
+    }
+
+    /**
+     * @return 页面所属分片，未分配或已释放时返回 kNoShard
+     */
+    size_t Find(const std::string &instance_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = shards_.find(instance_id);
+        return it != shards_.end() ? it->second->Index() : kNoShard;
+    }
+
+    void Release(const std::string &instance_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = shards_.find(instance_id);
+        if (it != shards_.end()) {
+            instance_counts_[it->second->Index()]--;
+            it->second->index_.store(kNoShard, std::memory_order_release);
+            shards_.erase(it);
+        }
+    }
+
+    size_t InstanceCount(size_t shard) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return instance_counts_[shard];
+    }
+
+ private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<KRInstanceShard>> shards_;
+    std::vector<size_t> instance_counts_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRINSTANCESHARDS_H
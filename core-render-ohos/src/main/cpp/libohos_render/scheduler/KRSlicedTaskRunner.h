@@ -0,0 +1,99 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSLICEDTASKRUNNER_H
+#define CORE_RENDER_OHOS_KRSLICEDTASKRUNNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+/**
+ * 分片执行 UI 任务：每次 Run 按顺序执行待执行任务，should_yield 返回 true 时让出，剩余任务留到下一次 Run。
+ * 尚未执行完时追加的任务排在剩余任务之后；任务执行中可重入调用 Append/Run，状态均从成员读取
+ */
+class KRSlicedTaskRunner {
+ public:
+    using ShouldYield = std::function<bool()>;
+
+    /**
+     * 追加一次刷新的任务，调用后 tasks 为空
+     */
+    void Append(std::vector<KRTask> &tasks) {
+        if (HasPending()) {
+            pending_.insert(pending_.end(), std::make_move_iterator(tasks.begin()),
+                            std::make_move_iterator(tasks.end()));
+            tasks.clear();
+            return;
+        }
+        pending_.clear();
+        pending_.swap(tasks);
+        index_ = 0;
+        slice_count_ = 0;
+        flush_task_count_ = 0;
+    }
+
+    /**
+     * 执行一个分片，每执行完一个任务且仍有剩余时询问 should_yield；should_yield 为空时执行完全部任务
+     * @return 本分片执行的任务数
+     */
+    size_t Run(const ShouldYield &should_yield) {
+        slice_count_++;
+        size_t executed_count = 0;
+        while (index_ < pending_.size()) {
+            KRTask task = std::move(pending_[index_++]);  // 先取出再执行，重入时不会重复执行
+            task();
+            executed_count++;
+            if (should_yield && index_ < pending_.size() && should_yield()) {
+                break;
+            }
+        }
+        if (index_ >= pending_.size() && !pending_.empty()) {
+            flush_task_count_ = pending_.size();
+            pending_.clear();
+            index_ = 0;
+        }
+        return executed_count;
+    }
+
+    bool HasPending() const {
+        return index_ < pending_.size();
+    }
+
+    /**
+     * 本次刷新已执行的分片数，下次刷新的 Append 时清零
+     */
+    uint32_t SliceCount() const {
+        return slice_count_;
+    }
+
+    /**
+     * 上次执行完的刷新共包含的任务数
+     */
+    size_t FlushTaskCount() const {
+        return flush_task_count_;
+    }
+
+ private:
+    std::vector<KRTask> pending_;  // 本次刷新待执行的任务，后续刷新的任务追加在其后
+    size_t index_ = 0;             // 下一个待执行任务的下标
+    uint32_t slice_count_ = 0;
+    size_t flush_task_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSLICEDTASKRUNNER_H
@@ -15,12 +15,16 @@
 
 #include "libohos_render/scheduler/KRUIScheduler.h"
 
+#include <chrono>
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 // should call on context线程
-void KRUIScheduler::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
+void KRUIScheduler::AddTaskToMainQueueWithTask(KRTask task) {
     std::lock_guard<std::mutex> lock(m_mutex_);
-    m_main_thread_tasks_on_context_queue_.push_back(task);
+    m_main_thread_tasks_on_context_queue_.push_back(std::move(task));
     SetNeedSyncMainQuequeTasks();
 }
 // should call on context线程
@@ -73,39 +77,44 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 scheduler->m_delegate_->WillPerformUITasksWithScheduler();
             }
             
-            std::vector<KRSchedulerTask> performTasks;
             {
                 std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                performTasks = scheduler->m_main_thread_tasks_on_context_queue_;
-                scheduler->m_main_thread_tasks_on_context_queue_ = {};
-                scheduler->m_main_thread_tasks_.insert(scheduler->m_main_thread_tasks_.end(), performTasks.begin(), performTasks.end());
+                auto &contextTasks = scheduler->m_main_thread_tasks_on_context_queue_;
+                auto &mainTasks = scheduler->m_main_thread_tasks_;
+                if (mainTasks.empty()) {
+                    mainTasks.swap(contextTasks);
+                } else {
+                    mainTasks.insert(mainTasks.end(), std::make_move_iterator(contextTasks.begin()),
+                                     std::make_move_iterator(contextTasks.end()));
+                    contextTasks.clear();
+                }
             }
             
-            scheduler->PerformOnMainQueueWithTask(sync, [weakSelf] {
+            scheduler->PerformOnMainQueueWithTask(sync, [weakSelf, sync] {
                 auto strongSelf = weakSelf.lock();
                 if (!strongSelf) {
                     return;
                 }
                 
                 auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
-                
-                std::vector<KRSchedulerTask> mainTasks;
+                scheduler->m_frame_flush_requested_.store(false);
+
+                std::vector<KRTask> mainTasks;
                 {
                     std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                    mainTasks = scheduler->m_main_thread_tasks_;
-                    scheduler->m_main_thread_tasks_ = {};
+                    mainTasks.swap(scheduler->m_main_thread_tasks_);
                 }
-                scheduler->RunMainQueueTasks(mainTasks);
+                scheduler->RunMainQueueTasks(mainTasks, sync);
             });
         };
-        KRContextScheduler::ScheduleTask(false, 0, [weakSelf] { 
+        KRContextScheduler::ScheduleTask(m_instance_id_, false, 0, [weakSelf] { 
             auto strongSelf = weakSelf.lock();
             if (!strongSelf) {
                 return;
             }
             auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
             scheduler->PerformSyncMainQueueTasksBlockIfNeed(false); 
-        });
+        }, KRTaskPriority::kLayout);
     }
 }
 
@@ -118,34 +127,86 @@ void KRUIScheduler::PerformOnMainQueueWithTask(bool sync, const std::function<vo
             },
             1);
     } else {
-        KRMainThread::RunOnMainThread(task);
+        PerformOnNextFrame(task);
     }
 }
 
-void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks) {
-    // 主线程
-    m_performing_main_queue_task_ = true;
-    for (size_t i = 0; i < tasks.size(); i++) {
-        tasks[i]();
+void KRUIScheduler::PerformOnNextFrame(const std::function<void()> &task) {
+    if (!m_view_did_load_.load()) {
+        KRMainThread::RunOnMainThread(task);  // 首屏尽快上屏
+        return;
+    }
+    if (m_frame_flush_requested_.exchange(true)) {
+        return;  // 本帧已有刷新请求，任务已并入 m_main_thread_tasks_
     }
+    KRFrameClock::GetInstance().PostFrameCallback([task](int64_t frameTimeNanos) { task(); });
+}
+
+void KRUIScheduler::RunMainQueueTasks(std::vector<KRTask> &tasks, bool sync) {
+    // 主线程；上一次刷新尚未执行完时，新任务排在其后以保持顺序
+    bool continuing = m_task_runner_.HasPending();
+    m_task_runner_.Append(tasks);
+    if (continuing && !sync && m_slice_continuation_pending_) {
+        return;  // 等待下一帧继续执行
+    }
+    RunPendingTasks(sync);
+}
+
+void KRUIScheduler::RunPendingTasks(bool sync) {
+    KRSlicedTaskRunner::ShouldYield should_yield = nullptr;
+    if (!sync && m_frame_budget_ms_ > 0) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_frame_budget_ms_);
+        should_yield = [deadline] { return std::chrono::steady_clock::now() >= deadline; };
+    }
+    KRTraceScope trace("UITaskSlice", sync ? "sync" : "async", &m_instance_id_);
+    m_performing_main_queue_task_ = true;
+    size_t executed_count = m_task_runner_.Run(should_yield);
     m_performing_main_queue_task_ = false;
+    trace.SetArg("taskCount", static_cast<int64_t>(executed_count));
+    if (m_task_runner_.HasPending()) {
+        ScheduleNextSlice();
+        return;
+    }
+    if (m_task_runner_.SliceCount() > 1) {
+        KR_LOG_INFO << "UI tasks flushed in " << m_task_runner_.SliceCount() << " slices, task count: "
+                    << m_task_runner_.FlushTaskCount() << ", frame budget: " << m_frame_budget_ms_ << "ms";
+    }
     if (!m_view_did_load_) {
         m_view_did_load_ = true;
-        auto viewDidLoadTasks = m_view_did_load_main_thread_tasks_;
-        m_view_did_load_main_thread_tasks_ = {};
+        std::vector<KRSchedulerTask> viewDidLoadTasks;
+        viewDidLoadTasks.swap(m_view_did_load_main_thread_tasks_);
         for (size_t i = 0; i < viewDidLoadTasks.size(); i++) {
             viewDidLoadTasks[i]();
         }
     }
     if (m_did_end_main_thread_tasks_.size() > 0) {
-        auto tasks = m_did_end_main_thread_tasks_;
-        m_did_end_main_thread_tasks_ = {};
+        std::vector<KRSchedulerTask> tasks;
+        tasks.swap(m_did_end_main_thread_tasks_);
         for (size_t i = 0; i < tasks.size(); i++) {
             tasks[i]();
         }
     }
 }
 
+void KRUIScheduler::ScheduleNextSlice() {
+    if (m_slice_continuation_pending_) {
+        return;
+    }
+    m_slice_continuation_pending_ = true;
+    std::weak_ptr<IKRScheduler> weakSelf = shared_from_this();
+    KRFrameClock::GetInstance().PostFrameCallback([weakSelf](int64_t frameTimeNanos) {
+        auto strongSelf = weakSelf.lock();
+        if (!strongSelf) {
+            return;
+        }
+        auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
+        scheduler->m_slice_continuation_pending_ = false;
+        if (scheduler->m_task_runner_.HasPending()) {
+            scheduler->RunPendingTasks(false);  // 期间可能已被同步刷新执行完
+        }
+    });
+}
+
 void KRUIScheduler::PerformMainThreadTaskWaitToSyncBlockIfNeed() {
     if (m_main_thread_task_wait_to_sync_block_) {
         m_main_thread_task_wait_to_sync_block_();
@@ -16,13 +16,17 @@
 #ifndef CORE_RENDER_OHOS_KRUISCHEDULER_H
 #define CORE_RENDER_OHOS_KRUISCHEDULER_H
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRTask.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
+#include "libohos_render/scheduler/KRSlicedTaskRunner.h"
 
 using KRSyncSchedulerTask = std::function<void(bool sync)>;
 
@@ -35,10 +39,11 @@ class KRRenderUISchedulerDelegate {
 
 class KRUIScheduler : public IKRScheduler {
  public:
-    explicit KRUIScheduler(KRRenderUISchedulerDelegate *delegate) : m_delegate_(delegate) {}
+    KRUIScheduler(KRRenderUISchedulerDelegate *delegate, const std::string &instanceId)
+        : m_delegate_(delegate), m_instance_id_(instanceId) {}
 
     // should call on context线程
-    void AddTaskToMainQueueWithTask(const KRSchedulerTask &task);
+    void AddTaskToMainQueueWithTask(KRTask task);
     // should call on context线程
     void PerformSyncMainQueueTasksBlockIfNeed(bool sync);
     // should call on main thread
@@ -56,24 +61,49 @@ class KRUIScheduler : public IKRScheduler {
     void ResetDelegate(){
         m_delegate_ = nullptr;
     }
+
+    /**
+     * 设置异步 UI 任务每帧执行时长预算，超出后让出主线程、下一帧继续执行；0 表示不限制
+     */
+    void SetFrameBudgetMs(int budgetMs) {
+        m_frame_budget_ms_ = budgetMs > 0 ? budgetMs : 0;
+    }
  private:
     void SetNeedSyncMainQuequeTasks();
 
     void PerformOnMainQueueWithTask(bool sync, const std::function<void()> &task);
 
-    void RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks);
+    /**
+     * 异步 UI 任务对齐到下一帧执行，同一帧内的多次刷新合并为一次；首屏不等待
+     */
+    void PerformOnNextFrame(const std::function<void()> &task);
+
+    void RunMainQueueTasks(std::vector<KRTask> &tasks, bool sync);
+
+    /**
+     * 按帧预算执行待执行任务，同步刷新时不受预算限制；全部执行完后才回调 viewDidLoad/didEnd 任务
+     */
+    void RunPendingTasks(bool sync);
+
+    void ScheduleNextSlice();
 
     bool m_is_destroyed_ = false;
     KRSyncSchedulerTask m_need_sync_main_queue_tasks_block_ = nullptr;
     KRRenderUISchedulerDelegate *m_delegate_ = nullptr;
+    std::string m_instance_id_;
     bool m_performing_main_queue_task_ = false;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_on_context_queue_;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_;
+    std::vector<KRTask> m_main_thread_tasks_on_context_queue_;
+    std::vector<KRTask> m_main_thread_tasks_;
     std::vector<KRSchedulerTask> m_view_did_load_main_thread_tasks_;
     std::vector<KRSchedulerTask> m_did_end_main_thread_tasks_;
     std::function<void()> m_main_thread_task_wait_to_sync_block_ = nullptr;
     std::mutex m_mutex_;
-    bool m_view_did_load_ = false;
+    std::atomic<bool> m_view_did_load_{false};
+    std::atomic<bool> m_frame_flush_requested_{false};  // 已请求帧回调，新任务并入 m_main_thread_tasks_ 等待该帧执行
+    int m_frame_budget_ms_ = 0;
+    // 以下分片执行状态仅在主线程访问
+    KRSlicedTaskRunner m_task_runner_;
+    bool m_slice_continuation_pending_ = false;  // 已请求下一帧继续执行
 };
 
 #endif  // CORE_RENDER_OHOS_KRUISCHEDULER_H
@@ -0,0 +1,125 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFIXEDBLOCKPOOL_H
+#define CORE_RENDER_OHOS_KRFIXEDBLOCKPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include "libohos_render/utils/KRScopedSpinLock.h"
+
+/**
+ * 定长内存块池：释放的块挂入空闲链表供下次分配复用，空闲块超过上限时才归还系统
+ * 分配与释放可以发生在不同线程（如上下文线程构造桥接参数、主线程释放）
+ */
+template <size_t kBlockSize, size_t kMaxFreeBlocks = 4096>
+class KRFixedBlockPool {
+ public:
+    static_assert(kBlockSize >= sizeof(void *), "block must be able to hold the free list link");
+
+    static KRFixedBlockPool &GetInstance() {
+        static KRFixedBlockPool *instance = new KRFixedBlockPool();  // 进程级单例，不析构
+        return *instance;
+    }
+
+    void *Allocate() {
+        {
+            KRScopedSpinLock lock(&lock_);
+            if (free_list_ != nullptr) {
+                auto block = free_list_;
+                free_list_ = block->next;
+                --free_count_;
+                return block;
+            }
+        }
+        return ::operator new(kBlockSize);
+    }
+
+    void Deallocate(void *block) {
+        {
+            KRScopedSpinLock lock(&lock_);
+            if (free_count_ < kMaxFreeBlocks) {
+                auto free_block = static_cast<FreeBlock *>(block);
+                free_block->next = free_list_;
+                free_list_ = free_block;
+                ++free_count_;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    size_t FreeCount() {
+        KRScopedSpinLock lock(&lock_);
+        return free_count_;
+    }
+
+ private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+    KRSpinLock lock_;
+    FreeBlock *free_list_ = nullptr;
+    size_t free_count_ = 0;
+};
+
+/**
+ * 基于KRFixedBlockPool的分配器，配合std::allocate_shared使用，使控制块与对象一起从池中分配
+ * 单个对象按16字节对齐后的大小分桶，批量分配走默认分配器
+ */
+template <typename T>
+class KRPoolAllocator {
+ public:
+    using value_type = T;
+
+    KRPoolAllocator() = default;
+    template <typename U>
+    KRPoolAllocator(const KRPoolAllocator<U> &) {}
+
+    T *allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<T *>(Pool().Allocate());
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) {
+        if (n == 1) {
+            Pool().Deallocate(p);
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const KRPoolAllocator<U> &) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const KRPoolAllocator<U> &) const {
+        return false;
+    }
+
+ private:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+    static constexpr size_t kBlockSize = (sizeof(T) + 15) / 16 * 16;
+
+    static KRFixedBlockPool<kBlockSize> &Pool() {
+        return KRFixedBlockPool<kBlockSize>::GetInstance();
+    }
+};
+
+#endif  // CORE_RENDER_OHOS_KRFIXEDBLOCKPOOL_H
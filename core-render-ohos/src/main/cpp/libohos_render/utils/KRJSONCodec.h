@@ -0,0 +1,712 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRJSONCODEC_H
+#define CORE_RENDER_OHOS_KRJSONCODEC_H
+
+#include <charconv>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace kuikly {
+namespace util {
+
+namespace json_internal {
+constexpr uint64_t kOnes = 0x0101010101010101ULL;
+constexpr uint64_t kHighs = 0x8080808080808080ULL;
+
+/** 8字节中是否存在等于c的字节（SWAR，用于无向量指令的平台） */
+inline bool HasByte(uint64_t word, uint8_t c) {
+    uint64_t x = word ^ (kOnes * c);
+    return ((x - kOnes) & ~x & kHighs) != 0;
+}
+
+/** 8字节中是否存在小于n的字节（n <= 128） */
+inline bool HasByteLess(uint64_t word, uint8_t n) {
+    return ((word - kOnes * n) & ~word & kHighs) != 0;
+}
+
+inline uint64_t LoadWord(const char *p) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+#if defined(__aarch64__) || defined(__SSE2__)
+constexpr size_t kScanBlockSize = 16;
+#else
+constexpr size_t kScanBlockSize = 8;
+#endif
+
+/** 一个扫描块内是否存在'"'或'\\'，arm64 使用 NEON、x86_64 使用 SSE2，其余平台使用 SWAR */
+inline bool BlockHasQuoteOrEscape(const char *p) {
+#if defined(__aarch64__)
+    uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    uint8x16_t hit = vorrq_u8(vceqq_u8(block, vdupq_n_u8('"')), vceqq_u8(block, vdupq_n_u8('\\')));
+    return vmaxvq_u8(hit) != 0;
+#elif defined(__SSE2__)
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')));
+    return _mm_movemask_epi8(hit) != 0;
+#else
+    uint64_t word = LoadWord(p);
+    return HasByte(word, '"') || HasByte(word, '\\');
+#endif
+}
+
+/** 一个扫描块内是否存在需要转义的字符（'"'、'\\'及控制字符） */
+inline bool BlockHasNeedEscape(const char *p) {
+#if defined(__aarch64__)
+    uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    uint8x16_t hit = vorrq_u8(vceqq_u8(block, vdupq_n_u8('"')), vceqq_u8(block, vdupq_n_u8('\\')));
+    hit = vorrq_u8(hit, vcltq_u8(block, vdupq_n_u8(0x20)));
+    return vmaxvq_u8(hit) != 0;
+#elif defined(__SSE2__)
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')));
+    // 无符号比较 block <= 0x1F 等价于 max(block, 0x1F) == 0x1F
+    __m128i control = _mm_set1_epi8(0x1F);
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_max_epu8(block, control), control));
+    return _mm_movemask_epi8(hit) != 0;
+#else
+    uint64_t word = LoadWord(p);
+    return HasByte(word, '"') || HasByte(word, '\\') || HasByteLess(word, 0x20);
+#endif
+}
+
+/** 从begin开始查找第一个'"'或'\\'，按块跳过不含目标字符的内容 */
+inline size_t FindQuoteOrEscape(std::string_view str, size_t begin) {
+    size_t i = begin;
+    const char *data = str.data();
+    for (; i + kScanBlockSize <= str.size(); i += kScanBlockSize) {
+        if (BlockHasQuoteOrEscape(data + i)) {
+            break;
+        }
+    }
+    for (; i < str.size(); ++i) {
+        if (data[i] == '"' || data[i] == '\\') {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+/** 从begin开始查找第一个需要转义的字符，按块跳过无需转义的内容 */
+inline size_t FindNeedEscape(std::string_view str, size_t begin) {
+    size_t i = begin;
+    const char *data = str.data();
+    for (; i + kScanBlockSize <= str.size(); i += kScanBlockSize) {
+        if (BlockHasNeedEscape(data + i)) {
+            break;
+        }
+    }
+    for (; i < str.size(); ++i) {
+        auto c = static_cast<uint8_t>(data[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            return i;
+        }
+    }
+    return str.size();
+}
+
+inline void AppendUTF8(std::string &out, uint32_t code_point) {
+    if (code_point < 0x80) {
+        out.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+}  // namespace json_internal
+
+/**
+ * 流式JSON读取器，直接在输入文本上解析，不构建中间DOM。
+ * 字符串在无转义时以string_view形式返回，生命周期与输入文本一致；对象与数组通过回调逐个访问成员，
+ * 回调中必须读取（或Skip）当前成员的值。
+ */
+class JSONReader {
+ public:
+    enum class ValueType { kInvalid, kNull, kBool, kNumber, kString, kObject, kArray };
+
+    explicit JSONReader(std::string_view json) : json_(json) {}
+
+    bool IsValid() const {
+        return valid_;
+    }
+
+    ValueType PeekType() {
+        SkipWhitespace();
+        if (!valid_ || pos_ >= json_.size()) {
+            return ValueType::kInvalid;
+        }
+        switch (json_[pos_]) {
+            case '{':
+                return ValueType::kObject;
+            case '[':
+                return ValueType::kArray;
+            case '"':
+                return ValueType::kString;
+            case 't':
+            case 'f':
+                return ValueType::kBool;
+            case 'n':
+                return ValueType::kNull;
+            default:
+                return ValueType::kNumber;
+        }
+    }
+
+    bool ReadNull() {
+        SkipWhitespace();
+        return ConsumeLiteral("null");
+    }
+
+    bool ReadBool(bool &value) {
+        SkipWhitespace();
+        if (ConsumeLiteral("true")) {
+            value = true;
+            return true;
+        }
+        if (valid_ && ConsumeLiteral("false")) {
+            value = false;
+            return true;
+        }
+        return Fail();
+    }
+
+    bool ReadNumber(double &value) {
+        SkipWhitespace();
+        size_t begin = pos_;
+        while (pos_ < json_.size() && IsNumberChar(json_[pos_])) {
+            ++pos_;
+        }
+        size_t length = pos_ - begin;
+        if (length == 0) {
+            return Fail();
+        }
+        // strtod需要以'\0'结尾，数字通常很短，拷贝到栈上即可
+        char buffer[64];
+        std::string long_buffer;
+        const char *number = buffer;
+        if (length < sizeof(buffer)) {
+            memcpy(buffer, json_.data() + begin, length);
+            buffer[length] = '\0';
+        } else {
+            long_buffer.assign(json_.data() + begin, length);
+            number = long_buffer.c_str();
+        }
+        char *end = nullptr;
+        value = strtod(number, &end);
+        if (end != number + length) {
+            return Fail();
+        }
+        return true;
+    }
+
+    /**
+     * 读取字符串，无转义时直接返回输入文本的切片，有转义时解码到scratch中并返回其视图
+     */
+    bool ReadString(std::string_view &value, std::string &scratch) {
+        SkipWhitespace();
+        if (!Consume('"')) {
+            return Fail();
+        }
+        size_t begin = pos_;
+        size_t end = json_internal::FindQuoteOrEscape(json_, pos_);
+        if (end == std::string_view::npos) {
+            return Fail();
+        }
+        if (json_[end] == '"') {
+            value = json_.substr(begin, end - begin);
+            pos_ = end + 1;
+            return true;
+        }
+        scratch.assign(json_.data() + begin, end - begin);
+        pos_ = end;
+        if (!DecodeEscapedTail(scratch)) {
+            return false;
+        }
+        value = scratch;
+        return true;
+    }
+
+    bool ReadString(std::string &value) {
+        std::string_view view;
+        std::string scratch;
+        if (!ReadString(view, scratch)) {
+            return false;
+        }
+        if (view.data() == scratch.data()) {
+            value = std::move(scratch);
+        } else {
+            value.assign(view.data(), view.size());
+        }
+        return true;
+    }
+
+    /**
+     * 逐个访问对象成员
+     * @param on_member bool(std::string_view key)，返回false时中止解析
+     */
+    template <typename F> bool ReadObject(F &&on_member) {
+        SkipWhitespace();
+        if (!Consume('{') || !EnterNesting()) {
+            return Fail();
+        }
+        std::string key_scratch;  // 仅在key含转义时使用
+        SkipWhitespace();
+        if (Consume('}')) {
+            return LeaveNesting();
+        }
+        for (;;) {
+            std::string_view key;
+            if (!ReadString(key, key_scratch)) {
+                return false;
+            }
+            SkipWhitespace();
+            if (!Consume(':')) {
+                return Fail();
+            }
+            if (!on_member(key) || !valid_) {
+                return Fail();
+            }
+            SkipWhitespace();
+            if (Consume(',')) {
+                continue;
+            }
+            if (Consume('}')) {
+                return LeaveNesting();
+            }
+            return Fail();
+        }
+    }
+
+    /**
+     * 逐个访问数组元素
+     * @param on_element bool(size_t index)，返回false时中止解析
+     */
+    template <typename F> bool ReadArray(F &&on_element) {
+        SkipWhitespace();
+        if (!Consume('[') || !EnterNesting()) {
+            return Fail();
+        }
+        SkipWhitespace();
+        if (Consume(']')) {
+            return LeaveNesting();
+        }
+        for (size_t index = 0;; ++index) {
+            if (!on_element(index) || !valid_) {
+                return Fail();
+            }
+            SkipWhitespace();
+            if (Consume(',')) {
+                continue;
+            }
+            if (Consume(']')) {
+                return LeaveNesting();
+            }
+            return Fail();
+        }
+    }
+
+    /** 跳过当前值（同时校验其格式） */
+    bool SkipValue() {
+        switch (PeekType()) {
+            case ValueType::kNull:
+                return ReadNull();
+            case ValueType::kBool: {
+                bool value;
+                return ReadBool(value);
+            }
+            case ValueType::kNumber: {
+                double value;
+                return ReadNumber(value);
+            }
+            case ValueType::kString: {
+                std::string_view value;
+                std::string scratch;
+                return ReadString(value, scratch);
+            }
+            case ValueType::kObject:
+                return ReadObject([this](std::string_view) { return SkipValue(); });
+            case ValueType::kArray:
+                return ReadArray([this](size_t) { return SkipValue(); });
+            default:
+                return Fail();
+        }
+    }
+
+    /** 跳过当前值并返回其原始文本 */
+    bool RawValue(std::string_view &raw) {
+        SkipWhitespace();
+        size_t begin = pos_;
+        if (!SkipValue()) {
+            return false;
+        }
+        raw = json_.substr(begin, pos_ - begin);
+        return true;
+    }
+
+ private:
+    static constexpr int kMaxNestingDepth = 1000;  // 与cJSON默认限制一致
+
+    static bool IsNumberChar(char c) {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+    }
+
+    static int HexValue(char c) {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    void SkipWhitespace() {
+        while (pos_ < json_.size()) {
+            char c = json_[pos_];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                break;
+            }
+            ++pos_;
+        }
+    }
+
+    bool Consume(char c) {
+        if (valid_ && pos_ < json_.size() && json_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeLiteral(std::string_view literal) {
+        if (valid_ && json_.substr(pos_, literal.size()) == literal) {
+            pos_ += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool EnterNesting() {
+        return ++depth_ <= kMaxNestingDepth;
+    }
+
+    bool LeaveNesting() {
+        --depth_;
+        return true;
+    }
+
+    bool Fail() {
+        valid_ = false;
+        return false;
+    }
+
+    bool ReadHex4(uint32_t &value) {
+        if (json_.size() - pos_ < 4) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 4; ++i) {
+            int digit = HexValue(json_[pos_ + i]);
+            if (digit < 0) {
+                return false;
+            }
+            value = (value << 4) | static_cast<uint32_t>(digit);
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    /** pos_位于第一个'\\'处，解码剩余部分直至结束引号 */
+    bool DecodeEscapedTail(std::string &out) {
+        while (pos_ < json_.size()) {
+            char c = json_[pos_++];
+            if (c == '"') {
+                return true;
+            }
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (pos_ >= json_.size()) {
+                break;
+            }
+            char escaped = json_[pos_++];
+            switch (escaped) {
+                case '"':
+                case '\\':
+                case '/':
+                    out.push_back(escaped);
+                    break;
+                case 'b':
+                    out.push_back('\b');
+                    break;
+                case 'f':
+                    out.push_back('\f');
+                    break;
+                case 'n':
+                    out.push_back('\n');
+                    break;
+                case 'r':
+                    out.push_back('\r');
+                    break;
+                case 't':
+                    out.push_back('\t');
+                    break;
+                case 'u': {
+                    uint32_t code_point;
+                    if (!ReadHex4(code_point) || (code_point >= 0xDC00 && code_point <= 0xDFFF)) {
+                        return Fail();
+                    }
+                    if (code_point >= 0xD800 && code_point <= 0xDBFF) {  // 代理对
+                        uint32_t low;
+                        if (!Consume('\\') || !Consume('u') || !ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                            return Fail();
+                        }
+                        code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (low & 0x3FF));
+                    }
+                    json_internal::AppendUTF8(out, code_point);
+                    break;
+                }
+                default:
+                    return Fail();
+            }
+            // 跳过下一段无需解码的内容
+            size_t next = json_internal::FindQuoteOrEscape(json_, pos_);
+            if (next == std::string_view::npos) {
+                break;
+            }
+            out.append(json_.data() + pos_, next - pos_);
+            pos_ = next;
+        }
+        return Fail();
+    }
+
+    std::string_view json_;
+    size_t pos_ = 0;
+    int depth_ = 0;
+    bool valid_ = true;
+};
+
+/**
+ * 流式JSON写入器，直接追加到目标字符串
+ * kCompact 等价于 cJSON_PrintUnformatted，数字输出最短往返表示；
+ * kPretty 与 cJSON_Print 的缩进、分隔符及数字格式保持一致，供日志与 toString 使用
+ */
+class JSONWriter {
+ public:
+    enum class Format { kCompact, kPretty };
+
+    explicit JSONWriter(std::string &out, Format format = Format::kCompact)
+        : out_(out), pretty_(format == Format::kPretty) {}
+
+    void BeginObject() {
+        BeforeValue();
+        out_.push_back('{');
+        if (pretty_) {
+            ++depth_;
+            out_.push_back('\n');
+        }
+        need_comma_ = false;
+    }
+
+    void EndObject() {
+        if (pretty_) {
+            if (need_comma_) {  // 非空对象，补上最后一个成员的换行
+                out_.push_back('\n');
+            }
+            --depth_;
+            out_.append(depth_, '\t');
+        }
+        out_.push_back('}');
+        need_comma_ = true;
+    }
+
+    void BeginArray() {
+        BeforeValue();
+        out_.push_back('[');
+        if (pretty_) {
+            ++depth_;
+        }
+        need_comma_ = false;
+    }
+
+    void EndArray() {
+        if (pretty_) {
+            --depth_;
+        }
+        out_.push_back(']');
+        need_comma_ = true;
+    }
+
+    void Key(std::string_view key) {
+        if (pretty_) {
+            if (need_comma_) {
+                out_.append(",\n");
+            }
+            out_.append(depth_, '\t');
+        } else {
+            BeforeValue();
+        }
+        AppendQuoted(key);
+        out_.append(pretty_ ? ":\t" : ":");
+        need_comma_ = false;
+    }
+
+    void String(std::string_view value) {
+        BeforeValue();
+        AppendQuoted(value);
+        need_comma_ = true;
+    }
+
+    void Int(int64_t value) {
+        BeforeValue();
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out_.append(buffer, result.ptr - buffer);
+        need_comma_ = true;
+    }
+
+    void Double(double value) {
+        BeforeValue();
+        if (!std::isfinite(value)) {  // 与cJSON一致，非有限值输出null
+            out_.append("null");
+        } else if (pretty_) {
+            AppendPrintNumber(value);
+        } else {
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out_.append(buffer, result.ptr - buffer);
+        }
+        need_comma_ = true;
+    }
+
+    void Bool(bool value) {
+        BeforeValue();
+        out_.append(value ? "true" : "false");
+        need_comma_ = true;
+    }
+
+    void Null() {
+        BeforeValue();
+        out_.append("null");
+        need_comma_ = true;
+    }
+
+ private:
+    void BeforeValue() {
+        if (need_comma_) {
+            out_.append(pretty_ ? ", " : ",");
+        }
+    }
+
+    /** 同cJSON print_number：整数值按%d输出，其余先试%1.15g，不能往返时退回%1.17g */
+    void AppendPrintNumber(double value) {
+        char buffer[32];
+        int length;
+        if (value >= INT_MIN && value <= INT_MAX && value == static_cast<double>(static_cast<int>(value))) {
+            length = snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value));
+        } else {
+            length = snprintf(buffer, sizeof(buffer), "%1.15g", value);
+            double parsed = strtod(buffer, nullptr);  // 与cJSON的sscanf一致，溢出时为inf
+            if (std::fabs(parsed - value) > std::fmax(std::fabs(parsed), std::fabs(value)) * DBL_EPSILON) {
+                length = snprintf(buffer, sizeof(buffer), "%1.17g", value);
+            }
+        }
+        out_.append(buffer, length);
+    }
+
+    void AppendQuoted(std::string_view str) {
+        static constexpr char kHex[] = "0123456789abcdef";
+        out_.push_back('"');
+        size_t begin = 0;
+        while (begin < str.size()) {
+            size_t next = json_internal::FindNeedEscape(str, begin);
+            out_.append(str.data() + begin, next - begin);
+            if (next >= str.size()) {
+                break;
+            }
+            auto c = static_cast<uint8_t>(str[next]);
+            switch (c) {
+                case '"':
+                    out_.append("\\\"");
+                    break;
+                case '\\':
+                    out_.append("\\\\");
+                    break;
+                case '\b':
+                    out_.append("\\b");
+                    break;
+                case '\f':
+                    out_.append("\\f");
+                    break;
+                case '\n':
+                    out_.append("\\n");
+                    break;
+                case '\r':
+                    out_.append("\\r");
+                    break;
+                case '\t':
+                    out_.append("\\t");
+                    break;
+                default: {
+                    char escaped[] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+                    out_.append(escaped, sizeof(escaped));
+                    break;
+                }
+            }
+            begin = next + 1;
+        }
+        out_.push_back('"');
+    }
+
+    std::string &out_;
+    bool pretty_;
+    bool need_comma_ = false;
+    int depth_ = 0;
+};
+
+}  // namespace util
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRJSONCODEC_H
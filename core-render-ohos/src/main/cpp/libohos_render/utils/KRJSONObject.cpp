@@ -15,109 +15,187 @@
 
 #include "KRJSONObject.h"
 
-#include "thirdparty/cJSON/cJSON.h"
+#include <cctype>
+#include <cmath>
+#include "libohos_render/utils/KRJSONCodec.h"
 
 namespace kuikly {
 namespace util {
+namespace {
+template <typename F> void ForEachArrayItem(std::string_view raw_array, F &&on_item) {
+    JSONReader reader(raw_array);
+    if (reader.PeekType() != JSONReader::ValueType::kArray) {
+        return;
+    }
+    reader.ReadArray([&reader, &on_item](size_t) {
+        std::string_view raw_item;
+        if (!reader.RawValue(raw_item)) {
+            return false;
+        }
+        on_item(raw_item);
+        return true;
+    });
+}
+
+std::string StringValue(std::string_view raw, const std::string &default_value) {
+    JSONReader reader(raw);
+    std::string value;
+    if (reader.PeekType() != JSONReader::ValueType::kString || !reader.ReadString(value)) {
+        return default_value;
+    }
+    return value;
+}
+
+double NumberValue(std::string_view raw) {
+    JSONReader reader(raw);
+    double value = 0;
+    if (reader.PeekType() != JSONReader::ValueType::kNumber || !reader.ReadNumber(value)) {
+        return NAN;  // 与cJSON_GetNumberValue一致
+    }
+    return value;
+}
+}  // namespace
+
 std::shared_ptr<JSONObject> JSONObject::Parse(const std::string &str) {
-    cJSON *p = cJSON_Parse(str.c_str());
-    return p ? std::make_shared<JSONObject>(p) : nullptr;
+    auto source = std::make_shared<const std::string>(str);
+    JSONReader reader(*source);
+    std::string_view json;
+    if (!reader.RawValue(json)) {
+        return nullptr;
+    }
+    return std::make_shared<JSONObject>(source, json);
 }
 
-JSONObject::JSONObject(void *cjson, std::shared_ptr<JSONObject> owner) : cjson_(cjson), owner_(owner) {
+JSONObject::JSONObject(std::shared_ptr<const std::string> source, std::string_view json)
+    : source_(std::move(source)), json_(json) {
     // blank
 }
-JSONObject::~JSONObject() {
-    if (owner_) {
-        cjson_ = nullptr;
-        owner_ = nullptr;
-    } else if (cjson_) {
-        cJSON_Delete(reinterpret_cast<cJSON *>(cjson_));
-        cjson_ = nullptr;
+
+const std::vector<JSONObject::Member> &JSONObject::Members() const {
+    if (indexed_) {
+        return members_;
     }
+    indexed_ = true;
+    JSONReader reader(json_);
+    switch (reader.PeekType()) {
+        case JSONReader::ValueType::kArray:
+            reader.ReadArray([&](size_t) {
+                std::string_view raw;
+                if (!reader.RawValue(raw)) {
+                    return false;
+                }
+                members_.push_back({std::string_view(), raw});
+                return true;
+            });
+            break;
+        case JSONReader::ValueType::kObject:
+            is_object_ = true;
+            reader.ReadObject([&](std::string_view key) {
+                std::string_view raw;
+                if (!reader.RawValue(raw)) {
+                    return false;
+                }
+                if (key.data() < json_.data() || key.data() >= json_.data() + json_.size()) {
+                    key = unescaped_keys_.emplace_back(key);  // key指向解析器的临时缓冲，需要拷贝
+                }
+                members_.push_back({key, raw});
+                return true;
+            });
+            break;
+        default:
+            break;
+    }
+    return members_;
 }
+
+bool JSONObject::FindMember(std::string_view key, std::string_view &raw_value) const {
+    // 与cJSON_GetObjectItem一致：忽略大小写，取第一个匹配的成员
+    auto equals_ignore_case = [](std::string_view lhs, std::string_view rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            if (tolower(static_cast<unsigned char>(lhs[i])) != tolower(static_cast<unsigned char>(rhs[i]))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    const auto &members = Members();
+    if (!is_object_) {
+        return false;
+    }
+    for (const auto &member : members) {
+        if (equals_ignore_case(member.key, key)) {
+            raw_value = member.raw;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JSONObject::FindChild(int index, std::string_view &raw_value) const {
+    // 与cJSON_GetArrayItem一致，对象也可按成员顺序访问
+    const auto &members = Members();
+    if (index < 0 || static_cast<size_t>(index) >= members.size()) {
+        return false;
+    }
+    raw_value = members[index].raw;
+    return true;
+}
+
 std::string JSONObject::GetString(const std::string &key, const std::string &default_value) {
-    if (cjson_ == nullptr) {
+    std::string_view raw;
+    if (!FindMember(key, raw)) {
         return default_value;
     }
-    cJSON *item = cJSON_GetObjectItem(reinterpret_cast<cJSON *>(cjson_), key.c_str());
-    if (item) {
-        std::string str = cJSON_GetStringValue(item);
-        return str;
-    }
-    return default_value;
+    return StringValue(raw, default_value);
 }
 
 std::vector<std::string> JSONObject::GetStringArray(const std::string &key) {
-    if (cjson_ == nullptr) {
-        return std::vector<std::string>();
+    std::vector<std::string> result;
+    std::string_view raw;
+    if (FindMember(key, raw)) {
+        ForEachArrayItem(raw, [&result](std::string_view item) { result.emplace_back(StringValue(item, "")); });
     }
-    cJSON *item = cJSON_GetObjectItem(reinterpret_cast<cJSON *>(cjson_), key.c_str());
-    if (item) {
-        std::vector<std::string> result;
-        for (int i = 0; i < cJSON_GetArraySize(item); ++i) {
-            std::string str = cJSON_GetStringValue(cJSON_GetArrayItem(item, i));
-            result.emplace_back(str);
-        }
-        return result;
-    }
-    return std::vector<std::string>();
+    return result;
 }
 
 double JSONObject::GetNumber(const std::string &key, const double default_value) {
-    if (cjson_ == nullptr) {
+    std::string_view raw;
+    if (!FindMember(key, raw)) {
         return default_value;
     }
-    cJSON *item = cJSON_GetObjectItem(reinterpret_cast<cJSON *>(cjson_), key.c_str());
-    if (item) {
-        return cJSON_GetNumberValue(item);
-    }
-    return default_value;
+    return NumberValue(raw);
 }
 
 std::vector<double> JSONObject::GetNumberArray(const std::string &key) {
-    if (cjson_ == nullptr) {
-        return std::vector<double>();
-    }
-    cJSON *item = cJSON_GetObjectItem(reinterpret_cast<cJSON *>(cjson_), key.c_str());
-    if (item) {
-        std::vector<double> result;
-        for (int i = 0; i < cJSON_GetArraySize(item); ++i) {
-            double number = cJSON_GetNumberValue(cJSON_GetArrayItem(item, i));
-            result.emplace_back(number);
-        }
-        return result;
+    std::vector<double> result;
+    std::string_view raw;
+    if (FindMember(key, raw)) {
+        ForEachArrayItem(raw, [&result](std::string_view item) { result.emplace_back(NumberValue(item)); });
     }
-    return std::vector<double>();
+    return result;
 }
 
 std::shared_ptr<JSONObject> JSONObject::GetArrayItem(int index) {
-    if (cjson_ == nullptr) {
+    std::string_view raw;
+    if (!FindChild(index, raw)) {
         return nullptr;
     }
-    cJSON *item = cJSON_GetArrayItem(reinterpret_cast<cJSON *>(cjson_), index);
-    if (item) {
-        return std::make_shared<JSONObject>(item, shared_from_this());
-    }
-    return nullptr;
+    return std::make_shared<JSONObject>(source_, raw);
 }
 
 int JSONObject::GetArraySize() {
-    if (cjson_ == nullptr) {
-        return 0;
-    }
-    return cJSON_GetArraySize(reinterpret_cast<cJSON *>(cjson_));
+    return static_cast<int>(Members().size());
 }
 
 std::shared_ptr<JSONObject> JSONObject::GetObjectItem(const std::string &key) {
-    if (cjson_ == nullptr) {
+    std::string_view raw;
+    if (!FindMember(key, raw)) {
         return nullptr;
     }
-    cJSON *item = cJSON_GetObjectItem(reinterpret_cast<cJSON *>(cjson_), key.c_str());
-    if (item) {
-        return std::make_shared<JSONObject>(item, shared_from_this());
-    }
-    return nullptr;
+    return std::make_shared<JSONObject>(source_, raw);
 }
 
 }  // end namespace util
@@ -15,16 +15,23 @@
 
 #ifndef CORE_RENDER_OHOS_KRJSONOBJECT_H
 #define CORE_RENDER_OHOS_KRJSONOBJECT_H
+#include <deque>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace kuikly {
 namespace util {
-class JSONObject : public std::enable_shared_from_this<JSONObject> {
+/**
+ * 只读JSON对象，不构建中间DOM；首次访问时扫描一遍当前层级，记录各成员在原始文本中的切片，
+ * 之后的查找只遍历该索引。子对象共享同一份原始文本。非线程安全
+ */
+class JSONObject {
  public:
     static std::shared_ptr<JSONObject> Parse(const std::string &str);
 
-    explicit JSONObject(void *cjson, std::shared_ptr<JSONObject> owner = nullptr);
-    ~JSONObject();
+    JSONObject(std::shared_ptr<const std::string> source, std::string_view json);
 
     std::string GetString(const std::string &key, const std::string &default_value = "");
     std::vector<std::string> GetStringArray(const std::string &key);
@@ -38,8 +45,21 @@ class JSONObject : public std::enable_shared_from_this<JSONObject> {
     std::shared_ptr<JSONObject> GetObjectItem(const std::string &key);
 
  private:
-    void *cjson_ = nullptr;
-    std::shared_ptr<JSONObject> owner_ = nullptr;
+    struct Member {
+        std::string_view key;  // 数组元素为空
+        std::string_view raw;  // 成员值在原始文本中的切片
+    };
+
+    const std::vector<Member> &Members() const;
+    bool FindMember(std::string_view key, std::string_view &raw_value) const;
+    bool FindChild(int index, std::string_view &raw_value) const;
+
+    std::shared_ptr<const std::string> source_;  // 持有原始文本
+    std::string_view json_;                        // 当前值在原始文本中的切片
+    mutable std::vector<Member> members_;
+    mutable std::deque<std::string> unescaped_keys_;  // 含转义的key解码后的存储
+    mutable bool indexed_ = false;
+    mutable bool is_object_ = false;
 };
 
 }  // end namespace util
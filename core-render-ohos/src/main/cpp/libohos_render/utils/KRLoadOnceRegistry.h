@@ -0,0 +1,117 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRLOADONCEREGISTRY_H
+#define CORE_RENDER_OHOS_KRLOADONCEREGISTRY_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * 按 key 只加载一次的登记表：加载可在任意线程发生，同一 key 并发加载时后到者等待先到者完成；
+ * 加载失败不记录，等待者之一随后重试
+ */
+class KRLoadOnceRegistry {
+ public:
+    struct Record {
+        int64_t load_time_us = 0;
+        bool preload = false;
+    };
+
+    /**
+     * @param can_load 未加载时判断能否加载，返回 false 时直接失败，不计入失败次数
+     * @param load 执行加载，返回是否成功；在锁外调用
+     * @return 加载完成后是否可用
+     */
+    bool LoadOnce(const std::string &key, bool preload, const std::function<bool()> &can_load,
+                  const std::function<bool()> &load) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto it = records_.find(key);
+            if (it != records_.end()) {
+                // 加载失败的记录会被移除，需重新查找
+                condition_.wait(lock, [this, &key] {
+                    auto record = records_.find(key);
+                    return record == records_.end() || record->second.state != State::kLoading;
+                });
+                if (records_.find(key) != records_.end()) {
+                    return true;
+                }
+            }
+            if (!can_load()) {
+                return false;
+            }
+            records_[key].record.preload = preload;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        bool success = load();
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (success) {
+                auto &entry = records_[key];
+                entry.state = State::kLoaded;
+                entry.record.load_time_us = cost.count();
+            } else {
+                records_.erase(key);
+                failed_count_++;
+            }
+        }
+        condition_.notify_all();
+        return success;
+    }
+
+    /**
+     * 遍历已加载成功的记录，遍历期间持有锁，visitor 内不可再调用本对象
+     */
+    void ForEachLoaded(const std::function<void(const std::string &, const Record &)> &visitor) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &[key, entry] : records_) {
+            if (entry.state == State::kLoaded) {
+                visitor(key, entry.record);
+            }
+        }
+    }
+
+    uint64_t FailedCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return failed_count_;
+    }
+
+ private:
+    enum class State : uint8_t {
+        kLoading,
+        kLoaded,
+    };
+
+    struct Entry {
+        State state = State::kLoading;
+        Record record;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable condition_;  // 加载结束时通知
+    std::unordered_map<std::string, Entry> records_;
+    uint64_t failed_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRLOADONCEREGISTRY_H
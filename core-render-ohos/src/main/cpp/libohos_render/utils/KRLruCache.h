@@ -0,0 +1,131 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRLRUCACHE_H
+#define CORE_RENDER_OHOS_KRLRUCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * 按字节数计容量的 LRU 缓存，非线程安全，由调用方加锁。
+ * 被替换、移除或淘汰的值移入调用方提供的 evicted，便于在锁外释放
+ */
+template <typename Key, typename Value>
+class KRLruCache {
+ public:
+    explicit KRLruCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+    /**
+     * 查找并把命中的条目移到最近使用端
+     * @return 命中时返回值的指针，在下一次修改缓存前有效；未命中返回 nullptr
+     */
+    Value *Get(const Key &key) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return &it->second.value;
+    }
+
+    /**
+     * 放入条目并淘汰超出容量的旧条目，同 key 的旧值会被替换
+     * @return cost 超过容量上限时不缓存，返回 false
+     */
+    bool Put(const Key &key, Value value, size_t cost, std::vector<Value> &evicted) {
+        Remove(key, evicted);
+        if (cost > max_bytes_) {
+            return false;
+        }
+        lru_.push_front(key);
+        entries_.emplace(key, Entry{std::move(value), cost, lru_.begin()});
+        total_bytes_ += cost;
+        TrimToSize(max_bytes_, evicted);
+        return true;
+    }
+
+    bool Remove(const Key &key, std::vector<Value> &evicted) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+        total_bytes_ -= it->second.cost;
+        lru_.erase(it->second.lru_it);
+        evicted.push_back(std::move(it->second.value));
+        entries_.erase(it);
+        return true;
+    }
+
+    /**
+     * 设置容量上限（字节），超出部分立即淘汰
+     */
+    void SetMaxBytes(size_t max_bytes, std::vector<Value> &evicted) {
+        max_bytes_ = max_bytes;
+        TrimToSize(max_bytes_, evicted);
+    }
+
+    /**
+     * 淘汰最久未使用的条目直至总容量不超过 max_bytes，不改变容量上限
+     */
+    void TrimToSize(size_t max_bytes, std::vector<Value> &evicted) {
+        while (total_bytes_ > max_bytes && !lru_.empty()) {
+            auto it = entries_.find(lru_.back());
+            lru_.pop_back();
+            total_bytes_ -= it->second.cost;
+            evicted.push_back(std::move(it->second.value));
+            entries_.erase(it);
+            eviction_count_++;
+        }
+    }
+
+    size_t Size() const {
+        return entries_.size();
+    }
+
+    size_t TotalBytes() const {
+        return total_bytes_;
+    }
+
+    size_t MaxBytes() const {
+        return max_bytes_;
+    }
+
+    /**
+     * 因容量不足被淘汰的条目数，不含替换与主动移除
+     */
+    uint64_t EvictionCount() const {
+        return eviction_count_;
+    }
+
+ private:
+    struct Entry {
+        Value value;
+        size_t cost = 0;
+        typename std::list<Key>::iterator lru_it;
+    };
+
+    std::unordered_map<Key, Entry> entries_;
+    std::list<Key> lru_;  // 头部为最近使用
+    size_t total_bytes_ = 0;
+    size_t max_bytes_ = 0;
+    uint64_t eviction_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRLRUCACHE_H
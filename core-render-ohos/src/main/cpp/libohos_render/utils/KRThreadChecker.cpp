@@ -17,6 +17,7 @@
 
 #include <unistd.h>
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 static __attribute__((always_inline)) bool isMainThread() {
     return getpid() == gettid();
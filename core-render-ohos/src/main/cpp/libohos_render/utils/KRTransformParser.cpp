@@ -15,69 +15,117 @@
 
 #include "libohos_render/utils/KRTransformParser.h"
 
-#include "libohos_render/utils/KRConvertUtil.h"
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 namespace kuikly {
 namespace util {
-/// 矩阵相乘
-std::array<double, 16> MultiplyMatrices(const std::array<double, 16> &lhs, const std::array<double, 16> &rhs) {
-    std::array<double, 16> result;
-
-    auto lhs00 = lhs[0];
-    auto lhs01 = lhs[1];
-    auto lhs02 = lhs[2];
-    auto lhs03 = lhs[3];
-    auto lhs10 = lhs[4];
-    auto lhs11 = lhs[5];
-    auto lhs12 = lhs[6];
-    auto lhs13 = lhs[7];
-    auto lhs20 = lhs[8];
-    auto lhs21 = lhs[9];
-    auto lhs22 = lhs[10];
-    auto lhs23 = lhs[11];
-    auto lhs30 = lhs[12];
-    auto lhs31 = lhs[13];
-    auto lhs32 = lhs[14];
-    auto lhs33 = lhs[15];
-
-    auto rhs0 = rhs[0];
-    auto rhs1 = rhs[1];
-    auto rhs2 = rhs[2];
-    auto rhs3 = rhs[3];
-    result[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-    result[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-    result[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-    result[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-    rhs0 = rhs[4];
-    rhs1 = rhs[5];
-    rhs2 = rhs[6];
-    rhs3 = rhs[7];
-    result[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-    result[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-    result[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-    result[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-    rhs0 = rhs[8];
-    rhs1 = rhs[9];
-    rhs2 = rhs[10];
-    rhs3 = rhs[11];
-    result[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-    result[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-    result[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-    result[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-    rhs0 = rhs[12];
-    rhs1 = rhs[13];
-    rhs2 = rhs[14];
-    rhs3 = rhs[15];
-    result[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-    result[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-    result[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-    result[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-    return result;
+namespace {
+constexpr size_t kTransformCacheMaxEntries = 32;
+
+/**
+ * 最近解析过的 transform 字符串缓存，动画或列表复用同一 transform 时免去重复解析
+ */
+class KRTransformCache {
+ public:
+    static KRTransformCache &GetInstance() {
+        static KRTransformCache *instance = new KRTransformCache();  // 进程级单例，不析构
+        return *instance;
+    }
+
+    bool Get(const std::string &css_transform, KRTransformParser &result) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(css_transform);
+        if (it == entries_.end()) {
+            return false;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        result = it->second.parser;
+        return true;
+    }
+
+    void Put(const std::string &css_transform, const KRTransformParser &parser) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entries_.find(css_transform) != entries_.end()) {
+            return;
+        }
+        auto it = entries_.emplace(css_transform, Entry{parser, lru_.end()}).first;
+        lru_.push_front(&it->first);
+        it->second.lru_it = lru_.begin();
+        if (entries_.size() > kTransformCacheMaxEntries) {
+            auto oldest = entries_.find(*lru_.back());
+            lru_.pop_back();
+            entries_.erase(oldest);
+        }
+    }
+
+ private:
+    struct Entry {
+        KRTransformParser parser;
+        std::list<const std::string *>::iterator lru_it;
+    };
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<const std::string *> lru_;  // 指向 entries_ 的键，头部为最近使用
+};
+
+/**
+ * 按 delimiter 切分 text，最多写入 max_count 段到 out，返回总段数（与 ConvertSplit 的结果数量一致）
+ */
+size_t SplitInto(std::string_view text, char delimiter, std::string_view *out, size_t max_count) {
+    size_t count = 0;
+    size_t start = 0;
+    while (true) {
+        size_t end = text.find(delimiter, start);
+        if (count < max_count) {
+            out[count] = text.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+        }
+        ++count;
+        if (end == std::string_view::npos) {
+            return count;
+        }
+        start = end + 1;
+    }
 }
 
+/**
+ * 与 ConvertToFloat 行为一致：忽略数值后的多余字符，无法解析或越界时返回 0
+ * token 须指向以 '\0' 结尾的字符串内部
+ */
+float ParseFloat(std::string_view token) {
+    if (token.empty()) {
+        return 0;
+    }
+    const char *begin = token.data();
+    char *end = nullptr;
+    int saved_errno = errno;
+    errno = 0;
+    float value = std::strtof(begin, &end);
+    bool out_of_range = errno == ERANGE;
+    errno = saved_errno;
+    // strtof 会跳过前导空白，解析位置越过 token 说明 token 内没有数值
+    if (end == begin || end > begin + token.size() || out_of_range) {
+        return 0;
+    }
+    return value;
+}
+
+bool ParsePair(std::string_view text, double &first, double &second) {
+    std::string_view pair[2];
+    if (SplitInto(text, ' ', pair, 2) < 2) {
+        return false;
+    }
+    first = ParseFloat(pair[0]);
+    second = ParseFloat(pair[1]);
+    return true;
+}
+}  // namespace
+
 bool KRTransformParser::ParseFromCssTransform(const std::string &css_transform) {
     const size_t ROTATE_INDEX = 0;
     const size_t SCALE_INDEX = 1;
@@ -85,50 +133,34 @@ bool KRTransformParser::ParseFromCssTransform(const std::string &css_transform)
     const size_t ANCHOR_INDEX = 3;
     const size_t SKEW_INDEX = 4;
     const size_t ROTATE_XY_INDEX = 5;
-    
-    auto splits = ConvertSplit(css_transform, "|");
+
+    if (KRTransformCache::GetInstance().Get(css_transform, *this)) {
+        return true;
+    }
+
+    // 在原字符串上切分，不产生临时字符串
+    std::string_view splits[ROTATE_XY_INDEX + 1];
+    size_t split_count = SplitInto(css_transform, '|', splits, ROTATE_XY_INDEX + 1);
     // 至少5个参数
-    if (splits.size() < 5) {
+    if (split_count < 5) {
+        return false;
+    }
+
+    KRTransformParser parsed;
+    parsed.rotate_angle_ = ParseFloat(splits[ROTATE_INDEX]);
+    if (!ParsePair(splits[SCALE_INDEX], parsed.scale_x_, parsed.scale_y_) ||
+        !ParsePair(splits[TRANSLATE_INDEX], parsed.translation_x_, parsed.translation_y_) ||
+        !ParsePair(splits[ANCHOR_INDEX], parsed.anchor_x_, parsed.anchor_y_) ||
+        !ParsePair(splits[SKEW_INDEX], parsed.skew_x_, parsed.skew_y_)) {
         return false;
     }
-    
-    auto checkSize = [](const std::vector<std::string>& v, size_t n) {
-        return v.size() >= n;
-    };
-    
-    rotate_angle_ = ConvertToFloat(splits[ROTATE_INDEX]);
-    
-    auto scales = ConvertSplit(splits[SCALE_INDEX], " ");
-    if (!checkSize(scales, 2)) return false;
-    scale_x_ = ConvertToFloat(scales[0]);
-    scale_y_ = ConvertToFloat(scales[1]);
-    
-    auto translates = ConvertSplit(splits[TRANSLATE_INDEX], " ");
-    if (!checkSize(translates, 2)) return false;
-    translation_x_ = ConvertToFloat(translates[0]);
-    translation_y_ = ConvertToFloat(translates[1]);
-    auto anchors = ConvertSplit(splits[ANCHOR_INDEX], " ");
-    if (!checkSize(anchors, 2)) return false;
-    anchor_x_ = ConvertToFloat(anchors[0]);
-    anchor_y_ = ConvertToFloat(anchors[1]);
-    
-    auto skews = ConvertSplit(splits[SKEW_INDEX], " ");
-    if (!checkSize(skews, 2)) return false;
-    skew_x_ = ConvertToFloat(skews[0]);
-    skew_y_ = ConvertToFloat(skews[1]);
-    
     // 旋转XY
-    if (splits.size() > ROTATE_XY_INDEX) {
-        auto rotateXY = ConvertSplit(splits[ROTATE_XY_INDEX], " ");
-        if (checkSize(rotateXY, 2)) {
-            rotate_x_angle_ = ConvertToFloat(rotateXY[0]);
-            rotate_y_angle_ = ConvertToFloat(rotateXY[1]);
-        }
-    } else {
-        rotate_x_angle_ = 0.0;
-        rotate_y_angle_ = 0.0;
+    if (split_count > ROTATE_XY_INDEX) {
+        ParsePair(splits[ROTATE_XY_INDEX], parsed.rotate_x_angle_, parsed.rotate_y_angle_);
     }
-    
+
+    *this = parsed;
+    KRTransformCache::GetInstance().Put(css_transform, parsed);
     return true;
 }
 
@@ -139,41 +171,26 @@ std::array<double, 16> KRTransformParser::GetMatrixWithNoRotate() {
 std::array<double, 16> KRTransformParser::GenerateTransformMatrix(double translateX, double translateY, double scaleX,
                                                                   double scaleY, double rotate, double skewX,
                                                                   double skewY) {
-    // Initialize identity matrices for scale, rotation, and skew
-    std::array<double, 16> scaleMatrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
-    std::array<double, 16> rotationMatrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
-    std::array<double, 16> skewMatrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
-
-    // Apply translation
-    scaleMatrix[12] = translateX;
-    scaleMatrix[13] = translateY;
-
-    // Apply scale
-    scaleMatrix[0] *= scaleX;
-    scaleMatrix[5] *= scaleY;
-
-    // Apply rotation (clockwise)
-    double radian = rotate * M_PI / 180.0;  // convert degree to radian
-    double cos_radian = cos(radian);
-    double sin_radian = sin(radian);
-
-    rotationMatrix[0] = cos_radian;
-    rotationMatrix[1] = sin_radian;
-    rotationMatrix[4] = -sin_radian;
-    rotationMatrix[5] = cos_radian;
-
-    // Apply skew
-    double skew_x_radian = -skewX * M_PI / 180.0;  // convert degree to radian (clockwise)
-    double skew_y_radian = -skewY * M_PI / 180.0;  // convert degree to radian (clockwise)
-    skewMatrix[4] = tan(skew_x_radian);
-    skewMatrix[1] = tan(skew_y_radian);
-
-    // Multiply the three matrices: scaleMatrix * rotationMatrix * skewMatrix
-    std::array<double, 16> resultMatrix = MultiplyMatrices(scaleMatrix, rotationMatrix);
-    //  return resultMatrix;
-    std::array<double, 16> finalMatrix = MultiplyMatrices(resultMatrix, skewMatrix);
-
-    return finalMatrix;
+    // 行向量约定下依次应用缩放平移、旋转（顺时针）、倾斜：skew * rotation * scale
+    // 三者只作用于 xy 平面，按 2D 仿射闭式展开，角度为 0 时跳过三角函数
+    double cos_radian = 1;
+    double sin_radian = 0;
+    if (rotate != 0) {
+        double radian = rotate * M_PI / 180.0;  // convert degree to radian
+        cos_radian = cos(radian);
+        sin_radian = sin(radian);
+    }
+    double skew_x_tan = skewX != 0 ? tan(-skewX * M_PI / 180.0) : 0;  // clockwise
+    double skew_y_tan = skewY != 0 ? tan(-skewY * M_PI / 180.0) : 0;  // clockwise
+
+    std::array<double, 16> matrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    matrix[0] = (cos_radian - skew_y_tan * sin_radian) * scaleX;
+    matrix[1] = (sin_radian + skew_y_tan * cos_radian) * scaleY;
+    matrix[4] = (skew_x_tan * cos_radian - sin_radian) * scaleX;
+    matrix[5] = (skew_x_tan * sin_radian + cos_radian) * scaleY;
+    matrix[12] = translateX;
+    matrix[13] = translateY;
+    return matrix;
 }
 }  // namespace util
-}  // namespace kuikly
\ No newline at end of file
+}  // namespace kuikly
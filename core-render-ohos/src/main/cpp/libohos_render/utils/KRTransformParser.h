@@ -16,7 +16,9 @@
 #ifndef CORE_RENDER_OHOS_KRTRANSFORMPARSER_H
 #define CORE_RENDER_OHOS_KRTRANSFORMPARSER_H
 
+#include <array>
 #include <memory>
+#include <string>
 
 namespace kuikly {
 namespace util {
@@ -39,6 +41,10 @@ class KRTransformParser : public std::enable_shared_from_this<KRTransformParser>
                                                    double rotate, double skewX, double skewY);
 
  public:
+    /**
+     * 解析 "rotate|scaleX scaleY|translateX translateY|anchorX anchorY|skewX skewY[|rotateX rotateY]"
+     * 在原字符串上切分解析，最近解析过的字符串直接取缓存结果
+     */
     bool ParseFromCssTransform(const std::string &css_transform);
 
     std::array<double, 16> GetMatrixWithNoRotate();
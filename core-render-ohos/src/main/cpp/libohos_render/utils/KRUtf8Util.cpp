@@ -0,0 +1,107 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRUtf8Util.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace kuikly {
+namespace util {
+
+// 从 p 开始的 16 字节是否全为 ASCII
+static inline bool IsAsciiBlock16(const uint8_t *p) {
+#if defined(__aarch64__)
+    return vmaxvq_u8(vld1q_u8(p)) < 0x80;
+#elif defined(__SSE2__)
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) == 0;
+#else
+    uint64_t lo;
+    uint64_t hi;
+    std::memcpy(&lo, p, sizeof(lo));
+    std::memcpy(&hi, p + sizeof(lo), sizeof(hi));
+    return ((lo | hi) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+size_t Utf16Length(std::string_view utf8) {
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(utf8.data());
+    const size_t n = utf8.size();
+    size_t i = 0;
+    size_t count = 0;
+    while (i < n) {
+        uint8_t lead = p[i];
+        if (lead < 0x80) {
+            // ASCII 连续段按 16 字节整块跳过
+            while (i + 16 <= n && IsAsciiBlock16(p + i)) {
+                i += 16;
+                count += 16;
+            }
+            while (i < n && p[i] < 0x80) {
+                ++i;
+                ++count;
+            }
+            continue;
+        }
+        // 按 Unicode 表 3-7 校验：第二字节的合法范围取决于首字节，后续字节为 80..BF
+        int trailing = 0;
+        uint8_t second_min = 0x80;
+        uint8_t second_max = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            trailing = 1;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            trailing = 2;
+            if (lead == 0xE0) {
+                second_min = 0xA0;
+            } else if (lead == 0xED) {
+                second_max = 0x9F;
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            trailing = 3;
+            if (lead == 0xF0) {
+                second_min = 0x90;
+            } else if (lead == 0xF4) {
+                second_max = 0x8F;
+            }
+        }
+        ++i;
+        ++count;
+        if (trailing == 0) {
+            continue;
+        }
+        if (i >= n || p[i] < second_min || p[i] > second_max) {
+            continue;
+        }
+        ++i;
+        int matched = 1;
+        while (matched < trailing && i < n && (p[i] & 0xC0) == 0x80) {
+            ++i;
+            ++matched;
+        }
+        if (matched == trailing && trailing == 3) {
+            ++count;  // 辅助平面字符占一对代理
+        }
+    }
+    return count;
+}
+
+}  // namespace util
+}  // namespace kuikly
@@ -0,0 +1,34 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRUTF8UTIL_H
+#define CORE_RENDER_OHOS_KRUTF8UTIL_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace kuikly {
+namespace util {
+
+/**
+ * 计算 UTF-8 字符串转为 UTF-16 后的码元数，不分配内存
+ * 四字节序列计 2 个码元（代理对），非法序列按最大子部分各计 1 个替换字符 U+FFFD
+ */
+size_t Utf16Length(std::string_view utf8);
+
+}  // namespace util
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRUTF8UTIL_H
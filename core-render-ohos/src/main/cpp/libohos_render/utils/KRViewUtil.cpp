@@ -539,16 +539,16 @@ void UpdateNodeTransform(ArkUI_NodeHandle nodeHandle,
 						 const std::string &cssTransform, 
                          KRSize size) {
     auto nodeAPI = GetNodeApi();
-    auto transform = std::make_shared<KRTransformParser>();
+    KRTransformParser transform;
     
-    if (!transform->ParseFromCssTransform(cssTransform)) {
+    if (!transform.ParseFromCssTransform(cssTransform)) {
         return;
     }
     // 设置变换中心点
     ArkUI_NumberValue transformCenterValue[] = {
         0, 0, 0, 
-        static_cast<float>(transform->anchor_x_),
-        static_cast<float>(transform->anchor_y_)
+        static_cast<float>(transform.anchor_x_),
+        static_cast<float>(transform.anchor_y_)
     };
     ArkUI_AttributeItem transformCenterItem = {
         transformCenterValue, 
@@ -556,7 +556,7 @@ void UpdateNodeTransform(ArkUI_NodeHandle nodeHandle,
     };
     nodeAPI->setAttribute(nodeHandle, NODE_TRANSFORM_CENTER, &transformCenterItem);
     // 处理平移变换（转换为px单位）
-    auto matrix = transform->GetMatrixWithNoRotate();
+    auto matrix = transform.GetMatrixWithNoRotate();
     matrix[12] *= size.width;   // X轴平移
     matrix[13] *= size.height;  // Y轴平移
     // 设置变换矩阵
@@ -569,9 +569,9 @@ void UpdateNodeTransform(ArkUI_NodeHandle nodeHandle,
     
     // 处理旋转变换（欧拉角→轴角）
     RotationResult rotation = ConvertEulerToAxisAngle(
-        transform->rotate_x_angle_,
-        transform->rotate_y_angle_,
-        transform->rotate_angle_
+        transform.rotate_x_angle_,
+        transform.rotate_y_angle_,
+        transform.rotate_angle_
     );
     // 设置旋转属性
     ArkUI_NumberValue rotateValue[] = {
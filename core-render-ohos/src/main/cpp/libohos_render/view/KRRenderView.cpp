@@ -17,6 +17,7 @@
 
 #include <functional>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
+#include "libohos_render/expand/components/richtext/KRFontCollectionManager.h"
 #include "libohos_render/manager/KRRenderManager.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
@@ -216,6 +217,8 @@ void KRRenderView::Init(std::shared_ptr<KRRenderContextParams> context, ArkUI_Co
     context_ = context;
     ui_context_handle_ = ui_context_handle;
     native_resources_manager_ = native_resources_manager;
+    KRFontCollectionManager::GetInstance()->PreloadFonts(context->Config()->GetPreloadFontFamilies(),
+                                                         native_resources_manager);
     performance_manager_ = std::make_shared<KRPerformanceManager>(context->PageName(), context->ExecuteMode());
     performance_manager_->SetArkLaunchTime(launch_time);
     root_view_width_ = width;
@@ -15,7 +15,9 @@
 #include <ark_runtime/jsvm.h>
 #include <arkui/native_node_napi.h>
 #include <cstdint>
+#include "libohos_render/expand/components/apng/APNGCache.h"
 #include "libohos_render/expand/modules/back_press/KRBackPressModule.h"
+#include "libohos_render/expand/modules/cache/KRImageMemoryCache.h"
 #include "libohos_render/foundation/KRCallbackData.h"
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/manager/KRRenderManager.h"
@@ -35,6 +37,20 @@ static napi_value OnLaunchStart(napi_env env, napi_callback_info info) {
     KRRenderManager::GetInstance().OnLaunchStart(instance_id);
     return 0;
 }
+//  系统内存告警，释放进程级缓存
+static napi_value OnMemoryLevel(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    int32_t level = 0;
+    napi_get_value_int32(env, args[0], &level);
+    APNGCache::GetInstance().OnMemoryLevel(level);
+    KRImageMemoryCache::GetInstance().OnMemoryLevel(level);
+    return 0;
+}
 static napi_value UpdateConfig(napi_env env, napi_callback_info info) {
     size_t argc = 2;
     napi_value args[2] = {nullptr};
@@ -204,6 +220,7 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"sendEvent", nullptr, ArkTSOnSendEvent, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"updateConfig", nullptr, UpdateConfig, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"OnLaunchStart", nullptr, OnLaunchStart, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"onMemoryLevel", nullptr, OnMemoryLevel, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"createNativeRoot", nullptr, CreateNativeRoot, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"isBackPressConsumed", nullptr, isBackPressConsumed, nullptr, nullptr, nullptr, napi_default, nullptr},
     };
@@ -44,6 +44,11 @@ export const updateConfig: (instanceId: string, configJson: string) => number
  * @param excuteMode 运行模式
  */
 export const OnLaunchStart: (instanceId: string, excuteMode: number) => void
+/**
+ * 系统内存告警通知到Native层，用于释放进程级缓存。
+ * @param level 内存级别，取值同AbilityConstant.MemoryLevel
+ */
+export const onMemoryLevel: (level: number) => void
 /*
  * ArkTS调用Native侧方法唯一通信通道
  * @param instanceId 实例id
@@ -0,0 +1,182 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "libohos_render/expand/components/apng/APNGBlendKernels.h"
+#include "libohos_render/expand/components/apng/APNGCompositor.h"
+
+namespace {
+std::vector<uint8_t> RandomPixels(std::mt19937 &rng, size_t pixel_count, int alpha_mode) {
+    std::vector<uint8_t> pixels(pixel_count * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(rng());
+        if (i % 4 == 3) {
+            switch (alpha_mode) {
+                case 0:  // 全不透明
+                    pixels[i] = 255;
+                    break;
+                case 1:  // 全透明
+                    pixels[i] = 0;
+                    break;
+                case 2:  // 混合 0/255/半透明，覆盖向量化各分支
+                    pixels[i] = rng() % 3 == 0 ? 255 : (rng() % 2 ? 0 : pixels[i]);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return pixels;
+}
+
+/**
+ * 逐像素实现的参考合成器，dispose_op 为 2 时保存整张画布
+ */
+class ReferenceCompositor {
+ public:
+    ReferenceCompositor(int width, int height) : width_(width), height_(height), canvas_(width * height * 4, 0) {}
+
+    bool ComposeFrame(const APNGFrameRegion &region, const uint8_t *pixels) {
+        if (region.width <= 0 || region.height <= 0 || region.left < 0 || region.top < 0 ||
+            static_cast<int64_t>(region.left) + region.width > width_ ||
+            static_cast<int64_t>(region.top) + region.height > height_) {
+            return false;
+        }
+        saved_ = canvas_;
+        for (int y = 0; y < region.height; ++y) {
+            for (int x = 0; x < region.width; ++x) {
+                const uint8_t *src = pixels + (y * region.width + x) * 4;
+                uint8_t *dst = Pixel(region.left + x, region.top + y);
+                if (region.blendOp == 0) {
+                    memcpy(dst, src, 4);
+                } else if (region.blendOp == 1) {
+                    APNGBlendRowOverScalar(dst, src, 1);
+                }
+            }
+        }
+        return true;
+    }
+
+    void DisposeFrame(const APNGFrameRegion &region) {
+        for (int y = 0; y < region.height; ++y) {
+            for (int x = 0; x < region.width; ++x) {
+                size_t offset = Pixel(region.left + x, region.top + y) - canvas_.data();
+                for (int c = 0; c < 4; ++c) {
+                    if (region.disposeOp == 1) {
+                        canvas_[offset + c] = 0;
+                    } else if (region.disposeOp == 2) {
+                        canvas_[offset + c] = saved_[offset + c];
+                    }
+                }
+            }
+        }
+    }
+
+    const std::vector<uint8_t> &Canvas() const {
+        return canvas_;
+    }
+
+ private:
+    uint8_t *Pixel(int x, int y) {
+        return canvas_.data() + (static_cast<size_t>(y) * width_ + x) * 4;
+    }
+
+    int width_;
+    int height_;
+    std::vector<uint8_t> canvas_;
+    std::vector<uint8_t> saved_;
+};
+}  // namespace
+
+TEST(APNGCompositorTest, BlendRowOverMatchesScalar) {
+    std::mt19937 rng(8);
+    for (int round = 0; round < 2000; ++round) {
+        int pixel_count = rng() % 70;
+        auto src = RandomPixels(rng, pixel_count, rng() % 4);
+        auto dst = RandomPixels(rng, pixel_count, rng() % 2 ? 0 : 3);  // 多数向量分支要求目标不透明
+        auto expected = dst;
+        APNGBlendRowOverScalar(expected.data(), src.data(), pixel_count);
+        APNGBlendRowOver(dst.data(), src.data(), pixel_count);
+        ASSERT_EQ(dst, expected) << "round " << round << ", pixels " << pixel_count;
+    }
+}
+
+TEST(APNGCompositorTest, MatchesReferenceCompositor) {
+    std::mt19937 rng(9);
+    for (int round = 0; round < 200; ++round) {
+        int width = 1 + rng() % 40;
+        int height = 1 + rng() % 40;
+        APNGCompositor compositor(width, height);
+        ReferenceCompositor reference(width, height);
+        for (int frame_index = 0; frame_index < 12; ++frame_index) {
+            APNGFrameRegion region;
+            // 首帧覆盖全画布，其余帧随机，包括越界的区域
+            region.width = frame_index == 0 ? width : 1 + rng() % (width + 4);
+            region.height = frame_index == 0 ? height : 1 + rng() % (height + 4);
+            region.left = frame_index == 0 ? 0 : static_cast<int>(rng() % (width + 2)) - 1;
+            region.top = frame_index == 0 ? 0 : static_cast<int>(rng() % (height + 2)) - 1;
+            region.blendOp = rng() % 2;
+            region.disposeOp = rng() % 3;
+            auto pixels = RandomPixels(rng, static_cast<size_t>(region.width) * region.height, rng() % 4);
+
+            bool composed = compositor.ComposeFrame(region, pixels.data());
+            ASSERT_EQ(composed, reference.ComposeFrame(region, pixels.data()));
+            ASSERT_EQ(compositor.Canvas(), reference.Canvas());
+            if (composed) {
+                compositor.DisposeFrame(region);
+                reference.DisposeFrame(region);
+                ASSERT_EQ(compositor.Canvas(), reference.Canvas());
+            }
+        }
+    }
+}
+
+TEST(APNGCompositorTest, RejectsRegionsOutsideCanvas) {
+    APNGCompositor compositor(8, 8);
+    std::vector<uint8_t> pixels(64 * 4, 0xFF);
+    std::vector<uint8_t> blank(8 * 8 * 4, 0);
+    const APNGFrameRegion invalid[] = {
+        {0, 0, 0, 8, 0, 0},       {0, 0, 8, -1, 0, 0},  {-1, 0, 4, 4, 0, 0},       {0, -1, 4, 4, 0, 0},
+        {5, 0, 4, 4, 0, 0},       {0, 5, 4, 4, 0, 0},   {INT_MAX, 0, 4, 4, 0, 0},  {4, 0, INT_MAX, 4, 0, 0},
+        {0, INT_MAX, 4, 4, 1, 0}, {0, 0, 9, 8, 1, 0},
+    };
+    for (const auto &region : invalid) {
+        EXPECT_FALSE(compositor.Contains(region));
+        EXPECT_FALSE(compositor.ComposeFrame(region, pixels.data()));
+        // 越界帧的 dispose 也不能写画布
+        compositor.DisposeFrame(APNGFrameRegion{region.left, region.top, region.width, region.height, 1, 0});
+        EXPECT_EQ(compositor.Canvas(), blank);
+    }
+}
+
+TEST(APNGCompositorTest, IgnoresRestoreWithoutMatchingSnapshot) {
+    APNGCompositor compositor(8, 8);
+    std::vector<uint8_t> pixels(64 * 4, 0xFF);
+    ASSERT_TRUE(compositor.ComposeFrame({0, 0, 8, 8, 0, 0}, pixels.data()));
+    ASSERT_TRUE(compositor.ComposeFrame({0, 0, 2, 2, 2, 0}, pixels.data()));
+    auto canvas = compositor.Canvas();
+    // 恢复点属于 2x2 的帧，按更大区域恢复会越界读取，需忽略
+    compositor.DisposeFrame({0, 0, 4, 4, 2, 0});
+    EXPECT_EQ(compositor.Canvas(), canvas);
+    // 之后的帧不需要恢复点时旧的恢复点作废
+    ASSERT_TRUE(compositor.ComposeFrame({0, 0, 8, 8, 0, 0}, pixels.data()));
+    compositor.DisposeFrame({0, 0, 2, 2, 2, 0});
+    EXPECT_EQ(compositor.Canvas(), std::vector<uint8_t>(8 * 8 * 4, 0xFF));
+}
@@ -0,0 +1,248 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+#include "libohos_render/expand/components/apng/ApngParser.h"
+
+namespace {
+/**
+ * 主机测试用编解码器：样例 APNG 的 IDAT/fdAT 直接存放 RGBA 像素，解码即拼接重组后的 IDAT 数据
+ */
+class RawPixelCodec : public APNGFrameCodec {
+ public:
+    struct Drawable : APNGDrawable {
+        std::vector<uint8_t> pixels;
+    };
+
+    bool Decode(const Frame &frame, std::vector<uint8_t> &pixels) override {
+        std::vector<uint8_t> bytes = frame.data;
+        pixels.clear();
+        bool size_matched = false;
+        eachChunk(bytes, [&](const std::string &type, std::vector<uint8_t> &bytes, size_t off, size_t length) {
+            DataView dv(bytes);
+            if (type == "IHDR") {
+                size_matched = dv.getUint32(off + 8) == frame.width && dv.getUint32(off + 12) == frame.height;
+            } else if (type == "IDAT") {
+                pixels.insert(pixels.end(), bytes.begin() + off + 8, bytes.begin() + off + 8 + length);
+            }
+            return true;
+        });
+        return size_matched && pixels.size() == static_cast<size_t>(frame.width) * frame.height * 4;
+    }
+
+    std::shared_ptr<APNGDrawable> MakeDrawable(int width, int height, const std::vector<uint8_t> &canvas) override {
+        auto drawable = std::make_shared<Drawable>();
+        drawable->pixels = canvas;
+        return drawable;
+    }
+};
+
+struct SampleFrame {
+    APNGFrameRegion region;
+    int parts = 1;  // 像素数据拆分的 IDAT/fdAT 块数
+    std::vector<uint8_t> pixels;
+};
+
+struct Sample {
+    int width = 0;
+    int height = 0;
+    std::vector<SampleFrame> frames;
+};
+
+std::vector<uint8_t> RandomPixels(std::mt19937 &rng, size_t pixel_count) {
+    std::vector<uint8_t> pixels(pixel_count * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(rng());
+        if (i % 4 == 3) {  // 混合 0/255/半透明
+            pixels[i] = rng() % 3 == 0 ? 255 : (rng() % 2 ? 0 : pixels[i]);
+        }
+    }
+    return pixels;
+}
+
+Sample MakeSample(int width, int height, const std::vector<std::pair<APNGFrameRegion, int>> &regions) {
+    std::mt19937 rng(width * 131 + height);
+    Sample sample{width, height, {}};
+    for (const auto &item : regions) {
+        SampleFrame frame;
+        frame.region = item.first;
+        frame.parts = item.second;
+        frame.pixels = RandomPixels(rng, static_cast<size_t>(item.first.width) * item.first.height);
+        sample.frames.push_back(std::move(frame));
+    }
+    return sample;
+}
+
+std::vector<uint8_t> Concat(std::vector<uint8_t> a, const std::vector<uint8_t> &b) {
+    a.insert(a.end(), b.begin(), b.end());
+    return a;
+}
+
+std::vector<uint8_t> EncodeAPNG(const Sample &sample) {
+    std::vector<uint8_t> bytes = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    auto append = [&bytes](const std::string &type, const std::vector<uint8_t> &data) {
+        bytes = Concat(std::move(bytes), makeChunkBytes(type, data));
+    };
+    append("IHDR", Concat(Concat(makeDWordArray(sample.width), makeDWordArray(sample.height)), {8, 6, 0, 0, 0}));
+    append("acTL", Concat(makeDWordArray(sample.frames.size()), makeDWordArray(0)));
+    uint32_t sequence = 0;
+    for (size_t i = 0; i < sample.frames.size(); ++i) {
+        const auto &frame = sample.frames[i];
+        const auto &region = frame.region;
+        auto fctl = makeDWordArray(sequence++);
+        for (int value : {region.width, region.height, region.left, region.top}) {
+            fctl = Concat(std::move(fctl), makeDWordArray(value));
+        }
+        uint16_t delay = static_cast<uint16_t>(20 + i * 10);
+        fctl = Concat(std::move(fctl), {0, static_cast<uint8_t>(delay), 0x03, 0xe8, static_cast<uint8_t>(region.disposeOp),
+                                        static_cast<uint8_t>(region.blendOp)});
+        append("fcTL", fctl);
+        size_t part_size = (frame.pixels.size() + frame.parts - 1) / frame.parts;
+        for (size_t off = 0; off < frame.pixels.size(); off += part_size) {
+            std::vector<uint8_t> part(frame.pixels.begin() + off,
+                                      frame.pixels.begin() + std::min(off + part_size, frame.pixels.size()));
+            if (i == 0) {
+                append("IDAT", part);
+            } else {
+                append("fdAT", Concat(makeDWordArray(sequence++), part));
+            }
+        }
+    }
+    append("IEND", {});
+    return bytes;
+}
+
+std::shared_ptr<APNG> Parse(const Sample &sample, RawPixelCodec &codec, size_t budget) {
+    size_t saved_budget = APNG::GetMemoryBudget();
+    APNG::SetMemoryBudget(budget);
+    auto bytes = EncodeAPNG(sample);
+    std::shared_ptr<APNG> result;
+    parseAPNG(bytes, &codec, [&result](std::shared_ptr<APNG> apng) { result = apng; });
+    APNG::SetMemoryBudget(saved_budget);
+    return result;
+}
+
+const RawPixelCodec::Drawable *AsRaw(const std::shared_ptr<APNGDrawable> &drawable) {
+    return dynamic_cast<const RawPixelCodec::Drawable *>(drawable.get());
+}
+
+std::shared_ptr<APNGDrawable> WaitDrawable(APNGFrameStream &stream, int index) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (true) {
+        auto drawable = stream.GetDrawable(index);
+        if (drawable || std::chrono::steady_clock::now() > deadline) {
+            return drawable;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+/**
+ * 全量解码与流式解码逐帧比对：流式缓冲仅 2 帧，按 2 轮多的循环播放顺序取帧并穿插回退
+ */
+void ExpectEagerMatchesStream(const Sample &sample) {
+    RawPixelCodec codec;
+    auto eager = Parse(sample, codec, SIZE_MAX);
+    auto lazy = Parse(sample, codec, 0);
+    ASSERT_TRUE(eager && lazy);
+    ASSERT_FALSE(eager->IsStreaming());
+    ASSERT_TRUE(lazy->IsStreaming());
+    const int count = static_cast<int>(sample.frames.size());
+    ASSERT_EQ(eager->DrawableCount(), count);
+    ASSERT_EQ(lazy->DrawableCount(), count);
+
+    auto stream = std::make_shared<APNGFrameStream>(lazy, 2);
+    std::vector<int> order;
+    for (int i = 0; i < count * 2 + 2; ++i) {
+        order.push_back(i % count);
+    }
+    order.insert(order.end(), {count - 1, 1, 2});  // 跳帧与回退后重新合成
+    for (int index : order) {
+        auto expected_drawable = eager->GetDrawable(index);
+        auto actual_drawable = WaitDrawable(*stream, index);
+        auto expected = AsRaw(expected_drawable);
+        auto actual = AsRaw(actual_drawable);
+        ASSERT_NE(expected, nullptr);
+        ASSERT_NE(actual, nullptr) << "frame " << index;
+        EXPECT_EQ(actual->pixels, expected->pixels) << "frame " << index;
+        EXPECT_EQ(actual->nextFrameDelay, expected->nextFrameDelay) << "frame " << index;
+        EXPECT_EQ(actual->isLast, expected->isLast) << "frame " << index;
+    }
+    stream->Cancel();
+}
+
+/**
+ * 画布坐标 (x, y) 的 RGBA
+ */
+std::vector<uint8_t> PixelAt(const std::shared_ptr<APNGDrawable> &drawable, int width, int x, int y) {
+    auto raw = AsRaw(drawable);
+    auto it = raw->pixels.begin() + (static_cast<size_t>(y) * width + x) * 4;
+    return std::vector<uint8_t>(it, it + 4);
+}
+}  // namespace
+
+TEST(APNGStructsTest, ParsesFramesAndTimingThroughCodec) {
+    auto sample = MakeSample(8, 6, {{{0, 0, 8, 6, 0, 0}, 1}, {{1, 2, 3, 3, 1, 1}, 3}});
+    RawPixelCodec codec;
+    auto apng = Parse(sample, codec, SIZE_MAX);
+    ASSERT_TRUE(apng);
+    EXPECT_TRUE(apng->isAPNG);
+    EXPECT_EQ(apng->width, 8);
+    EXPECT_EQ(apng->height, 6);
+    EXPECT_FALSE(apng->IsParsing());
+    ASSERT_EQ(apng->DrawableCount(), 2);
+    EXPECT_EQ(AsRaw(apng->GetDrawable(0))->pixels, sample.frames[0].pixels);
+    EXPECT_EQ(apng->GetDrawable(0)->nextFrameDelay, 30);
+    EXPECT_FALSE(apng->GetDrawable(0)->isLast);
+    EXPECT_TRUE(apng->GetDrawable(1)->isLast);
+}
+
+TEST(APNGStructsTest, StreamMatchesEagerWithDisposePrevious) {
+    // 6 帧覆盖 dispose_op 0/1/2 与 blend_op 0/1，部分帧数据拆成多个 fdAT
+    auto sample = MakeSample(16, 12, {{{0, 0, 16, 12, 0, 0}, 1},
+                                      {{2, 3, 6, 5, 2, 1}, 2},
+                                      {{4, 1, 8, 8, 1, 1}, 1},
+                                      {{0, 0, 5, 4, 2, 0}, 3},
+                                      {{10, 6, 6, 6, 0, 1}, 1},
+                                      {{1, 1, 14, 10, 2, 1}, 2}});
+    ExpectEagerMatchesStream(sample);
+
+    // 帧 1 的 dispose_op 2 恢复后，帧 1 区域中帧 2 未覆盖的部分回到帧 0 的画面
+    RawPixelCodec codec;
+    auto apng = Parse(sample, codec, SIZE_MAX);
+    EXPECT_NE(AsRaw(apng->GetDrawable(1))->pixels, AsRaw(apng->GetDrawable(0))->pixels);
+    for (int y = 3; y < 8; ++y) {
+        for (int x = 2; x < 4; ++x) {
+            EXPECT_EQ(PixelAt(apng->GetDrawable(2), 16, x, y), PixelAt(apng->GetDrawable(0), 16, x, y));
+        }
+    }
+}
+
+TEST(APNGStructsTest, StreamMatchesEagerWithConsecutiveRestores) {
+    // 首帧半透明合成到空画布，随后连续 dispose_op 2
+    auto sample = MakeSample(9, 7, {{{0, 0, 9, 7, 0, 1}, 2},
+                                    {{0, 0, 9, 7, 2, 1}, 1},
+                                    {{3, 2, 4, 4, 2, 1}, 3},
+                                    {{1, 1, 7, 5, 1, 0}, 1}});
+    ExpectEagerMatchesStream(sample);
+}
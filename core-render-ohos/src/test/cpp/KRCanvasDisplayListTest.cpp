@@ -0,0 +1,101 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "fake_sdk/KRFakeSdk.h"
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+
+namespace {
+template <typename T> T *FakeHandle(uintptr_t id) {
+    return reinterpret_cast<T *>(id * 16);
+}
+}  // namespace
+
+TEST(KRCanvasDisplayListTest, StoresArgsContiguously) {
+    KRCanvasDisplayList list;
+    list.Add(KRCanvasOpCode::kBeginPath);
+    list.Add(KRCanvasOpCode::kMoveTo, 0, {1, 2});
+    list.Add(KRCanvasOpCode::kArcTo, 0, {0, 0, 10, 10, 90, 180});
+    list.Add(KRCanvasOpCode::kStroke);
+    list.Add(KRCanvasOpCode::kDrawImage, 0, {1, 2, -1, -1, 0, 0, NAN, NAN});
+
+    ASSERT_EQ(list.Size(), 5u);
+    const auto &ops = list.Ops();
+    EXPECT_EQ(ops[1].code, KRCanvasOpCode::kMoveTo);
+    EXPECT_EQ(list.Args(ops[1])[0], 1);
+    EXPECT_EQ(list.Args(ops[1])[1], 2);
+    EXPECT_EQ(list.Args(ops[2])[4], 90);
+    EXPECT_EQ(list.Args(ops[2])[5], 180);
+    EXPECT_EQ(list.Args(ops[4])[2], -1);
+    EXPECT_TRUE(std::isnan(list.Args(ops[4])[7]));
+    // 无参指令不占用参数池
+    EXPECT_EQ(ops[3].arg_offset, ops[4].arg_offset);
+}
+
+TEST(KRCanvasDisplayListTest, InternsStrings) {
+    KRCanvasDisplayList list;
+    auto hello = list.InternString("hello");
+    auto world = list.InternString("world");
+    EXPECT_NE(hello, world);
+    EXPECT_EQ(list.InternString("hello"), hello);
+    EXPECT_EQ(list.String(hello), "hello");
+    EXPECT_EQ(list.String(world), "world");
+    list.Clear();
+    EXPECT_EQ(list.InternString("world"), 0u);
+}
+
+TEST(KRCanvasDisplayListTest, ReleasesEffectsOnClear) {
+    auto &sdk = KRFakeSdk::GetInstance();
+    sdk.Reset();
+    {
+        KRCanvasDisplayList list;
+        auto gradient = list.AddShaderEffect("linear-gradient(a)", FakeHandle<OH_Drawing_ShaderEffect>(1));
+        EXPECT_EQ(list.FindShaderEffect("linear-gradient(a)"), gradient);
+        EXPECT_EQ(list.FindShaderEffect("linear-gradient(b)"), KRCanvasDisplayList::kNoRef);
+        auto dash = list.AddPathEffect(FakeHandle<OH_Drawing_PathEffect>(2));
+        EXPECT_EQ(list.ShaderEffect(gradient), FakeHandle<OH_Drawing_ShaderEffect>(1));
+        EXPECT_EQ(list.PathEffect(dash), FakeHandle<OH_Drawing_PathEffect>(2));
+        EXPECT_TRUE(sdk.destroyed_shader_effects.empty());
+
+        list.Clear();
+        EXPECT_EQ(sdk.destroyed_shader_effects.size(), 1u);
+        EXPECT_EQ(sdk.destroyed_path_effects.size(), 1u);
+        EXPECT_EQ(list.FindShaderEffect("linear-gradient(a)"), KRCanvasDisplayList::kNoRef);
+
+        list.AddShaderEffect("linear-gradient(c)", FakeHandle<OH_Drawing_ShaderEffect>(3));
+    }
+    // 析构时释放剩余的效果，且每个只释放一次
+    ASSERT_EQ(sdk.destroyed_shader_effects.size(), 2u);
+    EXPECT_EQ(sdk.destroyed_shader_effects[1], FakeHandle<OH_Drawing_ShaderEffect>(3));
+    EXPECT_EQ(sdk.destroyed_path_effects.size(), 1u);
+}
+
+TEST(KRCanvasDisplayListTest, KeepsShaderEffectsBelowApi19) {
+    auto &sdk = KRFakeSdk::GetInstance();
+    sdk.Reset();
+    sdk.api_version = 18;
+    {
+        KRCanvasDisplayList list;
+        list.AddShaderEffect("linear-gradient(a)", FakeHandle<OH_Drawing_ShaderEffect>(1));
+        list.AddPathEffect(FakeHandle<OH_Drawing_PathEffect>(2));
+    }
+    // 与 KRParagraph 一致，低版本不调用 OH_Drawing_ShaderEffectDestroy
+    EXPECT_TRUE(sdk.destroyed_shader_effects.empty());
+    EXPECT_EQ(sdk.destroyed_path_effects.size(), 1u);
+    sdk.Reset();
+}
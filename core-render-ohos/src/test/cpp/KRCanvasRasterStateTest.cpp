@@ -0,0 +1,61 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libohos_render/expand/components/canvas/KRCanvasRasterState.h"
+
+TEST(KRCanvasRasterStateTest, FirstFrameReplaysEverything) {
+    KRCanvasRasterState state;
+    EXPECT_TRUE(state.BeginFrame(100, 100, 2));
+    EXPECT_EQ(state.RasterizedCount(), 0u);
+}
+
+TEST(KRCanvasRasterStateTest, LaterFramesOnlyDrawAppendedOps) {
+    KRCanvasRasterState state;
+    ASSERT_TRUE(state.BeginFrame(100, 100, 2));
+    state.EndFrame(10);
+    EXPECT_FALSE(state.BeginFrame(100, 100, 2));
+    EXPECT_EQ(state.RasterizedCount(), 10u);
+    state.EndFrame(25);
+    EXPECT_FALSE(state.BeginFrame(100, 100, 2));
+    EXPECT_EQ(state.RasterizedCount(), 25u);
+}
+
+TEST(KRCanvasRasterStateTest, GeometryChangeForcesFullReplay) {
+    KRCanvasRasterState state;
+    state.BeginFrame(100, 100, 2);
+    state.EndFrame(10);
+    EXPECT_TRUE(state.BeginFrame(100, 120, 2));
+    EXPECT_EQ(state.RasterizedCount(), 0u);
+    state.EndFrame(10);
+    EXPECT_TRUE(state.BeginFrame(100, 120, 3));
+    EXPECT_EQ(state.RasterizedCount(), 0u);
+}
+
+TEST(KRCanvasRasterStateTest, InvalidateInsideFrameAppliesToNextFrame) {
+    KRCanvasRasterState state;
+    state.BeginFrame(100, 100, 2);
+    state.EndFrame(10);
+    ASSERT_FALSE(state.BeginFrame(100, 100, 2));
+    // 如图片尚未就绪：本帧照常结束，下一帧从头回放
+    state.Invalidate();
+    state.EndFrame(12);
+    EXPECT_TRUE(state.BeginFrame(100, 100, 2));
+    EXPECT_EQ(state.RasterizedCount(), 0u);
+    state.EndFrame(12);
+    EXPECT_FALSE(state.BeginFrame(100, 100, 2));
+    EXPECT_EQ(state.RasterizedCount(), 12u);
+}
@@ -0,0 +1,113 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRExecutionToken.h"
+
+TEST(KRExecutionTokenTest, CallersAndWorkerNeverOverlap) {
+    KRExecutionToken token;
+    std::atomic<int> inside{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<bool> stop{false};
+    auto enter = [&] {
+        if (inside.fetch_add(1) != 0) {
+            overlapped = true;
+        }
+        inside.fetch_sub(1);
+    };
+    std::thread worker([&] {
+        while (!stop.load()) {
+            token.AcquireForWorker();
+            while (!token.HasWaiter() && !stop.load()) {
+                enter();
+            }
+            token.Release();
+        }
+    });
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 3; i++) {
+        callers.emplace_back([&] {
+            for (int j = 0; j < 2000; j++) {
+                ASSERT_TRUE(token.AcquireForCaller());
+                enter();
+                token.Release();
+            }
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+    stop = true;
+    worker.join();
+    EXPECT_FALSE(overlapped.load());
+}
+
+TEST(KRExecutionTokenTest, WorkerYieldsToWaitingCallerBetweenTasks) {
+    // 工作线程只在有等待者时让出，调用方若拿不到执行权会一直阻塞
+    KRExecutionToken token;
+    std::atomic<uint64_t> task_count{0};
+    std::atomic<bool> stop{false};
+    std::thread worker([&] {
+        while (!stop.load()) {
+            token.AcquireForWorker();
+            while (!token.HasWaiter() && !stop.load()) {
+                task_count++;
+            }
+            token.Release();
+        }
+    });
+    while (task_count.load() == 0) {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(token.AcquireForCaller());
+    auto count = task_count.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(task_count.load(), count);  // 持有执行权期间工作线程不执行任务
+    token.Release();
+    while (task_count.load() == count) {
+        std::this_thread::yield();
+    }
+    stop = true;
+    worker.join();
+}
+
+TEST(KRExecutionTokenTest, CallerFailsWhileWorkerWaitsMainThread) {
+    KRExecutionToken token;
+    token.AcquireForWorker();
+    std::atomic<int> result{-1};
+    std::thread caller([&] {
+        bool acquired = token.AcquireForCaller();
+        result = acquired ? 1 : 0;
+        if (acquired) {
+            token.Release();
+        }
+    });
+    while (!token.HasWaiter()) {
+        std::this_thread::yield();
+    }
+    token.BeginWaitMainThread();  // 工作线程同步等待主线程，主线程的同步请求应立即退化
+    caller.join();
+    EXPECT_EQ(result.load(), 0);
+    token.EndWaitMainThread();
+    token.Release();
+    EXPECT_TRUE(token.AcquireForCaller());
+    token.Release();
+}
@@ -0,0 +1,93 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/utils/KRFixedBlockPool.h"
+
+namespace {
+
+struct PooledValue {
+    explicit PooledValue(std::string v) : value(std::move(v)) {}
+    std::string value;
+    double padding = 0;
+};
+
+// 每个用例使用独立的块大小，避免与其他用例共享同一个进程级池
+using SmallPool = KRFixedBlockPool<64, 4>;
+
+}  // namespace
+
+TEST(KRFixedBlockPoolTest, ReusesFreedBlocks) {
+    auto &pool = KRFixedBlockPool<48>::GetInstance();
+    void *first = pool.Allocate();
+    pool.Deallocate(first);
+    EXPECT_EQ(pool.FreeCount(), 1u);
+    void *second = pool.Allocate();
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool.FreeCount(), 0u);
+    pool.Deallocate(second);
+}
+
+TEST(KRFixedBlockPoolTest, ReleasesBlocksBeyondLimit) {
+    auto &pool = SmallPool::GetInstance();
+    std::vector<void *> blocks;
+    for (int i = 0; i < 8; i++) {
+        blocks.push_back(pool.Allocate());
+    }
+    for (auto block : blocks) {
+        pool.Deallocate(block);
+    }
+    EXPECT_EQ(pool.FreeCount(), 4u);
+}
+
+TEST(KRFixedBlockPoolTest, AllocateSharedRecyclesControlBlock) {
+    KRPoolAllocator<PooledValue> allocator;
+    const void *address = nullptr;
+    {
+        auto value = std::allocate_shared<PooledValue>(allocator, "first");
+        address = value.get();
+    }
+    auto value = std::allocate_shared<PooledValue>(allocator, "second");
+    EXPECT_EQ(value.get(), address);
+    EXPECT_EQ(value->value, "second");
+}
+
+TEST(KRFixedBlockPoolTest, FreesOnAnotherThread) {
+    KRPoolAllocator<PooledValue> allocator;
+    constexpr int kCount = 10000;
+    std::vector<std::shared_ptr<PooledValue>> values;
+    values.reserve(kCount);
+    std::thread producer([&values, &allocator] {
+        for (int i = 0; i < kCount; i++) {
+            values.push_back(std::allocate_shared<PooledValue>(allocator, std::to_string(i)));
+        }
+    });
+    producer.join();
+    std::thread consumer([&values] {
+        for (int i = 0; i < kCount; i++) {
+            ASSERT_EQ(values[i]->value, std::to_string(i));
+        }
+        values.clear();
+    });
+    consumer.join();
+    auto again = std::allocate_shared<PooledValue>(allocator, "again");
+    EXPECT_EQ(again->value, "again");
+}
@@ -0,0 +1,163 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+
+namespace {
+
+/**
+ * 手动驱动的帧信号源，只记录请求次数，由用例调用 OnFrame 模拟 Vsync 到达
+ */
+class FakeFrameSource : public IKRFrameSource {
+ public:
+    void RequestFrame() override {
+        request_count++;
+    }
+
+    std::atomic<int> request_count{0};
+};
+
+class KRFrameClockTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        clock_.OnFrame(0);  // 清空其他用例遗留的回调
+        source_ = std::make_shared<FakeFrameSource>();
+        clock_.SetFrameSource(source_);
+    }
+
+    void TearDown() override {
+        clock_.OnFrame(0);
+    }
+
+    KRFrameClock &clock_ = KRFrameClock::GetInstance();
+    std::shared_ptr<FakeFrameSource> source_;
+};
+
+}  // namespace
+
+TEST_F(KRFrameClockTest, CallbacksInOneFrameShareOneRequest) {
+    std::vector<int> order;
+    std::vector<int64_t> frame_times;
+    for (int i = 0; i < 3; i++) {
+        clock_.PostFrameCallback([i, &order, &frame_times](int64_t frame_time) {
+            order.push_back(i);
+            frame_times.push_back(frame_time);
+        });
+    }
+    EXPECT_EQ(source_->request_count.load(), 1);
+
+    clock_.OnFrame(16000000);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(frame_times, (std::vector<int64_t>{16000000, 16000000, 16000000}));
+
+    clock_.OnFrame(32000000);  // 回调为一次性
+    EXPECT_EQ(order.size(), 3u);
+    EXPECT_EQ(source_->request_count.load(), 1);
+}
+
+TEST_F(KRFrameClockTest, ReRegisteringCallbackFiresOncePerFrame) {
+    // 与 KRVsyncModule 相同的用法：每帧回调内注册下一帧
+    int fired = 0;
+    bool registered = true;
+    std::function<void(int64_t)> on_frame;
+    on_frame = [&](int64_t) {
+        if (!registered) {
+            return;
+        }
+        fired++;
+        clock_.PostFrameCallback(on_frame);
+    };
+    clock_.PostFrameCallback(on_frame);
+    for (int frame = 1; frame <= 5; frame++) {
+        clock_.OnFrame(frame * 16000000LL);
+        EXPECT_EQ(fired, frame);
+        EXPECT_EQ(source_->request_count.load(), frame + 1);
+    }
+    registered = false;
+    clock_.OnFrame(6 * 16000000LL);  // 在局部变量析构前执行最后一次回调
+    EXPECT_EQ(fired, 5);
+}
+
+TEST_F(KRFrameClockTest, RemovedCallbackDoesNotFire) {
+    bool kept = false;
+    bool removed = false;
+    clock_.PostFrameCallback([&kept](int64_t) { kept = true; });
+    auto id = clock_.PostFrameCallback([&removed](int64_t) { removed = true; });
+    clock_.RemoveFrameCallback(id);
+    clock_.OnFrame(16000000);
+    EXPECT_TRUE(kept);
+    EXPECT_FALSE(removed);
+}
+
+TEST_F(KRFrameClockTest, IdleClockRequestsNoFrames) {
+    clock_.OnFrame(16000000);
+    EXPECT_EQ(source_->request_count.load(), 0);
+
+    clock_.PostFrameCallback([](int64_t) {});
+    clock_.OnFrame(32000000);
+    clock_.OnFrame(48000000);
+    EXPECT_EQ(source_->request_count.load(), 1);
+}
+
+TEST_F(KRFrameClockTest, SwitchingSourceRequestsPendingFrame) {
+    bool fired = false;
+    clock_.PostFrameCallback([&fired](int64_t) { fired = true; });
+    auto next_source = std::make_shared<FakeFrameSource>();
+    clock_.SetFrameSource(next_source);
+    EXPECT_EQ(next_source->request_count.load(), 1);
+
+    clock_.OnFrame(16000000);
+    EXPECT_TRUE(fired);
+    source_ = next_source;
+}
+
+TEST_F(KRFrameClockTest, FlushRequestsFromManyThreadsCoalesceIntoOneFrame) {
+    // 与 KRUIScheduler 相同的用法：已请求帧时新的刷新请求只并入待执行任务
+    std::atomic<bool> flush_requested{false};
+    std::atomic<int> flush_count{0};
+    auto request_flush = [&] {
+        if (flush_requested.exchange(true)) {
+            return;
+        }
+        clock_.PostFrameCallback([&](int64_t) {
+            flush_requested.store(false);
+            flush_count++;
+        });
+    };
+    for (int frame = 1; frame <= 3; frame++) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < 100; i++) {
+                    request_flush();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        clock_.OnFrame(frame * 16000000LL);
+        EXPECT_EQ(flush_count.load(), frame);
+        EXPECT_EQ(source_->request_count.load(), frame);
+    }
+}
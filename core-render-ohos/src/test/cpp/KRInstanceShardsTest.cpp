@@ -0,0 +1,91 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRThread.h"
+#include "libohos_render/scheduler/KRInstanceShards.h"
+
+TEST(KRInstanceShardsTest, AssignsToLeastLoadedShard) {
+    KRInstanceShards shards(3);
+    EXPECT_EQ(shards.Assign("a"), 0u);
+    EXPECT_EQ(shards.Assign("b"), 1u);
+    EXPECT_EQ(shards.Assign("c"), 2u);
+    EXPECT_EQ(shards.Assign("d"), 0u);
+    EXPECT_EQ(shards.Assign("b"), 1u);  // 重复分配返回原分片
+    EXPECT_EQ(shards.InstanceCount(0), 2u);
+    EXPECT_EQ(shards.InstanceCount(1), 1u);
+
+    shards.Release("b");
+    EXPECT_EQ(shards.InstanceCount(1), 0u);
+    EXPECT_EQ(shards.Assign("e"), 1u);
+}
+
+TEST(KRInstanceShardsTest, UnknownOrReleasedInstanceHasNoShard) {
+    KRInstanceShards shards(2);
+    EXPECT_EQ(shards.Find("a"), KRInstanceShards::kNoShard);
+    size_t shard = shards.Assign("a");
+    EXPECT_EQ(shards.Find("a"), shard);
+    shards.Release("a");
+    EXPECT_EQ(shards.Find("a"), KRInstanceShards::kNoShard);
+    shards.Release("a");  // 重复释放无副作用
+    EXPECT_EQ(shards.InstanceCount(shard), 0u);
+}
+
+TEST(KRInstanceShardsTest, CachedShardInvalidatedOnRelease) {
+    KRInstanceShards shards(2);
+    shards.Assign("a");
+    auto shard = shards.Acquire("b");
+    EXPECT_EQ(shard->Index(), 1u);
+    EXPECT_EQ(shards.Acquire("b"), shard);  // 重复分配返回同一对象
+    shards.Release("b");
+    EXPECT_EQ(shard->Index(), KRInstanceShards::kNoShard);
+    EXPECT_EQ(shards.InstanceCount(1), 0u);
+}
+
+TEST(KRInstanceShardsTest, TwoPagesProgressConcurrently) {
+    KRInstanceShards shards(2);
+    std::vector<std::unique_ptr<KRThread>> threads;
+    threads.emplace_back(new KRThread("shard0"));
+    threads.emplace_back(new KRThread("shard1"));
+    size_t shard_a = shards.Assign("pageA");
+    size_t shard_b = shards.Assign("pageB");
+    ASSERT_NE(shard_a, shard_b);
+
+    // 页面 A 的任务阻塞其 Context 线程，页面 B 的任务仍应在自己的线程上完成
+    std::promise<void> release_a;
+    std::shared_future<void> release_a_future = release_a.get_future().share();
+    std::promise<void> a_done;
+    std::promise<void> b_done;
+    threads[shards.Find("pageA")]->DispatchAsync([release_a_future, &a_done] {
+        release_a_future.wait();
+        a_done.set_value();
+    });
+    threads[shards.Find("pageB")]->DispatchAsync([&b_done] { b_done.set_value(); });
+
+    auto b_future = b_done.get_future();
+    EXPECT_EQ(b_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    auto a_future = a_done.get_future();
+    EXPECT_EQ(a_future.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    release_a.set_value();
+    EXPECT_EQ(a_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
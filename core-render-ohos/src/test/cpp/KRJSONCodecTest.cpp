@@ -0,0 +1,256 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "libohos_render/utils/KRJSONCodec.h"
+#include "libohos_render/utils/KRJSONObject.h"
+#include "thirdparty/cJSON/cJSON.h"
+
+using kuikly::util::JSONObject;
+using kuikly::util::JSONReader;
+using kuikly::util::JSONWriter;
+
+namespace {
+size_t ScalarFindQuoteOrEscape(const std::string &str, size_t begin) {
+    for (size_t i = begin; i < str.size(); ++i) {
+        if (str[i] == '"' || str[i] == '\\') {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+size_t ScalarFindNeedEscape(const std::string &str, size_t begin) {
+    for (size_t i = begin; i < str.size(); ++i) {
+        auto c = static_cast<uint8_t>(str[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            return i;
+        }
+    }
+    return str.size();
+}
+
+std::string RandomString(std::mt19937 &rng, size_t max_length) {
+    static const char kAlphabet[] = {'a', 'Z', '0', ' ', '"', '\\', '\n', '\t', '\x01', '\x1f', '\x20', '\x7f',
+                                     '\x80', '\xe4', '\xb8', '\xad', '\xff', '/'};
+    std::string str(rng() % (max_length + 1), 'x');
+    for (auto &c : str) {
+        // 大部分为普通字符，保证能走到整块跳过的分支
+        c = rng() % 4 == 0 ? kAlphabet[rng() % sizeof(kAlphabet)] : static_cast<char>('a' + rng() % 26);
+    }
+    return str;
+}
+
+double RandomNumber(std::mt19937 &rng) {
+    static const double kSpecial[] = {0.0,
+                                      -0.0,
+                                      1.0,
+                                      -1.0,
+                                      0.1,
+                                      1.0 / 3,
+                                      123456.789,
+                                      1e20,
+                                      1e-7,
+                                      2147483647.0,
+                                      -2147483648.0,
+                                      2147483648.0,
+                                      -2147483649.0,
+                                      4503599627370497.0,
+                                      std::numeric_limits<double>::quiet_NaN(),
+                                      std::numeric_limits<double>::infinity(),
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::denorm_min()};
+    switch (rng() % 3) {
+        case 0:
+            return kSpecial[rng() % (sizeof(kSpecial) / sizeof(kSpecial[0]))];
+        case 1:
+            return static_cast<int32_t>(rng());
+        default:
+            return std::uniform_real_distribution<double>(-1e6, 1e6)(rng);
+    }
+}
+
+/** 同时生成cJSON树和JSONWriter的输出，二者的成员顺序一致 */
+cJSON *BuildRandom(std::mt19937 &rng, JSONWriter &writer, int depth) {
+    switch (depth > 0 ? rng() % 7 : rng() % 5) {
+        case 0:
+            writer.Null();
+            return cJSON_CreateNull();
+        case 1: {
+            bool value = rng() % 2;
+            writer.Bool(value);
+            return cJSON_CreateBool(value);
+        }
+        case 2: {
+            int32_t value = static_cast<int32_t>(rng());
+            writer.Int(value);
+            return cJSON_CreateNumber(value);
+        }
+        case 3: {
+            double value = RandomNumber(rng);
+            writer.Double(value);
+            return cJSON_CreateNumber(value);
+        }
+        case 4: {
+            auto value = RandomString(rng, 40);
+            writer.String(value);
+            return cJSON_CreateString(value.c_str());
+        }
+        case 5: {
+            cJSON *object = cJSON_CreateObject();
+            writer.BeginObject();
+            for (size_t i = rng() % 5; i > 0; --i) {
+                auto key = RandomString(rng, 12);
+                writer.Key(key);
+                cJSON_AddItemToObject(object, key.c_str(), BuildRandom(rng, writer, depth - 1));
+            }
+            writer.EndObject();
+            return object;
+        }
+        default: {
+            cJSON *array = cJSON_CreateArray();
+            writer.BeginArray();
+            for (size_t i = rng() % 5; i > 0; --i) {
+                cJSON_AddItemToArray(array, BuildRandom(rng, writer, depth - 1));
+            }
+            writer.EndArray();
+            return array;
+        }
+    }
+}
+
+std::string PrintWithCJSON(cJSON *json, bool formatted) {
+    char *printed = formatted ? cJSON_Print(json) : cJSON_PrintUnformatted(json);
+    std::string result(printed);
+    cJSON_free(printed);
+    return result;
+}
+}  // namespace
+
+TEST(KRJSONCodecTest, BlockScannersMatchScalar) {
+    std::mt19937 rng(20250301);
+    for (int round = 0; round < 2000; ++round) {
+        auto str = RandomString(rng, 80);
+        for (size_t begin = 0; begin <= str.size(); ++begin) {
+            ASSERT_EQ(kuikly::util::json_internal::FindQuoteOrEscape(str, begin), ScalarFindQuoteOrEscape(str, begin));
+            ASSERT_EQ(kuikly::util::json_internal::FindNeedEscape(str, begin), ScalarFindNeedEscape(str, begin));
+        }
+    }
+    // 目标字符位于每个块内的每个位置
+    for (size_t hit = 0; hit < 40; ++hit) {
+        for (char c : {'"', '\\', '\x00', '\x1f'}) {
+            std::string str(48, 'a');
+            str[hit] = c;
+            EXPECT_EQ(kuikly::util::json_internal::FindNeedEscape(str, 0), hit);
+            if (c == '"' || c == '\\') {
+                EXPECT_EQ(kuikly::util::json_internal::FindQuoteOrEscape(str, 0), hit);
+            }
+        }
+    }
+}
+
+TEST(KRJSONCodecTest, PrettyOutputMatchesCJSONPrint) {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 3000; ++round) {
+        std::string out;
+        JSONWriter writer(out, JSONWriter::Format::kPretty);
+        cJSON *json = BuildRandom(rng, writer, 4);
+        ASSERT_EQ(out, PrintWithCJSON(json, true));
+        cJSON_Delete(json);
+    }
+}
+
+TEST(KRJSONCodecTest, PrettyLayout) {
+    std::string out;
+    JSONWriter writer(out, JSONWriter::Format::kPretty);
+    writer.BeginObject();
+    writer.Key("a");
+    writer.Int(1);
+    writer.Key("b");
+    writer.BeginArray();
+    writer.Double(0.5);
+    writer.BeginObject();
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+    EXPECT_EQ(out, "{\n\t\"a\":\t1,\n\t\"b\":\t[0.5, {\n\t\t}]\n}");
+}
+
+TEST(KRJSONCodecTest, CompactOutputRoundTrips) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 1000; ++round) {
+        std::string out;
+        JSONWriter writer(out);
+        cJSON *json = BuildRandom(rng, writer, 4);
+        // 紧凑模式的数字为最短往返表示，与cJSON的文本可能不同，比较解析后的结构
+        cJSON *parsed = cJSON_Parse(out.c_str());
+        ASSERT_NE(parsed, nullptr) << out;
+        ASSERT_EQ(PrintWithCJSON(parsed, false), PrintWithCJSON(json, false));
+        cJSON_Delete(parsed);
+        cJSON_Delete(json);
+
+        JSONReader reader(out);
+        std::string_view raw;
+        ASSERT_TRUE(reader.RawValue(raw));
+        EXPECT_EQ(raw, out);
+    }
+}
+
+TEST(KRJSONCodecTest, ReaderUnescapesStrings) {
+    JSONReader reader(R"("a\"b\\c\/\n中😀")");
+    std::string value;
+    ASSERT_TRUE(reader.ReadString(value));
+    EXPECT_EQ(value, "a\"b\\c/\n\xe4\xb8\xad\xf0\x9f\x98\x80");
+}
+
+TEST(KRJSONObjectTest, FindsFirstMemberIgnoringCase) {
+    auto json = JSONObject::Parse(R"({"Width": 10, "width": 20, "name": "kuikly", "esc": "escaped"})");
+    ASSERT_NE(json, nullptr);
+    EXPECT_EQ(json->GetNumber("width"), 10);
+    EXPECT_EQ(json->GetNumber("WIDTH"), 10);
+    EXPECT_EQ(json->GetString("name"), "kuikly");
+    EXPECT_EQ(json->GetString("esc"), "escaped");
+    EXPECT_EQ(json->GetString("missing", "default"), "default");
+    EXPECT_EQ(json->GetNumber("missing", 3), 3);
+    EXPECT_TRUE(std::isnan(json->GetNumber("name")));
+    EXPECT_EQ(json->GetArraySize(), 4);
+    ASSERT_NE(json->GetArrayItem(2), nullptr);
+}
+
+TEST(KRJSONObjectTest, ArraysAndNestedObjects) {
+    auto json = JSONObject::Parse(R"({"list": [{"id": 1}, {"id": 2}, {"id": 3}], "nums": [1, 2.5], "strs": ["a", "b"]})");
+    ASSERT_NE(json, nullptr);
+    auto list = json->GetObjectItem("list");
+    ASSERT_NE(list, nullptr);
+    EXPECT_EQ(list->GetArraySize(), 3);
+    for (int i = 0; i < 3; ++i) {
+        auto item = list->GetArrayItem(i);
+        ASSERT_NE(item, nullptr);
+        EXPECT_EQ(item->GetNumber("id"), i + 1);
+    }
+    EXPECT_EQ(list->GetArrayItem(3), nullptr);
+    EXPECT_EQ(list->GetArrayItem(-1), nullptr);
+    // 数组元素没有key，不能按key命中
+    EXPECT_EQ(list->GetObjectItem(""), nullptr);
+    EXPECT_EQ(json->GetNumberArray("nums"), (std::vector<double>{1, 2.5}));
+    EXPECT_EQ(json->GetStringArray("strs"), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(JSONObject::Parse("{\"a\": "), nullptr);
+}
@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/utils/KRLoadOnceRegistry.h"
+
+namespace {
+
+auto kCanLoad = [] { return true; };
+
+size_t LoadedCount(KRLoadOnceRegistry &registry) {
+    size_t count = 0;
+    registry.ForEachLoaded([&count](const std::string &, const KRLoadOnceRegistry::Record &) { count++; });
+    return count;
+}
+
+}  // namespace
+
+TEST(KRLoadOnceRegistryTest, LoadsEachKeyOnce) {
+    KRLoadOnceRegistry registry;
+    int loads = 0;
+    auto load = [&loads] {
+        loads++;
+        return true;
+    };
+    EXPECT_TRUE(registry.LoadOnce("a", true, kCanLoad, load));
+    EXPECT_TRUE(registry.LoadOnce("a", false, kCanLoad, load));
+    EXPECT_EQ(loads, 1);
+
+    bool preload = false;
+    registry.ForEachLoaded([&preload](const std::string &key, const KRLoadOnceRegistry::Record &record) {
+        EXPECT_EQ(key, "a");
+        preload = record.preload;
+    });
+    EXPECT_TRUE(preload);  // 记录首次加载的来源
+}
+
+TEST(KRLoadOnceRegistryTest, UnloadableKeyIsNotRecorded) {
+    KRLoadOnceRegistry registry;
+    bool loaded = false;
+    EXPECT_FALSE(registry.LoadOnce("a", false, [] { return false; }, [&loaded] { return loaded = true; }));
+    EXPECT_FALSE(loaded);
+    EXPECT_EQ(registry.FailedCount(), 0u);
+    EXPECT_EQ(LoadedCount(registry), 0u);
+}
+
+TEST(KRLoadOnceRegistryTest, FailedLoadIsRetried) {
+    KRLoadOnceRegistry registry;
+    int loads = 0;
+    auto load = [&loads] { return ++loads > 1; };  // 首次失败
+    EXPECT_FALSE(registry.LoadOnce("a", false, kCanLoad, load));
+    EXPECT_EQ(registry.FailedCount(), 1u);
+    EXPECT_EQ(LoadedCount(registry), 0u);
+
+    EXPECT_TRUE(registry.LoadOnce("a", false, kCanLoad, load));
+    EXPECT_TRUE(registry.LoadOnce("a", false, kCanLoad, load));
+    EXPECT_EQ(loads, 2);
+    EXPECT_EQ(LoadedCount(registry), 1u);
+}
+
+TEST(KRLoadOnceRegistryTest, ConcurrentLoadsOfSameKeyWait) {
+    KRLoadOnceRegistry registry;
+    std::atomic<int> loads{0};
+    std::atomic<bool> loading_done{false};
+    std::atomic<int> returned_before_done{0};
+    auto load = [&] {
+        loads++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        loading_done = true;
+        return true;
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.emplace_back([&] {
+            EXPECT_TRUE(registry.LoadOnce("font", false, kCanLoad, load));
+            if (!loading_done.load()) {
+                returned_before_done++;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(loads.load(), 1);
+    EXPECT_EQ(returned_before_done.load(), 0);  // 等待者在加载完成后才返回
+}
+
+TEST(KRLoadOnceRegistryTest, WaiterRetriesAfterConcurrentFailure) {
+    KRLoadOnceRegistry registry;
+    std::promise<void> first_started;
+    std::promise<void> release_first;
+    std::shared_future<void> release = release_first.get_future().share();
+    std::atomic<int> loads{0};
+    auto load = [&] {
+        if (loads++ == 0) {
+            first_started.set_value();
+            release.wait();
+            return false;
+        }
+        return true;
+    };
+    std::thread first([&] { EXPECT_FALSE(registry.LoadOnce("font", false, kCanLoad, load)); });
+    first_started.get_future().wait();
+    std::thread waiter([&] { EXPECT_TRUE(registry.LoadOnce("font", false, kCanLoad, load)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));  // 让等待者进入等待
+    release_first.set_value();
+    first.join();
+    waiter.join();
+    EXPECT_EQ(loads.load(), 2);
+    EXPECT_EQ(registry.FailedCount(), 1u);
+    EXPECT_EQ(LoadedCount(registry), 1u);
+}
+
+TEST(KRLoadOnceRegistryTest, DifferentKeysLoadInParallel) {
+    // a 的加载等待 b 加载完成，若不同 key 互相阻塞则会死锁
+    KRLoadOnceRegistry registry;
+    std::promise<void> b_loaded;
+    auto b_future = b_loaded.get_future();
+    std::thread a([&] {
+        EXPECT_TRUE(registry.LoadOnce("a", false, kCanLoad, [&b_future] {
+            return b_future.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+        }));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(registry.LoadOnce("b", false, kCanLoad, [&b_loaded] {
+        b_loaded.set_value();
+        return true;
+    }));
+    a.join();
+    EXPECT_EQ(LoadedCount(registry), 2u);
+}
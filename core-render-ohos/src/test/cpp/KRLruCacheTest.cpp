@@ -0,0 +1,204 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/utils/KRLruCache.h"
+
+namespace {
+
+using StringCache = KRLruCache<std::string, std::shared_ptr<int>>;
+
+std::shared_ptr<int> MakeValue(int v) {
+    return std::make_shared<int>(v);
+}
+
+}  // namespace
+
+TEST(KRLruCacheTest, GetPromotesEntryAndTrimEvictsLeastRecent) {
+    StringCache cache(30);
+    std::vector<std::shared_ptr<int>> evicted;
+    EXPECT_TRUE(cache.Put("a", MakeValue(1), 10, evicted));
+    EXPECT_TRUE(cache.Put("b", MakeValue(2), 10, evicted));
+    EXPECT_TRUE(cache.Put("c", MakeValue(3), 10, evicted));
+    EXPECT_TRUE(evicted.empty());
+
+    ASSERT_NE(cache.Get("a"), nullptr);  // a 变为最近使用，b 最久未用
+    EXPECT_TRUE(cache.Put("d", MakeValue(4), 10, evicted));
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(*evicted[0], 2);
+    EXPECT_EQ(cache.Get("b"), nullptr);
+    EXPECT_EQ(cache.Size(), 3u);
+    EXPECT_EQ(cache.TotalBytes(), 30u);
+    EXPECT_EQ(cache.EvictionCount(), 1u);
+}
+
+TEST(KRLruCacheTest, ReplaceReturnsOldValueWithoutCountingEviction) {
+    StringCache cache(100);
+    std::vector<std::shared_ptr<int>> evicted;
+    cache.Put("a", MakeValue(1), 40, evicted);
+    cache.Put("a", MakeValue(2), 10, evicted);
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(*evicted[0], 1);
+    EXPECT_EQ(**cache.Get("a"), 2);
+    EXPECT_EQ(cache.TotalBytes(), 10u);
+    EXPECT_EQ(cache.EvictionCount(), 0u);
+}
+
+TEST(KRLruCacheTest, OversizedEntryIsNotCachedAndDropsOldValue) {
+    StringCache cache(100);
+    std::vector<std::shared_ptr<int>> evicted;
+    cache.Put("a", MakeValue(1), 10, evicted);
+    cache.Put("b", MakeValue(2), 10, evicted);
+    EXPECT_FALSE(cache.Put("a", MakeValue(3), 101, evicted));
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(*evicted[0], 1);
+    EXPECT_EQ(cache.Get("a"), nullptr);
+    EXPECT_NE(cache.Get("b"), nullptr);
+    EXPECT_EQ(cache.TotalBytes(), 10u);
+}
+
+TEST(KRLruCacheTest, TrimKeepsLimitAndSetMaxBytesShrinksIt) {
+    StringCache cache(100);
+    std::vector<std::shared_ptr<int>> evicted;
+    for (int i = 0; i < 10; i++) {
+        cache.Put(std::to_string(i), MakeValue(i), 10, evicted);
+    }
+    cache.TrimToSize(50, evicted);
+    EXPECT_EQ(cache.MaxBytes(), 100u);
+    EXPECT_EQ(cache.TotalBytes(), 50u);
+    ASSERT_EQ(evicted.size(), 5u);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(*evicted[i], i);  // 按最久未用的顺序淘汰
+    }
+
+    evicted.clear();
+    cache.SetMaxBytes(0, evicted);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.TotalBytes(), 0u);
+    EXPECT_EQ(evicted.size(), 5u);
+    EXPECT_EQ(cache.EvictionCount(), 10u);
+}
+
+TEST(KRLruCacheTest, RemoveReleasesEntry) {
+    StringCache cache(100);
+    std::vector<std::shared_ptr<int>> evicted;
+    cache.Put("a", MakeValue(1), 30, evicted);
+    EXPECT_FALSE(cache.Remove("b", evicted));
+    EXPECT_TRUE(cache.Remove("a", evicted));
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(cache.Get("a"), nullptr);
+    EXPECT_EQ(cache.TotalBytes(), 0u);
+    EXPECT_EQ(cache.EvictionCount(), 0u);
+}
+
+TEST(KRLruCacheTest, MatchesReferenceModelOnRandomOperations) {
+    struct RefEntry {
+        int key;
+        int value;
+        size_t cost;
+    };
+    const size_t kMaxBytes = 200;
+    KRLruCache<int, int> cache(kMaxBytes);
+    std::list<RefEntry> ref;  // 头部为最近使用
+    std::mt19937 rng(9);
+    for (int step = 0; step < 20000; step++) {
+        int key = static_cast<int>(rng() % 32);
+        std::vector<int> evicted;
+        auto found = ref.end();
+        for (auto it = ref.begin(); it != ref.end(); ++it) {
+            if (it->key == key) {
+                found = it;
+                break;
+            }
+        }
+        switch (rng() % 3) {
+        case 0: {
+            int *value = cache.Get(key);
+            if (found == ref.end()) {
+                EXPECT_EQ(value, nullptr);
+            } else {
+                ASSERT_NE(value, nullptr);
+                EXPECT_EQ(*value, found->value);
+                ref.splice(ref.begin(), ref, found);
+            }
+            break;
+        }
+        case 1: {
+            size_t cost = rng() % 60;
+            if (found != ref.end()) {
+                ref.erase(found);
+            }
+            cache.Put(key, step, cost, evicted);
+            if (cost <= kMaxBytes) {
+                ref.push_front(RefEntry{key, step, cost});
+            }
+            size_t total = 0;
+            for (auto &entry : ref) {
+                total += entry.cost;
+            }
+            while (total > kMaxBytes) {
+                total -= ref.back().cost;
+                ref.pop_back();
+            }
+            break;
+        }
+        default:
+            EXPECT_EQ(cache.Remove(key, evicted), found != ref.end());
+            if (found != ref.end()) {
+                ref.erase(found);
+            }
+            break;
+        }
+        size_t total = 0;
+        for (auto &entry : ref) {
+            total += entry.cost;
+        }
+        ASSERT_EQ(cache.Size(), ref.size());
+        ASSERT_EQ(cache.TotalBytes(), total);
+    }
+}
+
+TEST(KRLruCacheTest, EvictedValuesAreReleasedByCallerNotCache) {
+    // 图片缓存按 ByteCount 计容量，淘汰的 pixelmap 由 evicted 带出锁外释放，请求方持有的引用不受影响
+    StringCache cache(100);
+    std::vector<std::shared_ptr<int>> evicted;
+    auto held = MakeValue(1);
+    std::weak_ptr<int> dropped;
+    {
+        auto value = MakeValue(2);
+        dropped = value;
+        cache.Put("held", held, 60, evicted);
+        cache.Put("dropped", std::move(value), 40, evicted);
+    }
+    cache.Get("held");
+    cache.Put("new", MakeValue(3), 40, evicted);
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_FALSE(dropped.expired());  // 仍由 evicted 持有，直到调用方释放
+    evicted.clear();
+    EXPECT_TRUE(dropped.expired());
+
+    cache.SetMaxBytes(0, evicted);
+    EXPECT_EQ(held.use_count(), 1 + 1);
+    evicted.clear();
+    EXPECT_EQ(held.use_count(), 1);
+    EXPECT_EQ(*held, 1);
+}
@@ -0,0 +1,49 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+#include "libohos_render/foundation/KRPropKey.h"
+
+TEST(KRPropKeyTest, BuiltinKeysRoundTrip) {
+    std::unordered_set<uint32_t> ids;
+#define KR_PROP_KEY_CHECK(id, name)                                 \
+    EXPECT_EQ(KRPropKeyFromString(name), KRPropKey::id) << name;    \
+    EXPECT_TRUE(ids.insert(static_cast<uint32_t>(KRPropKey::id)).second) << name;
+    KR_BUILTIN_PROP_KEYS(KR_PROP_KEY_CHECK)
+#undef KR_PROP_KEY_CHECK
+    EXPECT_EQ(ids.count(static_cast<uint32_t>(KRPropKey::kUnknown)), 0u);
+    EXPECT_EQ(ids.count(static_cast<uint32_t>(KRPropKey::kUnresolved)), 0u);
+}
+
+TEST(KRPropKeyTest, UnknownKeys) {
+    EXPECT_EQ(KRPropKeyFromString(""), KRPropKey::kUnknown);
+    EXPECT_EQ(KRPropKeyFromString("customProp"), KRPropKey::kUnknown);
+    // 大小写与前缀不同都不应命中内置属性
+    EXPECT_EQ(KRPropKeyFromString("Frame"), KRPropKey::kUnknown);
+    EXPECT_EQ(KRPropKeyFromString("fram"), KRPropKey::kUnknown);
+    EXPECT_EQ(KRPropKeyFromString(std::string("frame\0", 6)), KRPropKey::kUnknown);
+}
+
+TEST(KRPropKeyTest, ResolveKeepsBridgeId) {
+    EXPECT_EQ(KRResolvePropKey(KRPropKey::kUnresolved, "frame"), KRPropKey::kFrame);
+    EXPECT_EQ(KRResolvePropKey(KRPropKey::kUnresolved, "customProp"), KRPropKey::kUnknown);
+    // 已解析的ID直接使用，不再比较属性名
+    EXPECT_EQ(KRResolvePropKey(KRPropKey::kSrc, "frame"), KRPropKey::kSrc);
+    EXPECT_EQ(KRResolvePropKey(KRPropKey::kUnknown, "frame"), KRPropKey::kUnknown);
+}
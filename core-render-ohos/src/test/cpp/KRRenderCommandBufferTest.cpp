@@ -0,0 +1,126 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "KRRenderCommandTestWriter.h"
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+
+TEST(KRRenderCommandBufferTest, DecodesCommandsInOrder) {
+    KRRenderCommandTestWriter writer;
+    writer.CreateRenderView(7, "KRView");
+    writer.DefinePropKey(0, "backgroundColor");
+    writer.SetViewProp(7, 0, std::string_view("rgba(0,0,0,1)"));
+    writer.SetViewProp(7, 0, 42);
+    writer.SetRenderViewFrame(7, 1.5f, 2.5f, 100.f, 50.f);
+    writer.InsertSubRenderView(1, 7, -1);
+    writer.RemoveRenderView(7);
+
+    KRRenderCommandReader reader(writer.Bytes().data(), writer.Bytes().size());
+    KRRenderCommandOpcode opcode;
+    KRRenderCommandReader payload;
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kCreateRenderView);
+    EXPECT_EQ(payload.ReadInt32(), 7);
+    EXPECT_EQ(payload.ReadString(), "KRView");
+    EXPECT_TRUE(payload.AtEnd());
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kDefinePropKey);
+    EXPECT_EQ(payload.ReadUInt16(), 0);
+    EXPECT_EQ(payload.ReadString(), "backgroundColor");
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kSetViewProp);
+    EXPECT_EQ(payload.ReadInt32(), 7);
+    EXPECT_EQ(payload.ReadUInt16(), 0);
+    EXPECT_EQ(payload.ReadUInt8(), KRRenderCValue::Type::STRING);
+    EXPECT_EQ(payload.ReadString(), "rgba(0,0,0,1)");
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(payload.ReadInt32(), 7);
+    EXPECT_EQ(payload.ReadUInt16(), 0);
+    EXPECT_EQ(payload.ReadUInt8(), KRRenderCValue::Type::INT);
+    EXPECT_EQ(payload.ReadInt32(), 42);
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kSetRenderViewFrame);
+    EXPECT_EQ(payload.ReadInt32(), 7);
+    EXPECT_FLOAT_EQ(payload.ReadFloat(), 1.5f);
+    EXPECT_FLOAT_EQ(payload.ReadFloat(), 2.5f);
+    EXPECT_FLOAT_EQ(payload.ReadFloat(), 100.f);
+    EXPECT_FLOAT_EQ(payload.ReadFloat(), 50.f);
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kInsertSubRenderView);
+    EXPECT_EQ(payload.ReadInt32(), 1);
+    EXPECT_EQ(payload.ReadInt32(), 7);
+    EXPECT_EQ(payload.ReadInt32(), -1);
+
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kRemoveRenderView);
+    EXPECT_EQ(payload.ReadInt32(), 7);
+
+    EXPECT_FALSE(reader.NextCommand(opcode, payload));
+    EXPECT_TRUE(reader.IsValid());
+}
+
+TEST(KRRenderCommandBufferTest, SkipsUnknownOpcodes) {
+    KRRenderCommandTestWriter writer;
+    writer.Unknown(0x77, 13);
+    writer.RemoveRenderView(3);
+
+    KRRenderCommandReader reader(writer.Bytes().data(), writer.Bytes().size());
+    KRRenderCommandOpcode opcode;
+    KRRenderCommandReader payload;
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(static_cast<uint16_t>(opcode), 0x77);
+    EXPECT_EQ(payload.Length(), 13u);
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(opcode, KRRenderCommandOpcode::kRemoveRenderView);
+    EXPECT_EQ(payload.ReadInt32(), 3);
+}
+
+TEST(KRRenderCommandBufferTest, RejectsTruncatedBuffer) {
+    KRRenderCommandTestWriter writer;
+    writer.CreateRenderView(1, "KRView");
+    writer.RemoveRenderView(1);
+    auto bytes = writer.Bytes();
+    bytes.resize(bytes.size() - 2);
+
+    KRRenderCommandReader reader(bytes.data(), bytes.size());
+    KRRenderCommandOpcode opcode;
+    KRRenderCommandReader payload;
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_FALSE(reader.NextCommand(opcode, payload));
+    EXPECT_FALSE(reader.IsValid());
+}
+
+TEST(KRRenderCommandBufferTest, PayloadReadsStayInBounds) {
+    KRRenderCommandTestWriter writer;
+    writer.RemoveRenderView(9);
+
+    KRRenderCommandReader reader(writer.Bytes().data(), writer.Bytes().size());
+    KRRenderCommandOpcode opcode;
+    KRRenderCommandReader payload;
+    ASSERT_TRUE(reader.NextCommand(opcode, payload));
+    EXPECT_EQ(payload.ReadInt32(), 9);
+    // payload 只有 4 字节，越界读取返回零值并把游标标记为无效，不会读到下一条指令
+    EXPECT_EQ(payload.ReadInt64(), 0);
+    EXPECT_TRUE(payload.ReadString().empty());
+    EXPECT_FALSE(payload.IsValid());
+    EXPECT_TRUE(reader.IsValid());
+}
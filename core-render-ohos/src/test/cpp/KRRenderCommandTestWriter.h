@@ -0,0 +1,122 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERCOMMANDTESTWRITER_H
+#define CORE_RENDER_OHOS_KRRENDERCOMMANDTESTWRITER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+
+/**
+ * 测试用的指令编码器，与 Kotlin 侧 NativeCommandEncoder 的输出格式一致
+ */
+class KRRenderCommandTestWriter {
+ public:
+    void CreateRenderView(int32_t tag, std::string_view view_name) {
+        Begin(KRRenderCommandOpcode::kCreateRenderView, 4 + 4 + view_name.size());
+        Write(tag);
+        WriteString(view_name);
+    }
+
+    void RemoveRenderView(int32_t tag) {
+        Begin(KRRenderCommandOpcode::kRemoveRenderView, 4);
+        Write(tag);
+    }
+
+    void InsertSubRenderView(int32_t parent_tag, int32_t child_tag, int32_t index) {
+        Begin(KRRenderCommandOpcode::kInsertSubRenderView, 12);
+        Write(parent_tag);
+        Write(child_tag);
+        Write(index);
+    }
+
+    void SetRenderViewFrame(int32_t tag, float x, float y, float width, float height) {
+        Begin(KRRenderCommandOpcode::kSetRenderViewFrame, 20);
+        Write(tag);
+        Write(x);
+        Write(y);
+        Write(width);
+        Write(height);
+    }
+
+    void DefinePropKey(uint16_t prop_id, std::string_view prop_key) {
+        Begin(KRRenderCommandOpcode::kDefinePropKey, 2 + 4 + prop_key.size());
+        Write(prop_id);
+        WriteString(prop_key);
+    }
+
+    void SetViewProp(int32_t tag, uint16_t prop_id, int32_t value) {
+        Begin(KRRenderCommandOpcode::kSetViewProp, 4 + 2 + 1 + 4);
+        Write(tag);
+        Write(prop_id);
+        Write(static_cast<uint8_t>(KRRenderCValue::Type::INT));
+        Write(value);
+    }
+
+    void SetViewProp(int32_t tag, uint16_t prop_id, double value) {
+        Begin(KRRenderCommandOpcode::kSetViewProp, 4 + 2 + 1 + 8);
+        Write(tag);
+        Write(prop_id);
+        Write(static_cast<uint8_t>(KRRenderCValue::Type::DOUBLE));
+        Write(value);
+    }
+
+    void SetViewProp(int32_t tag, uint16_t prop_id, std::string_view value) {
+        Begin(KRRenderCommandOpcode::kSetViewProp, 4 + 2 + 1 + 4 + value.size());
+        Write(tag);
+        Write(prop_id);
+        Write(static_cast<uint8_t>(KRRenderCValue::Type::STRING));
+        WriteString(value);
+    }
+
+    /** 写入未定义的指令，用于验证解码端按 payload_length 跳过 */
+    void Unknown(uint16_t opcode, size_t payload_length) {
+        Begin(static_cast<KRRenderCommandOpcode>(opcode), payload_length);
+        bytes_.resize(bytes_.size() + payload_length, 0xAB);
+    }
+
+    const std::vector<uint8_t> &Bytes() const {
+        return bytes_;
+    }
+
+    void Clear() {
+        bytes_.clear();
+    }
+
+ private:
+    void Begin(KRRenderCommandOpcode opcode, size_t payload_length) {
+        Write(static_cast<uint16_t>(opcode));
+        Write(static_cast<uint16_t>(0));
+        Write(static_cast<uint32_t>(payload_length));
+    }
+
+    template <typename T> void Write(T value) {
+        auto offset = bytes_.size();
+        bytes_.resize(offset + sizeof(T));
+        memcpy(bytes_.data() + offset, &value, sizeof(T));  // 主机与设备均为小端序
+    }
+
+    void WriteString(std::string_view value) {
+        Write(static_cast<uint32_t>(value.size()));
+        bytes_.insert(bytes_.end(), value.begin(), value.end());
+    }
+
+    std::vector<uint8_t> bytes_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERCOMMANDTESTWRITER_H
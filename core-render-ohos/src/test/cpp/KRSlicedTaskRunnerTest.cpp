@@ -0,0 +1,131 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "libohos_render/scheduler/KRSlicedTaskRunner.h"
+
+namespace {
+
+std::vector<KRTask> MakeTasks(std::vector<int> &log, int first, int count) {
+    std::vector<KRTask> tasks;
+    for (int i = first; i < first + count; i++) {
+        tasks.emplace_back([&log, i] { log.push_back(i); });
+    }
+    return tasks;
+}
+
+/**
+ * 每个分片最多执行 n 个任务
+ */
+KRSlicedTaskRunner::ShouldYield YieldEvery(int n) {
+    auto count = std::make_shared<int>(0);
+    return [count, n] { return ++*count % n == 0; };
+}
+
+}  // namespace
+
+TEST(KRSlicedTaskRunnerTest, YieldsBetweenTasksAndKeepsOrder) {
+    KRSlicedTaskRunner runner;
+    std::vector<int> log;
+    auto tasks = MakeTasks(log, 0, 5);
+    runner.Append(tasks);
+    EXPECT_TRUE(tasks.empty());
+
+    EXPECT_EQ(runner.Run(YieldEvery(2)), 2u);
+    EXPECT_TRUE(runner.HasPending());
+    EXPECT_EQ(runner.Run(YieldEvery(2)), 2u);
+    EXPECT_EQ(runner.Run(YieldEvery(2)), 1u);
+    EXPECT_FALSE(runner.HasPending());
+    EXPECT_EQ(log, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(runner.SliceCount(), 3u);
+    EXPECT_EQ(runner.FlushTaskCount(), 5u);
+}
+
+TEST(KRSlicedTaskRunnerTest, LastTaskDoesNotAskToYield) {
+    KRSlicedTaskRunner runner;
+    std::vector<int> log;
+    auto tasks = MakeTasks(log, 0, 3);
+    runner.Append(tasks);
+    int asked = 0;
+    runner.Run([&asked] {
+        asked++;
+        return false;
+    });
+    EXPECT_EQ(asked, 2);
+    EXPECT_EQ(runner.SliceCount(), 1u);
+}
+
+TEST(KRSlicedTaskRunnerTest, LaterFlushRunsAfterRemainingTasks) {
+    KRSlicedTaskRunner runner;
+    std::vector<int> log;
+    auto first = MakeTasks(log, 0, 4);
+    runner.Append(first);
+    runner.Run(YieldEvery(1));
+    auto second = MakeTasks(log, 10, 2);
+    runner.Append(second);  // 上次刷新尚未执行完，追加在其后
+    runner.Run(nullptr);
+    EXPECT_EQ(log, (std::vector<int>{0, 1, 2, 3, 10, 11}));
+    EXPECT_EQ(runner.SliceCount(), 2u);
+    EXPECT_EQ(runner.FlushTaskCount(), 6u);
+
+    auto third = MakeTasks(log, 20, 1);
+    runner.Append(third);  // 新的刷新重新计数
+    EXPECT_EQ(runner.SliceCount(), 0u);
+    runner.Run(nullptr);
+    EXPECT_EQ(log.back(), 20);
+    EXPECT_EQ(runner.SliceCount(), 1u);
+}
+
+TEST(KRSlicedTaskRunnerTest, SyncRunDrainsEverything) {
+    KRSlicedTaskRunner runner;
+    std::vector<int> log;
+    auto tasks = MakeTasks(log, 0, 100);
+    runner.Append(tasks);
+    EXPECT_EQ(runner.Run(nullptr), 100u);
+    EXPECT_FALSE(runner.HasPending());
+    EXPECT_EQ(log.size(), 100u);
+}
+
+TEST(KRSlicedTaskRunnerTest, ReentrantSyncFlushPreservesOrder) {
+    // 任务执行中触发同步刷新：追加新任务并同步执行完，外层分片不再重复执行
+    KRSlicedTaskRunner runner;
+    std::vector<int> log;
+    std::vector<KRTask> tasks;
+    tasks.emplace_back([&log] { log.push_back(0); });
+    tasks.emplace_back([&log, &runner] {
+        log.push_back(1);
+        auto nested = MakeTasks(log, 10, 2);
+        runner.Append(nested);
+        runner.Run(nullptr);
+    });
+    tasks.emplace_back([&log] { log.push_back(2); });
+    runner.Append(tasks);
+
+    runner.Run(YieldEvery(100));
+    EXPECT_FALSE(runner.HasPending());
+    EXPECT_EQ(log, (std::vector<int>{0, 1, 2, 10, 11}));
+}
+
+TEST(KRSlicedTaskRunnerTest, EmptyFlushIsNoop) {
+    KRSlicedTaskRunner runner;
+    std::vector<KRTask> tasks;
+    runner.Append(tasks);
+    EXPECT_EQ(runner.Run(nullptr), 0u);
+    EXPECT_FALSE(runner.HasPending());
+}
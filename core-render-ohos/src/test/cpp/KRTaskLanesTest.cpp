@@ -0,0 +1,99 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRTaskLanes.h"
+
+namespace {
+
+/** 按工作线程的方式收取并执行全部任务 */
+void RunAll(KRTaskLanes &lanes) {
+    while (lanes.Collect()) {
+        lanes.RunNext();
+    }
+}
+
+}  // namespace
+
+TEST(KRTaskLanesTest, RunsByPriorityAndKeepsFifoWithinLane) {
+    KRTaskLanes lanes;
+    std::vector<std::string> log;
+    EXPECT_TRUE(lanes.Push([&] { log.push_back("timer"); }, KRTaskPriority::kTimer));
+    EXPECT_TRUE(lanes.Push([&] { log.push_back("create"); }, KRTaskPriority::kCallback));
+    EXPECT_FALSE(lanes.Push([&] { log.push_back("pageDidAppear"); }, KRTaskPriority::kCallback));
+    EXPECT_TRUE(lanes.Push([&] { log.push_back("idle"); }, KRTaskPriority::kIdle));
+    EXPECT_TRUE(lanes.Push([&] { log.push_back("touch"); }, KRTaskPriority::kInput));
+    EXPECT_TRUE(lanes.HasQueued());
+    RunAll(lanes);
+    EXPECT_EQ(log, (std::vector<std::string>{"touch", "create", "pageDidAppear", "timer", "idle"}));
+    EXPECT_FALSE(lanes.HasQueued());
+    EXPECT_FALSE(lanes.HasPending());
+}
+
+TEST(KRTaskLanesTest, NewHighPriorityTaskOvertakesCollectedBatch) {
+    KRTaskLanes lanes;
+    std::vector<std::string> log;
+    lanes.Push(
+        [&] {
+            log.push_back("callback1");
+            lanes.Push([&] { log.push_back("touch"); }, KRTaskPriority::kInput);
+        },
+        KRTaskPriority::kCallback);
+    lanes.Push([&] { log.push_back("callback2"); }, KRTaskPriority::kCallback);
+    RunAll(lanes);
+    EXPECT_EQ(log, (std::vector<std::string>{"callback1", "touch", "callback2"}));
+}
+
+TEST(KRTaskLanesTest, SkippedLaneRunsAfterBound) {
+    KRTaskLanes lanes;
+    int input_count = 0;
+    int timer_ran_after = -1;
+    lanes.Push([&] { timer_ran_after = input_count; }, KRTaskPriority::kTimer);
+    // 输入任务执行时不断补充新的输入任务，模拟持续的手势
+    std::function<void()> input = [&] {
+        input_count++;
+        if (input_count < 100) {
+            lanes.Push(input, KRTaskPriority::kInput);
+        }
+    };
+    lanes.Push(input, KRTaskPriority::kInput);
+    RunAll(lanes);
+    EXPECT_EQ(timer_ran_after, static_cast<int>(KRTaskLanes::kMaxSkippedCount));
+    EXPECT_EQ(input_count, 100);
+}
+
+TEST(KRTaskLanesTest, IdleLaneIsNotStarvedByContinuousWork) {
+    KRTaskLanes lanes;
+    int busy_count = 0;
+    std::vector<int> idle_ran_after;
+    for (int i = 0; i < 3; i++) {
+        lanes.Push([&] { idle_ran_after.push_back(busy_count); }, KRTaskPriority::kIdle);
+    }
+    std::function<void()> busy = [&] {
+        busy_count++;
+        if (busy_count < 1000) {
+            lanes.Push(busy, KRTaskPriority::kCallback);
+        }
+    };
+    lanes.Push(busy, KRTaskPriority::kCallback);
+    RunAll(lanes);
+    const int bound = static_cast<int>(KRTaskLanes::kMaxIdleSkippedCount);
+    EXPECT_EQ(idle_ran_after, (std::vector<int>{bound, bound * 2, bound * 3}));
+}
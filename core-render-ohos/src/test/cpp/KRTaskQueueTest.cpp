@@ -0,0 +1,107 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
+
+TEST(KRTaskQueueTest, DrainsInPushOrderAndReportsEmptyTransition) {
+    KRTaskQueue queue;
+    std::vector<int> order;
+    EXPECT_TRUE(queue.Push([&] { order.push_back(0); }));  // 由空变为非空，需要唤醒消费者
+    for (int i = 1; i < 5; i++) {
+        EXPECT_FALSE(queue.Push([&order, i] { order.push_back(i); }));
+    }
+    auto batch = queue.TakeAll();
+    EXPECT_TRUE(queue.Empty());
+    batch.Append(queue.TakeAll());  // 空批次
+    EXPECT_TRUE(queue.Push([&] { order.push_back(5); }));
+    batch.Append(queue.TakeAll());
+    while (!batch.Empty()) {
+        batch.RunFront();
+    }
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(KRTaskQueueTest, UnrunTasksAreReleasedWithTheirNodes) {
+    auto captured = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = captured;
+    {
+        KRTaskQueue queue;
+        queue.Push([captured] {});
+        queue.Push([captured = std::move(captured)] {});
+        auto batch = queue.TakeAll();
+        batch.RunFront();
+        EXPECT_FALSE(weak.expired());
+    }
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(KRTaskQueueTest, NodesAreRecycledThroughThePool) {
+    auto &pool = KRFixedBlockPool<sizeof(KRTaskQueue::Node)>::GetInstance();
+    KRTaskQueue queue;
+    for (int i = 0; i < 64; i++) {
+        queue.Push([] {});
+    }
+    queue.TakeAll();
+    size_t free_count = pool.FreeCount();
+    EXPECT_GE(free_count, 64u);
+    for (int i = 0; i < 64; i++) {
+        queue.Push([] {});
+    }
+    EXPECT_EQ(pool.FreeCount(), free_count - 64);  // 入队复用空闲节点
+    queue.TakeAll();
+    EXPECT_EQ(pool.FreeCount(), free_count);
+}
+
+TEST(KRTaskQueueTest, KeepsPerProducerOrderUnderContention) {
+    constexpr int kProducers = 4;
+    constexpr int kTasksPerProducer = 20000;
+    KRTaskQueue queue;
+    std::vector<int> last_seen(kProducers, -1);
+    std::atomic<bool> out_of_order{false};
+    int executed = 0;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < kTasksPerProducer; i++) {
+                queue.Push([&, p, i] {
+                    if (last_seen[p] + 1 != i) {
+                        out_of_order = true;
+                    }
+                    last_seen[p] = i;
+                    executed++;
+                });
+            }
+        });
+    }
+    KRTaskQueue::Batch pending;
+    while (executed < kProducers * kTasksPerProducer) {
+        pending.Append(queue.TakeAll());
+        while (!pending.Empty()) {
+            pending.RunFront();
+        }
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(out_of_order.load());
+    EXPECT_TRUE(queue.Empty());
+}
@@ -0,0 +1,171 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRThreadTrace.h"
+#include "libohos_render/utils/KRJSONObject.h"
+
+using kuikly::util::JSONObject;
+
+namespace {
+
+/**
+ * 在指定名字的新线程中执行，每个用例使用独立线程，从而拥有独立的环形缓冲区
+ */
+void RunOnNamedThread(const char *name, const std::function<void()> &fn) {
+    std::thread thread([name, &fn] {
+        pthread_setname_np(pthread_self(), name);
+        fn();
+    });
+    thread.join();
+}
+
+/**
+ * 导出并解析，返回指定线程记录的全部 X 事件
+ */
+std::vector<std::shared_ptr<JSONObject>> ExportThreadEvents(const std::string &thread_name) {
+    auto json = JSONObject::Parse(KRThreadTrace::ToChromeTraceJson());
+    EXPECT_NE(json, nullptr);
+    std::vector<std::shared_ptr<JSONObject>> events;
+    if (!json) {
+        return events;
+    }
+    auto trace_events = json->GetObjectItem("traceEvents");
+    int tid = -1;
+    for (int i = 0; i < trace_events->GetArraySize(); i++) {
+        auto event = trace_events->GetArrayItem(i);
+        if (event->GetString("ph") == "M" && event->GetObjectItem("args")->GetString("name") == thread_name) {
+            tid = static_cast<int>(event->GetNumber("tid"));
+        }
+    }
+    for (int i = 0; i < trace_events->GetArraySize(); i++) {
+        auto event = trace_events->GetArrayItem(i);
+        if (event->GetString("ph") == "X" && static_cast<int>(event->GetNumber("tid")) == tid) {
+            events.push_back(event);
+        }
+    }
+    return events;
+}
+
+class KRThreadTraceTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        KRThreadTrace::SetEnabled(true);
+    }
+    void TearDown() override {
+        KRThreadTrace::SetEnabled(false);
+    }
+};
+
+}  // namespace
+
+TEST_F(KRThreadTraceTest, ExportsScopeAsChromeTraceEvent) {
+    RunOnNamedThread("trace_scope", [] {
+        std::string page = "page_1";
+        int64_t queued_us = KRThreadTrace::NowMicros() - 500;
+        KRTraceScope trace("ContextTask", "callback", &page, queued_us);
+        trace.SetArg("taskCount", 3);
+    });
+    auto events = ExportThreadEvents("trace_scope");
+    ASSERT_EQ(events.size(), 1u);
+    auto event = events[0];
+    EXPECT_EQ(event->GetString("name"), "ContextTask");
+    EXPECT_EQ(event->GetString("cat"), "callback");
+    EXPECT_GE(event->GetNumber("dur"), 0);
+    auto args = event->GetObjectItem("args");
+    EXPECT_GE(args->GetNumber("waitUs"), 500);
+    EXPECT_EQ(args->GetString("page"), "page_1");
+    EXPECT_EQ(args->GetNumber("taskCount"), 3);
+}
+
+TEST_F(KRThreadTraceTest, DisabledScopeRecordsNothing) {
+    KRThreadTrace::SetEnabled(false);
+    RunOnNamedThread("trace_off", [] { KRTraceScope trace("ContextTask", "callback"); });
+    EXPECT_TRUE(ExportThreadEvents("trace_off").empty());
+}
+
+TEST_F(KRThreadTraceTest, LongPageIdIsTruncated) {
+    RunOnNamedThread("trace_page", [] {
+        std::string page(100, 'p');
+        KRThreadTrace::Record("Task", "callback", &page, 1, 1, 2);
+    });
+    auto events = ExportThreadEvents("trace_page");
+    ASSERT_EQ(events.size(), 1u);
+    auto page = events[0]->GetObjectItem("args")->GetString("page");
+    EXPECT_FALSE(page.empty());
+    EXPECT_LT(page.size(), 100u);
+    EXPECT_EQ(page, std::string(page.size(), 'p'));
+}
+
+TEST_F(KRThreadTraceTest, RingKeepsLatestEventsAfterOverwrite) {
+    constexpr int kRingCapacity = 4096;
+    constexpr int kRecordCount = kRingCapacity + 1000;
+    RunOnNamedThread("trace_ring", [] {
+        for (int i = 0; i < kRecordCount; i++) {
+            KRThreadTrace::Record("Task", "callback", nullptr, i, i, i + 1, "seq", i);
+        }
+    });
+    auto events = ExportThreadEvents("trace_ring");
+    ASSERT_EQ(events.size(), static_cast<size_t>(kRingCapacity));
+    for (int i = 0; i < kRingCapacity; i++) {
+        EXPECT_EQ(events[i]->GetObjectItem("args")->GetNumber("seq"), kRecordCount - kRingCapacity + i);
+    }
+}
+
+TEST_F(KRThreadTraceTest, ExportWhileThreadsRecord) {
+    constexpr int kThreadCount = 4;
+    constexpr int kRecordCount = 10000;
+    std::atomic<int> running{kThreadCount};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; t++) {
+        threads.emplace_back([t, &running] {
+            std::string name = "trace_mt" + std::to_string(t);
+            pthread_setname_np(pthread_self(), name.c_str());
+            for (int i = 0; i < kRecordCount; i++) {
+                KRThreadTrace::Record("Task", "callback", nullptr, i, i, i + 1, "seq", i);
+            }
+            running--;
+        });
+    }
+    // 记录期间反复导出，导出结果需始终是合法 JSON，且每个线程的事件按记录顺序排列
+    int exports = 0;
+    while (running.load() > 0 || exports == 0) {
+        for (int t = 0; t < kThreadCount; t++) {
+            auto events = ExportThreadEvents("trace_mt" + std::to_string(t));
+            for (size_t i = 1; i < events.size(); i++) {
+                ASSERT_LT(events[i - 1]->GetObjectItem("args")->GetNumber("seq"),
+                          events[i]->GetObjectItem("args")->GetNumber("seq"));
+            }
+        }
+        exports++;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < kThreadCount; t++) {
+        auto events = ExportThreadEvents("trace_mt" + std::to_string(t));
+        ASSERT_EQ(events.size(), 4096u);
+        EXPECT_EQ(events.back()->GetObjectItem("args")->GetNumber("seq"), kRecordCount - 1);
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/** 记录定时任务在时间轮线程上的触发顺序与时刻 */
+class FireLog {
+ public:
+    struct Entry {
+        int index;
+        Clock::time_point time;
+    };
+
+    KRTask Task(int index) {
+        return [this, index] {
+            std::lock_guard<std::mutex> lock(mutex_);
+            entries_.push_back(Entry{index, Clock::now()});
+            condition_.notify_all();
+        };
+    }
+
+    /** 等待触发数达到 count，超时返回 false */
+    bool WaitFor(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return condition_.wait_for(lock, std::chrono::seconds(5), [&] { return entries_.size() >= count; });
+    }
+
+    std::vector<Entry> Entries() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<Entry> entries_;
+};
+
+}  // namespace
+
+TEST(KRTimerWheelTest, SameTickTimersFireInScheduleOrder) {
+    constexpr int kCount = 1000;
+    FireLog log;
+    for (int i = 0; i < kCount; i++) {
+        KRTimerWheel::GetInstance().Schedule(20, log.Task(i));
+    }
+    ASSERT_TRUE(log.WaitFor(kCount));
+    auto entries = log.Entries();
+    ASSERT_EQ(entries.size(), static_cast<size_t>(kCount));
+    for (int i = 0; i < kCount; i++) {
+        EXPECT_EQ(entries[i].index, i);
+    }
+}
+
+TEST(KRTimerWheelTest, EqualDelaysKeepOrderAcrossLevelsAndNeverFireEarly) {
+    // 1ms 落在第 0 层，80ms 与 300ms 需要从第 1 层下沉
+    const int delays[] = {1, 80, 300};
+    constexpr int kPerDelay = 300;
+    FireLog log;
+    std::vector<Clock::time_point> scheduled_at;
+    for (int i = 0; i < kPerDelay * 3; i++) {
+        scheduled_at.push_back(Clock::now());
+        KRTimerWheel::GetInstance().Schedule(delays[i % 3], log.Task(i));
+    }
+    ASSERT_TRUE(log.WaitFor(kPerDelay * 3));
+    int last_index[3] = {-1, -1, -1};
+    for (auto &entry : log.Entries()) {
+        int group = entry.index % 3;
+        EXPECT_GT(entry.index, last_index[group]);
+        last_index[group] = entry.index;
+        EXPECT_GE(entry.time - scheduled_at[entry.index], std::chrono::milliseconds(delays[group]));
+    }
+}
+
+TEST(KRTimerWheelTest, CancelledTimersNeverFire) {
+    constexpr int kCount = 100;
+    FireLog log;
+    std::vector<KRTimerId> ids;
+    for (int i = 0; i < kCount; i++) {
+        ids.push_back(KRTimerWheel::GetInstance().Schedule(30, log.Task(i)));
+    }
+    for (int i = 1; i < kCount; i += 2) {
+        EXPECT_TRUE(KRTimerWheel::GetInstance().Cancel(ids[i]));
+        EXPECT_FALSE(KRTimerWheel::GetInstance().Cancel(ids[i]));
+    }
+    ASSERT_TRUE(log.WaitFor(kCount / 2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto entries = log.Entries();
+    ASSERT_EQ(entries.size(), static_cast<size_t>(kCount / 2));
+    for (int i = 0; i < kCount / 2; i++) {
+        EXPECT_EQ(entries[i].index, i * 2);
+    }
+    EXPECT_FALSE(KRTimerWheel::GetInstance().Cancel(ids[0]));  // 已触发
+    EXPECT_FALSE(KRTimerWheel::GetInstance().Cancel(kKRInvalidTimerId));
+}
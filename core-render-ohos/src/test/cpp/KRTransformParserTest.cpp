@@ -0,0 +1,118 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+#include "libohos_render/utils/KRTransformParser.h"
+
+using kuikly::util::KRTransformParser;
+
+namespace {
+
+using Matrix = std::array<double, 16>;
+
+/** 逐项与重写前的实现（三次 4x4 矩阵相乘）输出的基准值比较，闭式展开只允许舍入误差 */
+void ExpectMatrixNear(const Matrix &actual, const Matrix &expected) {
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 1e-12) << "index " << i;
+    }
+}
+
+KRTransformParser Parse(const std::string &css_transform) {
+    KRTransformParser parser;
+    EXPECT_TRUE(parser.ParseFromCssTransform(css_transform)) << css_transform;
+    return parser;
+}
+
+}  // namespace
+
+TEST(KRTransformParserTest, IdentityTransform) {
+    auto parser = Parse("0|1 1|0 0|0.5 0.5|0 0");
+    EXPECT_DOUBLE_EQ(parser.anchor_x_, 0.5);
+    EXPECT_DOUBLE_EQ(parser.anchor_y_, 0.5);
+    EXPECT_DOUBLE_EQ(parser.scale_x_, 1);
+    EXPECT_DOUBLE_EQ(parser.scale_y_, 1);
+    ExpectMatrixNear(parser.GetMatrixWithNoRotate(), {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1});
+}
+
+TEST(KRTransformParserTest, ScaleTranslateAndAnchor) {
+    auto parser = Parse("0|2 0.5|10 -20|0 1|0 0");
+    EXPECT_DOUBLE_EQ(parser.anchor_x_, 0);
+    EXPECT_DOUBLE_EQ(parser.anchor_y_, 1);
+    EXPECT_DOUBLE_EQ(parser.translation_x_, 10);
+    EXPECT_DOUBLE_EQ(parser.translation_y_, -20);
+    ExpectMatrixNear(parser.GetMatrixWithNoRotate(), {2, 0, 0, 0, 0, 0.5, 0, 0, 0, 0, 1, 0, 10, -20, 0, 1});
+}
+
+TEST(KRTransformParserTest, SkewMatchesLegacyMatrix) {
+    ExpectMatrixNear(Parse("0|1 1|0 0|0.5 0.5|30 0").GetMatrixWithNoRotate(),
+                     {1, 0, 0, 0, -0.57735026918962573, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1});
+    ExpectMatrixNear(Parse("0|2 3|5 6|0.5 0.5|10 -20").GetMatrixWithNoRotate(),
+                     {2, 1.091910702798607, 0, 0, -0.35265396141692995, 3, 0, 0, 0, 0, 1, 0, 5, 6, 0, 1});
+    // 数值按 float 精度解析
+    ExpectMatrixNear(Parse("12.5|1.2 0.8|0.1 0.2|0.5 0.5|3 4").GetMatrixWithNoRotate(),
+                     {1.2000000476837158, -0.055941450388400892, 0, 0, -0.062889337638647083, 0.80000001192092896, 0,
+                      0, 0, 0, 1, 0, 0.10000000149011612, 0.20000000298023224, 0, 1});
+}
+
+TEST(KRTransformParserTest, RotationIsParsedButNotAppliedToMatrix) {
+    auto parser = Parse("45|1.5 1.5|0.1 0.2|0.5 0.5|0 0");
+    EXPECT_DOUBLE_EQ(parser.rotate_angle_, 45);
+    EXPECT_DOUBLE_EQ(parser.translation_x_, static_cast<double>(0.1f));
+    ExpectMatrixNear(parser.GetMatrixWithNoRotate(),
+                     {1.5, 0, 0, 0, 0, 1.5, 0, 0, 0, 0, 1, 0, 0.10000000149011612, 0.20000000298023224, 0, 1});
+
+    auto rotate_xy = Parse("30|1 1|0 0|0.5 0.5|0 0|15 25");
+    EXPECT_DOUBLE_EQ(rotate_xy.rotate_angle_, 30);
+    EXPECT_DOUBLE_EQ(rotate_xy.rotate_x_angle_, 15);
+    EXPECT_DOUBLE_EQ(rotate_xy.rotate_y_angle_, 25);
+}
+
+TEST(KRTransformParserTest, MalformedNumbersFallBackToZero) {
+    auto parser = Parse("abc|1x 2y|0 0|a b|0 0");  // 忽略数值后的多余字符，无数值时为 0
+    EXPECT_DOUBLE_EQ(parser.rotate_angle_, 0);
+    EXPECT_DOUBLE_EQ(parser.scale_x_, 1);
+    EXPECT_DOUBLE_EQ(parser.scale_y_, 2);
+    EXPECT_DOUBLE_EQ(parser.anchor_x_, 0);
+    EXPECT_DOUBLE_EQ(parser.anchor_y_, 0);
+
+    EXPECT_DOUBLE_EQ(Parse("1e40|1 1|0 0|0.5 0.5|0 0").rotate_angle_, 0);  // 超出 float 范围
+    EXPECT_DOUBLE_EQ(Parse("0|\t 2|0 0|0.5 0.5|0 0").scale_x_, 0);        // 仅含空白
+}
+
+TEST(KRTransformParserTest, RejectsMissingSegments) {
+    for (const char *css : {"", "0|1 1|0 0|0.5 0.5", "0|1|0 0|0.5 0.5|0 0", "0|1 1|0|0.5 0.5|0 0",
+                            "0|1 1|0 0|0.5|0 0", "0|1 1|0 0|0.5 0.5|0"}) {
+        KRTransformParser parser;
+        EXPECT_FALSE(parser.ParseFromCssTransform(css)) << css;
+    }
+}
+
+TEST(KRTransformParserTest, CachedResultMatchesFreshParseAfterEviction) {
+    const std::string css = "12.5|1.2 0.8|0.1 0.2|0.5 0.5|3 4";
+    auto first = Parse(css);
+    auto cached = Parse(css);
+    EXPECT_EQ(cached.GetMatrixWithNoRotate(), first.GetMatrixWithNoRotate());
+    for (int i = 0; i < 64; ++i) {  // 超过缓存容量，css 被淘汰
+        Parse(std::to_string(i) + "|1 1|0 0|0.5 0.5|0 0");
+    }
+    auto reparsed = Parse(css);
+    EXPECT_EQ(reparsed.GetMatrixWithNoRotate(), first.GetMatrixWithNoRotate());
+    EXPECT_DOUBLE_EQ(reparsed.rotate_angle_, 12.5);
+    EXPECT_DOUBLE_EQ(reparsed.skew_y_, 4);
+}
@@ -0,0 +1,115 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "libohos_render/utils/KRUtf8Util.h"
+
+using kuikly::util::Utf16Length;
+
+namespace {
+
+void AppendUtf8(std::string &out, char32_t cp) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+}  // namespace
+
+TEST(KRUtf8UtilTest, AsciiAndBmpCountOneUnitPerCodePoint) {
+    EXPECT_EQ(Utf16Length(""), 0u);
+    EXPECT_EQ(Utf16Length("hello"), 5u);
+    EXPECT_EQ(Utf16Length(std::string(37, 'a')), 37u);  // 跨越多个 16 字节整块
+    EXPECT_EQ(Utf16Length("\xC3\xA9"), 1u);              // é
+    EXPECT_EQ(Utf16Length("\xE4\xBD\xA0\xE5\xA5\xBD"), 2u);  // 你好
+    EXPECT_EQ(Utf16Length(std::string(20, 'a') + "\xE4\xBD\xA0" + std::string(20, 'b')), 41u);
+}
+
+TEST(KRUtf8UtilTest, SupplementaryCharactersCountAsSurrogatePairs) {
+    EXPECT_EQ(Utf16Length("\xF0\x9F\x98\x80"), 2u);  // U+1F600
+    EXPECT_EQ(Utf16Length("\xF0\x90\x80\x80"), 2u);  // U+10000
+    EXPECT_EQ(Utf16Length("\xF4\x8F\xBF\xBF"), 2u);  // U+10FFFF
+    EXPECT_EQ(Utf16Length("a\xF0\x9F\x98\x80" "b"), 4u);
+}
+
+TEST(KRUtf8UtilTest, ZwjEmojiSequencesCountEveryCodePoint) {
+    // 👨‍👩‍👧：3 个辅助平面字符 + 2 个 U+200D
+    EXPECT_EQ(Utf16Length("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"), 8u);
+    // 🏳️‍🌈：U+1F3F3 U+FE0F U+200D U+1F308
+    EXPECT_EQ(Utf16Length("\xF0\x9F\x8F\xB3\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x8C\x88"), 6u);
+    // 🇨🇳：两个区域指示符
+    EXPECT_EQ(Utf16Length("\xF0\x9F\x87\xA8\xF0\x9F\x87\xB3"), 4u);
+}
+
+TEST(KRUtf8UtilTest, InvalidSequencesCountOneReplacementPerMaximalSubpart) {
+    EXPECT_EQ(Utf16Length("\x80"), 1u);                  // 孤立的后续字节
+    EXPECT_EQ(Utf16Length("\xFF"), 1u);
+    EXPECT_EQ(Utf16Length("\xC0\x80"), 2u);              // 过长编码的首字节非法
+    EXPECT_EQ(Utf16Length("\xE0\x80\x80"), 3u);          // 过长的三字节序列
+    EXPECT_EQ(Utf16Length("\xED\xA0\x80"), 3u);          // UTF-8 编码的代理码点
+    EXPECT_EQ(Utf16Length("\xF4\x90\x80\x80"), 4u);      // 超出 U+10FFFF
+    EXPECT_EQ(Utf16Length("\xE4\xBD"), 1u);              // 末尾截断
+    EXPECT_EQ(Utf16Length("\xF0\x9F\x98" "a"), 2u);      // 截断后紧跟 ASCII
+    EXPECT_EQ(Utf16Length("\xF0\x9F\xF0\x9F\x98\x80"), 3u);  // 截断后紧跟完整序列
+}
+
+TEST(KRUtf8UtilTest, RandomValidTextMatchesCodePointCount) {
+    std::mt19937 rng(20251017);
+    std::uniform_int_distribution<int> plane(0, 3);
+    for (int round = 0; round < 200; ++round) {
+        std::string text;
+        size_t expected = 0;
+        int length = static_cast<int>(rng() % 64);
+        for (int i = 0; i < length; ++i) {
+            char32_t cp;
+            switch (plane(rng)) {
+                case 0:
+                    cp = rng() % 0x80;
+                    break;
+                case 1:
+                    cp = 0x80 + rng() % (0x800 - 0x80);
+                    break;
+                case 2:
+                    cp = 0x800 + rng() % (0x10000 - 0x800);
+                    if (cp >= 0xD800 && cp <= 0xDFFF) {
+                        cp = 0x4E2D;
+                    }
+                    break;
+                default:
+                    cp = 0x10000 + rng() % (0x110000 - 0x10000);
+                    break;
+            }
+            AppendUtf8(text, cp);
+            expected += cp > 0xFFFF ? 2 : 1;
+        }
+        ASSERT_EQ(Utf16Length(text), expected) << "round " << round;
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * APNG 1080p 帧合成耗时对比，按帧区域像素数折算为 ns/pixel：
+ *   blend  : APNGBlendRowOver（NEON/SSE2）、APNGBlendRowOverScalar 与旧实现的逐像素浮点合成
+ *   dispose: APNGCompositor 的逐行清除与按帧区域保存/恢复，对比旧实现逐行 std::fill 与整张画布拷贝后交换
+ * 帧像素按精灵图常见分布生成：每行依次为不透明、全透明与半透明渐变三段
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/expand/components/apng/APNGBlendKernels.h"
+#include "libohos_render/expand/components/apng/APNGCompositor.h"
+
+namespace {
+
+constexpr int kWidth = 1920;
+constexpr int kHeight = 1080;
+constexpr int kRounds = 10;
+
+/** 旧实现的逐像素浮点合成，仅用于对比 */
+void LegacyBlendOver(std::vector<uint8_t> &canvas, const uint8_t *frame, int width, int height) {
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int idx = (y * width + x) * 4;
+            uint8_t srcR = frame[idx + 0];
+            uint8_t srcG = frame[idx + 1];
+            uint8_t srcB = frame[idx + 2];
+            uint8_t srcA = frame[idx + 3];
+            uint8_t dstR = canvas[idx + 0];
+            uint8_t dstG = canvas[idx + 1];
+            uint8_t dstB = canvas[idx + 2];
+            uint8_t dstA = canvas[idx + 3];
+            float srcAlpha = srcA / 255.0f;
+            float dstAlpha = dstA / 255.0f;
+            float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+            if (outAlpha == 0) {
+                canvas[idx + 0] = 0;
+                canvas[idx + 1] = 0;
+                canvas[idx + 2] = 0;
+                canvas[idx + 3] = 0;
+            } else {
+                canvas[idx + 0] = static_cast<uint8_t>((srcR * srcAlpha + dstR * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                canvas[idx + 1] = static_cast<uint8_t>((srcG * srcAlpha + dstG * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                canvas[idx + 2] = static_cast<uint8_t>((srcB * srcAlpha + dstB * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                canvas[idx + 3] = static_cast<uint8_t>(outAlpha * 255);
+            }
+        }
+    }
+}
+
+std::vector<uint8_t> SpritePixels(int width, int height) {
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            uint8_t *p = pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+            p[0] = static_cast<uint8_t>(x * 7 + y);
+            p[1] = static_cast<uint8_t>(x + y * 3);
+            p[2] = static_cast<uint8_t>(x ^ y);
+            int segment = x * 3 / width;
+            p[3] = segment == 0 ? 255 : (segment == 1 ? 0 : static_cast<uint8_t>(1 + (x + y) % 254));
+        }
+    }
+    return pixels;
+}
+
+std::vector<uint8_t> Background(uint8_t alpha) {
+    std::vector<uint8_t> canvas(static_cast<size_t>(kWidth) * kHeight * 4);
+    for (size_t i = 0; i < canvas.size(); ++i) {
+        canvas[i] = i % 4 == 3 ? alpha : static_cast<uint8_t>(i * 13);
+    }
+    return canvas;
+}
+
+void ReportPerPixel(const char *name, double ns_per_frame, size_t pixels) {
+    printf("%-48s %8.2f ns/pixel\n", name, ns_per_frame / static_cast<double>(pixels));
+}
+
+void BenchBlend(const char *dst_name, uint8_t dst_alpha) {
+    const size_t pixels = static_cast<size_t>(kWidth) * kHeight;
+    auto frame = SpritePixels(kWidth, kHeight);
+    const auto background = Background(dst_alpha);
+    auto canvas = background;
+    char name[64];
+
+    auto rows = [&](void (*kernel)(uint8_t *, const uint8_t *, int)) {
+        return kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+            canvas = background;  // 每轮从同一画布开始，拷贝耗时另行扣除
+            for (int y = 0; y < kHeight; ++y) {
+                size_t offset = static_cast<size_t>(y) * kWidth * 4;
+                kernel(canvas.data() + offset, frame.data() + offset, kWidth);
+            }
+        });
+    };
+    double reset_ns = kuikly::bench::MeasureNsPerOp(1, kRounds, [&] { canvas = background; });
+
+    snprintf(name, sizeof(name), "blend simd   over %s dst", dst_name);
+    ReportPerPixel(name, rows(APNGBlendRowOver) - reset_ns, pixels);
+    snprintf(name, sizeof(name), "blend scalar over %s dst", dst_name);
+    ReportPerPixel(name, rows(APNGBlendRowOverScalar) - reset_ns, pixels);
+    snprintf(name, sizeof(name), "blend legacy over %s dst", dst_name);
+    ReportPerPixel(name, kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+        canvas = background;
+        LegacyBlendOver(canvas, frame.data(), kWidth, kHeight);
+    }) - reset_ns, pixels);
+    kuikly::bench::DoNotOptimize(canvas[0]);
+}
+
+/** 帧区域为画布中央 w x h，合成（blend_op 0）后执行 dispose */
+void BenchDispose(int width, int height) {
+    const size_t pixels = static_cast<size_t>(width) * height;
+    APNGFrameRegion region;
+    region.left = (kWidth - width) / 2;
+    region.top = (kHeight - height) / 2;
+    region.width = width;
+    region.height = height;
+    auto frame = SpritePixels(width, height);
+    char name[64];
+
+    APNGCompositor compositor(kWidth, kHeight);
+    region.disposeOp = 1;
+    snprintf(name, sizeof(name), "dispose background %dx%d", width, height);
+    ReportPerPixel(name, kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+        compositor.ComposeFrame(region, frame.data());
+        compositor.DisposeFrame(region);
+    }), pixels);
+    region.disposeOp = 2;
+    snprintf(name, sizeof(name), "dispose previous   %dx%d", width, height);
+    ReportPerPixel(name, kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+        compositor.ComposeFrame(region, frame.data());
+        compositor.DisposeFrame(region);
+    }), pixels);
+
+    // 旧实现：dispose_op 1 逐行 std::fill；dispose_op 2 合成前拷贝整张画布，输出后交换
+    std::vector<uint8_t> canvas(static_cast<size_t>(kWidth) * kHeight * 4, 0);
+    std::vector<uint8_t> previous_canvas;
+    auto legacy_compose = [&] {
+        for (int y = 0; y < height; ++y) {
+            std::copy_n(frame.data() + static_cast<size_t>(y) * width * 4, width * 4,
+                        canvas.begin() + ((static_cast<size_t>(y) + region.top) * kWidth + region.left) * 4);
+        }
+    };
+    snprintf(name, sizeof(name), "legacy dispose background %dx%d", width, height);
+    ReportPerPixel(name, kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+        legacy_compose();
+        for (int y = 0; y < height; ++y) {
+            auto row = canvas.begin() + ((static_cast<size_t>(y) + region.top) * kWidth + region.left) * 4;
+            std::fill(row, row + width * 4, 0);
+        }
+    }), pixels);
+    snprintf(name, sizeof(name), "legacy dispose previous   %dx%d", width, height);
+    ReportPerPixel(name, kuikly::bench::MeasureNsPerOp(1, kRounds, [&] {
+        previous_canvas = canvas;
+        legacy_compose();
+        canvas.swap(previous_canvas);
+    }), pixels);
+    kuikly::bench::DoNotOptimize(canvas[0]);
+    kuikly::bench::DoNotOptimize(compositor.Canvas()[0]);
+}
+
+}  // namespace
+
+int main() {
+    BenchBlend("opaque", 255);
+    BenchBlend("empty", 0);
+    BenchDispose(kWidth, kHeight);
+    BenchDispose(kWidth / 2, kHeight / 2);
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBENCHUTIL_H
+#define CORE_RENDER_OHOS_KRBENCHUTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace kuikly {
+namespace bench {
+
+/** 阻止编译器把基准测试的计算结果优化掉 */
+template <typename T> inline void DoNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * 重复执行 rounds 轮 fn，取耗时最短的一轮，返回平均每次操作的纳秒数
+ * @param ops_per_round 每轮 fn 内执行的操作次数
+ */
+template <typename F> double MeasureNsPerOp(size_t ops_per_round, int rounds, F &&fn) {
+    double best = 0;
+    for (int i = 0; i < rounds; i++) {
+        auto begin = std::chrono::steady_clock::now();
+        fn();
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best / static_cast<double>(ops_per_round);
+}
+
+inline void Report(const char *name, double ns_per_op) {
+    printf("%-48s %12.1f ns/op\n", name, ns_per_op);
+}
+
+/** 延迟分布统计，samples 以纳秒为单位 */
+struct LatencyPercentiles {
+    int64_t p50 = 0;
+    int64_t p99 = 0;
+    int64_t max = 0;
+};
+
+inline LatencyPercentiles ComputePercentiles(std::vector<int64_t> samples) {
+    LatencyPercentiles result;
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end());
+    result.p50 = samples[samples.size() / 2];
+    result.p99 = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    result.max = samples.back();
+    return result;
+}
+
+inline void ReportLatency(const char *name, const LatencyPercentiles &latency) {
+    printf("%-48s p50 %8lld ns  p99 %8lld ns  max %8lld ns\n", name, static_cast<long long>(latency.p50),
+           static_cast<long long>(latency.p99), static_cast<long long>(latency.max));
+}
+
+}  // namespace bench
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRBENCHUTIL_H
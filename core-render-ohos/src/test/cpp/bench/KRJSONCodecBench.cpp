@@ -0,0 +1,232 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * JSON 编解码吞吐对比，载荷为桥接层常见的三类数据：
+ *   cJSON  : cJSON_Parse 构建 DOM 后 cJSON_Delete；序列化为 cJSON_PrintUnformatted / cJSON_Print
+ *   codec  : JSONReader 读入与 KRRenderValue 同构的值树（Map/Array 元素以 shared_ptr 持有）；JSONWriter 输出
+ * codec scan 只校验并跳过整段 JSON，不建值树，用于区分读取器本身与建树的开销
+ * 每项报告单次操作耗时与按输入字节计算的吞吐
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/utils/KRJSONCodec.h"
+#include "thirdparty/cJSON/cJSON.h"
+
+namespace {
+
+using kuikly::util::JSONReader;
+using kuikly::util::JSONWriter;
+
+constexpr int kOpsPerRound = 200;
+constexpr int kRounds = 30;
+
+/** 与 KRRenderValue 同构的最小值树，host 上无法编译 KRRenderValue（依赖 napi） */
+struct BenchValue {
+    using Map = std::unordered_map<std::string, std::shared_ptr<BenchValue>>;
+    using Array = std::vector<std::shared_ptr<BenchValue>>;
+    std::variant<std::monostate, bool, double, std::string, Map, Array> value;
+};
+
+std::shared_ptr<BenchValue> ReadValue(JSONReader &reader) {
+    auto result = std::make_shared<BenchValue>();
+    switch (reader.PeekType()) {
+        case JSONReader::ValueType::kBool: {
+            bool value = false;
+            reader.ReadBool(value);
+            result->value = value;
+            break;
+        }
+        case JSONReader::ValueType::kNumber: {
+            double value = 0;
+            reader.ReadNumber(value);
+            result->value = value;
+            break;
+        }
+        case JSONReader::ValueType::kString: {
+            std::string value;
+            reader.ReadString(value);
+            result->value = std::move(value);
+            break;
+        }
+        case JSONReader::ValueType::kObject: {
+            BenchValue::Map map;
+            reader.ReadObject([&reader, &map](std::string_view key) {
+                map.insert_or_assign(std::string(key), ReadValue(reader));
+                return reader.IsValid();
+            });
+            result->value = std::move(map);
+            break;
+        }
+        case JSONReader::ValueType::kArray: {
+            BenchValue::Array array;
+            reader.ReadArray([&reader, &array](size_t) {
+                array.push_back(ReadValue(reader));
+                return reader.IsValid();
+            });
+            result->value = std::move(array);
+            break;
+        }
+        default:
+            reader.ReadNull();
+            break;
+    }
+    return result;
+}
+
+void WriteValue(JSONWriter &writer, const BenchValue &value) {
+    if (auto b = std::get_if<bool>(&value.value)) {
+        writer.Bool(*b);
+    } else if (auto d = std::get_if<double>(&value.value)) {
+        writer.Double(*d);
+    } else if (auto s = std::get_if<std::string>(&value.value)) {
+        writer.String(*s);
+    } else if (auto map = std::get_if<BenchValue::Map>(&value.value)) {
+        writer.BeginObject();
+        for (const auto &entry : *map) {
+            writer.Key(entry.first);
+            WriteValue(writer, *entry.second);
+        }
+        writer.EndObject();
+    } else if (auto array = std::get_if<BenchValue::Array>(&value.value)) {
+        writer.BeginArray();
+        for (const auto &element : *array) {
+            WriteValue(writer, *element);
+        }
+        writer.EndArray();
+    } else {
+        writer.Null();
+    }
+}
+
+/** 手势事件：坐标、状态与多指触点 */
+std::string EventPayload() {
+    std::string json = R"({"x":182.5,"y":640.25,"pageX":182.5,"pageY":720.25,"state":"move","timestamp":1729152000123,)";
+    json += R"("pointerId":0,"touches":[)";
+    for (int i = 0; i < 3; i++) {
+        char touch[160];
+        snprintf(touch, sizeof(touch), R"(%s{"x":%d.5,"y":%d.25,"pageX":%d.5,"pageY":%d.25,"pointerId":%d})",
+                 i ? "," : "", 100 + i * 37, 600 + i * 11, 100 + i * 37, 680 + i * 11, i);
+        json += touch;
+    }
+    json += "]}";
+    return json;
+}
+
+/** Canvas 绘制指令：一帧内的路径与填充操作 */
+std::string CanvasPayload() {
+    std::string json = "[";
+    for (int i = 0; i < 40; i++) {
+        char op[200];
+        snprintf(op, sizeof(op),
+                 R"(%s{"method":"moveTo","params":[%d.5,%d.75]},{"method":"lineTo","params":[%d.25,%d.5]},)"
+                 R"({"method":"arc","params":[%d,%d,12.5,0,6.283185307179586,false]})",
+                 i ? "," : "", i * 3, i * 7, i * 5, i * 2, i * 4, i * 6);
+        json += op;
+    }
+    json += R"(,{"method":"fillStyle","params":["#CCFF6600"]},{"method":"fill","params":[]}])";
+    return json;
+}
+
+/** Module 调用参数：网络请求 */
+std::string ModulePayload() {
+    return R"({"url":"https://example.com/api/feed/list?page=2&size=20&channel=recommend","method":"POST",)"
+           R"("headers":{"Content-Type":"application/json","Accept":"application/json","X-Trace-Id":"a1b2c3d4e5f6",)"
+           R"("Cookie":"uid=1234567890; session=abcdefabcdefabcdef"},"param":{"cursor":"eyJvZmZzZXQiOjIwfQ==",)"
+           R"("filters":["video","article","live"],"lat":22.543096,"lng":114.057865,"debug":false},)"
+           R"("timeout":30,"cookieEnable":true,"body":"{\"escaped\":\"line\\nbreak \\u4e2d\\u6587\"}"})";
+}
+
+void Run(const char *name, const std::string &json) {
+    double bytes = static_cast<double>(json.size());
+    auto report = [&](const char *path, double ns) {
+        char label[64];
+        snprintf(label, sizeof(label), "%-6s %s", name, path);
+        printf("%-40s %10.1f ns/op %8.1f MB/s\n", label, ns, bytes / ns * 1e3);
+    };
+
+    size_t sink = 0;
+    report("cJSON parse", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            cJSON *root = cJSON_Parse(json.c_str());
+            sink += root != nullptr;
+            cJSON_Delete(root);
+        }
+    }));
+    report("codec parse", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            JSONReader reader(json);
+            sink += ReadValue(reader)->value.index();
+        }
+    }));
+
+    report("codec scan", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            JSONReader reader(json);
+            sink += reader.SkipValue();
+        }
+    }));
+
+    cJSON *root = cJSON_Parse(json.c_str());
+    JSONReader reader(json);
+    auto value = ReadValue(reader);
+    report("cJSON print compact", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            char *printed = cJSON_PrintUnformatted(root);
+            sink += printed[0];
+            free(printed);
+        }
+    }));
+    report("codec write compact", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            std::string out;
+            JSONWriter writer(out);
+            WriteValue(writer, *value);
+            sink += out.size();
+        }
+    }));
+    report("cJSON print pretty", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            char *printed = cJSON_Print(root);
+            sink += printed[0];
+            free(printed);
+        }
+    }));
+    report("codec write pretty", kuikly::bench::MeasureNsPerOp(kOpsPerRound, kRounds, [&] {
+        for (int i = 0; i < kOpsPerRound; i++) {
+            std::string out;
+            JSONWriter writer(out, JSONWriter::Format::kPretty);
+            WriteValue(writer, *value);
+            sink += out.size();
+        }
+    }));
+    cJSON_Delete(root);
+    kuikly::bench::DoNotOptimize(sink);
+}
+
+}  // namespace
+
+int main() {
+    Run("event", EventPayload());
+    Run("canvas", CanvasPayload());
+    Run("module", ModulePayload());
+    return 0;
+}
@@ -0,0 +1,207 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * 属性下发分发耗时对比，回放同一段属性流：
+ *   legacy : 旧实现，基础属性、基础事件、组件属性三层依次 strcmp 比较属性名
+ *   interned: 桥接层把属性名解析为 KRPropKey（批量指令按 DEFINE_PROP_KEY 只解析一次，逐条调用每次解析），各层 switch 分发
+ * 属性流按列表页首屏的下发顺序整理：每个列表项为容器 View + 图片 + 两个文本 View，属性数与顺序与 Kotlin 侧 setProp 一致
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/foundation/KRPropKey.h"
+
+namespace {
+
+constexpr int kRounds = 200;
+
+enum class ViewKind { kView, kImage };
+
+struct PropRecord {
+    ViewKind kind;
+    std::string key;
+    bool has_callback;   // 事件属性携带回调
+    KRPropKey bridge_id;  // 批量指令下桥接层已解析的ID
+};
+
+std::vector<PropRecord> RecordedStream() {
+    struct Entry {
+        ViewKind kind;
+        const char *key;
+        bool has_callback;
+    };
+    static const Entry kItem[] = {
+        {ViewKind::kView, "frame", false},           {ViewKind::kView, "backgroundColor", false},
+        {ViewKind::kView, "borderRadius", false},    {ViewKind::kView, "click", true},
+        {ViewKind::kView, "accessibility", false},   {ViewKind::kImage, "frame", false},
+        {ViewKind::kImage, "borderRadius", false},   {ViewKind::kImage, "resize", false},
+        {ViewKind::kImage, "src", false},            {ViewKind::kImage, "loadSuccess", true},
+        {ViewKind::kView, "frame", false},           {ViewKind::kView, "opacity", false},
+        {ViewKind::kView, "touchDown", true},        {ViewKind::kView, "frame", false},
+        {ViewKind::kView, "backgroundImage", false}, {ViewKind::kView, "boxShadow", false},
+        {ViewKind::kView, "transform", false},       {ViewKind::kView, "customAttr", false},
+    };
+    std::vector<PropRecord> stream;
+    for (int item = 0; item < 100; item++) {
+        for (const auto &entry : kItem) {
+            stream.push_back({entry.kind, entry.key, entry.has_callback, KRPropKeyFromString(entry.key)});
+        }
+    }
+    return stream;
+}
+
+/** 以下属性名顺序与旧实现各层的比较顺序一致 */
+const char *const kLegacyBaseProps[] = {
+    "backgroundColor", "borderRadius", "border", "frame", "backgroundImage", "transform", "opacity", "visibility",
+    "overflow", "zIndex", "touchEnable", "accessibility", "boxShadow", "animation", "animationCompletion", "clipPath"};
+const char *const kLegacyGestureEvents[] = {"click", "doubleClick", "longPress", "pan", "pinch"};
+const char *const kLegacyViewProps[] = {"touchDown", "touchMove", "touchUp", "preventTouch", "superTouch",
+                                        "hit-test-ohos"};
+const char *const kLegacyImageProps[] = {"src", "resize", "blurRadius", "tintColor", "capInsets", "dotNineImage",
+                                         "maskLinearGradient", "loadSuccess", "loadResolution", "loadFailure",
+                                         "dragEnable"};
+
+template <size_t N> int LegacyMatch(const char *const (&keys)[N], const std::string &prop_key) {
+    for (size_t i = 0; i < N; i++) {
+        if (strcmp(prop_key.c_str(), keys[i]) == 0) {
+            return static_cast<int>(i) + 1;
+        }
+    }
+    return 0;
+}
+
+int LegacyDispatch(const PropRecord &record) {
+    if (int handled = LegacyMatch(kLegacyBaseProps, record.key)) {
+        return handled;
+    }
+    if (record.has_callback) {
+        if (int handled = LegacyMatch(kLegacyGestureEvents, record.key)) {
+            return 100 + handled;
+        }
+    } else if (strcmp(record.key.c_str(), "capture") == 0) {
+        return 100;
+    }
+    if (record.kind == ViewKind::kImage) {
+        return 200 + LegacyMatch(kLegacyImageProps, record.key);
+    }
+    return 300 + LegacyMatch(kLegacyViewProps, record.key);
+}
+
+int BaseProps(KRPropKey id) {
+    switch (id) {
+        case KRPropKey::kBackgroundColor:
+        case KRPropKey::kBorderRadius:
+        case KRPropKey::kBorder:
+        case KRPropKey::kFrame:
+        case KRPropKey::kBackgroundImage:
+        case KRPropKey::kTransform:
+        case KRPropKey::kOpacity:
+        case KRPropKey::kVisibility:
+        case KRPropKey::kOverflow:
+        case KRPropKey::kZIndex:
+        case KRPropKey::kTouchEnable:
+        case KRPropKey::kAccessibility:
+        case KRPropKey::kBoxShadow:
+        case KRPropKey::kAnimation:
+        case KRPropKey::kAnimationCompletion:
+        case KRPropKey::kClipPath:
+            return static_cast<int>(static_cast<uint32_t>(id) & 0xFF) + 1;
+        default:
+            return 0;
+    }
+}
+
+int BaseEvents(KRPropKey id, bool has_callback) {
+    switch (id) {
+        case KRPropKey::kClick:
+        case KRPropKey::kDoubleClick:
+        case KRPropKey::kLongPress:
+        case KRPropKey::kPan:
+        case KRPropKey::kPinch:
+            return has_callback ? 100 + static_cast<int>(static_cast<uint32_t>(id) & 0xFF) : 0;
+        case KRPropKey::kCapture:
+            return has_callback ? 0 : 100;
+        default:
+            return 0;
+    }
+}
+
+int ComponentProps(ViewKind kind, KRPropKey id) {
+    if (kind == ViewKind::kImage) {
+        switch (id) {
+            case KRPropKey::kSrc:
+            case KRPropKey::kCapInsets:
+            case KRPropKey::kResize:
+            case KRPropKey::kBlurRadius:
+            case KRPropKey::kTintColor:
+            case KRPropKey::kDotNineImage:
+            case KRPropKey::kMaskLinearGradient:
+            case KRPropKey::kLoadSuccess:
+            case KRPropKey::kLoadResolution:
+            case KRPropKey::kLoadFailure:
+            case KRPropKey::kDragEnable:
+                return 200 + static_cast<int>(static_cast<uint32_t>(id) & 0xFF);
+            default:
+                return 200;
+        }
+    }
+    switch (id) {
+        case KRPropKey::kTouchDown:
+        case KRPropKey::kTouchMove:
+        case KRPropKey::kTouchUp:
+        case KRPropKey::kPreventTouch:
+        case KRPropKey::kSuperTouch:
+        case KRPropKey::kHitTestModeOhos:
+            return 300 + static_cast<int>(static_cast<uint32_t>(id) & 0xFF);
+        default:
+            return 300;
+    }
+}
+
+int InternedDispatch(const PropRecord &record, KRPropKey bridge_id) {
+    KRPropKey id = KRResolvePropKey(bridge_id, record.key);
+    if (int handled = BaseProps(id)) {
+        return handled;
+    }
+    if (int handled = BaseEvents(id, record.has_callback)) {
+        return handled;
+    }
+    return ComponentProps(record.kind, id);
+}
+
+template <typename F> double Replay(const std::vector<PropRecord> &stream, F &&dispatch) {
+    int sum = 0;
+    auto ns = kuikly::bench::MeasureNsPerOp(stream.size(), kRounds, [&] {
+        for (const auto &record : stream) {
+            sum += dispatch(record);
+        }
+    });
+    kuikly::bench::DoNotOptimize(sum);
+    return ns;
+}
+
+}  // namespace
+
+int main() {
+    auto stream = RecordedStream();
+    kuikly::bench::Report("legacy   strcmp chain", Replay(stream, [](const PropRecord &r) { return LegacyDispatch(r); }));
+    kuikly::bench::Report("interned resolve per call",
+                          Replay(stream, [](const PropRecord &r) { return InternedDispatch(r, KRPropKey::kUnresolved); }));
+    kuikly::bench::Report("interned id from bridge",
+                          Replay(stream, [](const PropRecord &r) { return InternedDispatch(r, r.bridge_id); }));
+    return 0;
+}
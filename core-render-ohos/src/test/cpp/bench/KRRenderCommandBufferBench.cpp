@@ -0,0 +1,257 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * 逐条 com_tencent_kuikly_CallNative 与批量 com_tencent_kuikly_CallNativeBatch 的下发开销对比。
+ * KRRenderValue 依赖 NAPI 头文件无法在主机编译，这里用同构的 variant 盒子模拟逐条调用的参数装箱：
+ *   single : 每条调用构造 instanceId 字符串、5 个堆上参数对象和一个任务闭包，主线程逐个执行
+ *   batch  : 每帧编码一次缓冲区，拷贝一次并投递一个闭包，主线程顺序解码并复用属性值对象
+ */
+#include <functional>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "KRRenderCommandTestWriter.h"
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+
+namespace {
+
+constexpr int kViewsPerFrame = 200;
+constexpr int kPropsPerView = 4;
+constexpr int kCommandsPerFrame = kViewsPerFrame * (2 + kPropsPerView);
+constexpr int kRounds = 20;
+
+const char *const kPropKeys[kPropsPerView] = {"backgroundColor", "borderRadius", "opacity", "text"};
+
+struct BoxedValue {
+    using Storage = std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string>;
+
+    BoxedValue() = default;
+    explicit BoxedValue(const KRRenderCValue &value) {
+        switch (value.type) {
+        case KRRenderCValue::Type::INT:
+            storage = value.value.intValue;
+            break;
+        case KRRenderCValue::Type::DOUBLE:
+            storage = value.value.doubleValue;
+            break;
+        case KRRenderCValue::Type::FLOAT:
+            storage = value.value.floatValue;
+            break;
+        case KRRenderCValue::Type::STRING:
+            storage = std::string(value.value.stringValue);
+            break;
+        default:
+            break;
+        }
+    }
+
+    Storage storage;
+};
+
+using BoxedPtr = std::shared_ptr<BoxedValue>;
+
+struct Sink {
+    int64_t checksum = 0;
+
+    void Consume(int32_t tag, const std::string &key, const BoxedPtr &value) {
+        checksum += tag + static_cast<int64_t>(key.size()) + static_cast<int64_t>(value->storage.index());
+    }
+};
+
+KRRenderCValue MakeInt(int32_t value) {
+    KRRenderCValue result{};
+    result.type = KRRenderCValue::Type::INT;
+    result.value.intValue = value;
+    return result;
+}
+
+KRRenderCValue MakeFloat(float value) {
+    KRRenderCValue result{};
+    result.type = KRRenderCValue::Type::FLOAT;
+    result.value.floatValue = value;
+    return result;
+}
+
+KRRenderCValue MakeString(const char *value) {
+    KRRenderCValue result{};
+    result.type = KRRenderCValue::Type::STRING;
+    result.value.stringValue = const_cast<char *>(value);
+    return result;
+}
+
+KRRenderCValue MakeNull() {
+    KRRenderCValue result{};
+    result.type = KRRenderCValue::Type::NULL_VALUE;
+    return result;
+}
+
+/** 模拟 DispatchCallNative -> KRRenderCore::OnCallNative 的逐条路径 */
+void CallNative(std::vector<std::function<void()>> &main_queue, Sink &sink, const KRRenderCValue &arg0,
+                const KRRenderCValue &arg1, const KRRenderCValue &arg2, const KRRenderCValue &arg3,
+                const KRRenderCValue &arg4, const KRRenderCValue &arg5) {
+    std::string instance_id(arg0.value.stringValue);
+    kuikly::bench::DoNotOptimize(instance_id);
+    auto a1 = std::make_shared<BoxedValue>(arg1);
+    auto a2 = std::make_shared<BoxedValue>(arg2);
+    auto a3 = std::make_shared<BoxedValue>(arg3);
+    auto a4 = std::make_shared<BoxedValue>(arg4);
+    auto a5 = std::make_shared<BoxedValue>(arg5);
+    main_queue.emplace_back([&sink, a1, a2, a3, a4, a5] {
+        static const std::string kKey = "key";
+        sink.Consume(std::get_if<int32_t>(&a1->storage) ? 1 : 0, kKey, a3);
+    });
+}
+
+double RunSingle(Sink &sink) {
+    std::vector<std::function<void()>> main_queue;
+    main_queue.reserve(kCommandsPerFrame);
+    auto pager = MakeString("pager_1");
+    auto null_value = MakeNull();
+    return kuikly::bench::MeasureNsPerOp(kCommandsPerFrame, kRounds, [&] {
+        main_queue.clear();
+        for (int view = 0; view < kViewsPerFrame; view++) {
+            CallNative(main_queue, sink, pager, MakeInt(view), MakeString("KRView"), null_value, null_value,
+                       null_value);
+            for (int prop = 0; prop < kPropsPerView; prop++) {
+                auto value = prop == 3 ? MakeString("hello world") : MakeInt(prop);
+                CallNative(main_queue, sink, pager, MakeInt(view), MakeString(kPropKeys[prop]), value, MakeInt(0),
+                           MakeInt(0));
+            }
+            CallNative(main_queue, sink, pager, MakeInt(view), MakeFloat(0), MakeFloat(0), MakeFloat(100),
+                       MakeFloat(40));
+        }
+        for (auto &task : main_queue) {
+            task();
+        }
+    });
+}
+
+/** 模拟 KRRenderCore::PerformNativeCommandBuffer 的解码路径，属性值对象未被持有时复用 */
+class BatchDecoder {
+ public:
+    explicit BatchDecoder(Sink &sink) : sink_(sink) {}
+
+    void Perform(const uint8_t *data, size_t length) {
+        KRRenderCommandReader reader(data, length);
+        KRRenderCommandOpcode opcode;
+        KRRenderCommandReader payload;
+        while (reader.NextCommand(opcode, payload)) {
+            switch (opcode) {
+            case KRRenderCommandOpcode::kCreateRenderView: {
+                auto tag = payload.ReadInt32();
+                auto name = payload.ReadString();
+                view_name_.assign(name.data(), name.size());
+                sink_.Consume(tag, view_name_, Reuse(std::monostate()));
+                break;
+            }
+            case KRRenderCommandOpcode::kSetViewProp: {
+                auto tag = payload.ReadInt32();
+                auto prop_id = payload.ReadUInt16();
+                auto type = static_cast<KRRenderCValue::Type>(payload.ReadUInt8());
+                if (type == KRRenderCValue::Type::STRING) {
+                    auto str = payload.ReadString();
+                    auto &value = Reuse(std::monostate());
+                    value->storage.emplace<std::string>(str.data(), str.size());
+                    sink_.Consume(tag, prop_keys_[prop_id], value);
+                } else {
+                    sink_.Consume(tag, prop_keys_[prop_id], Reuse(payload.ReadInt32()));
+                }
+                break;
+            }
+            case KRRenderCommandOpcode::kSetRenderViewFrame: {
+                auto tag = payload.ReadInt32();
+                float rect[4] = {payload.ReadFloat(), payload.ReadFloat(), payload.ReadFloat(), payload.ReadFloat()};
+                auto &value = Reuse(std::monostate());
+                value->storage.emplace<std::string>(reinterpret_cast<const char *>(rect), sizeof(rect));
+                sink_.Consume(tag, frame_key_, value);
+                break;
+            }
+            case KRRenderCommandOpcode::kDefinePropKey: {
+                auto prop_id = payload.ReadUInt16();
+                auto key = payload.ReadString();
+                if (prop_id >= prop_keys_.size()) {
+                    prop_keys_.resize(prop_id + 1);
+                }
+                prop_keys_[prop_id].assign(key.data(), key.size());
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+ private:
+    template <typename T> const BoxedPtr &Reuse(T value) {
+        if (!value_ || value_.use_count() != 1) {
+            value_ = std::make_shared<BoxedValue>();
+        }
+        value_->storage = value;
+        return value_;
+    }
+
+    Sink &sink_;
+    BoxedPtr value_;
+    std::string view_name_;
+    std::string frame_key_ = "frame";
+    std::vector<std::string> prop_keys_;
+};
+
+double RunBatch(Sink &sink) {
+    KRRenderCommandTestWriter writer;
+    BatchDecoder decoder(sink);
+    std::vector<std::function<void()>> main_queue;
+    bool keys_defined = false;
+    return kuikly::bench::MeasureNsPerOp(kCommandsPerFrame, kRounds, [&] {
+        writer.Clear();
+        if (!keys_defined) {
+            for (uint16_t prop = 0; prop < kPropsPerView; prop++) {
+                writer.DefinePropKey(prop, kPropKeys[prop]);
+            }
+            keys_defined = true;
+        }
+        for (int view = 0; view < kViewsPerFrame; view++) {
+            writer.CreateRenderView(view, "KRView");
+            for (uint16_t prop = 0; prop < kPropsPerView; prop++) {
+                if (prop == 3) {
+                    writer.SetViewProp(view, prop, std::string_view("hello world"));
+                } else {
+                    writer.SetViewProp(view, prop, static_cast<int32_t>(prop));
+                }
+            }
+            writer.SetRenderViewFrame(view, 0, 0, 100, 40);
+        }
+        auto &bytes = writer.Bytes();
+        auto buffer = std::make_shared<std::vector<uint8_t>>(bytes.begin(), bytes.end());
+        main_queue.clear();
+        main_queue.emplace_back([&decoder, buffer] { decoder.Perform(buffer->data(), buffer->size()); });
+        for (auto &task : main_queue) {
+            task();
+        }
+    });
+}
+
+}  // namespace
+
+int main() {
+    Sink sink;
+    kuikly::bench::Report("CallNative single (per command)", RunSingle(sink));
+    kuikly::bench::Report("CallNativeBatch encode+decode (per command)", RunBatch(sink));
+    kuikly::bench::DoNotOptimize(sink.checksum);
+    return 0;
+}
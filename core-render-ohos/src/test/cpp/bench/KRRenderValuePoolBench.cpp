@@ -0,0 +1,124 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * callNative 参数装箱的内存与分配次数对比，模拟属性密集页面一帧内的桥接调用（每次调用 5 个参数位，
+ * 其中 tag、属性名、属性值 3 个非空）。KRRenderValue 依赖 NAPI 头文件无法在主机编译，这里用同构布局模拟：
+ *   legacy : variant 内联 unordered_map 并继承 enable_shared_from_this，make_shared 逐个分配
+ *   compact: Map 放到堆上，其余与 KRRenderValue 一致，经 KRPoolAllocator 从内存块池分配
+ * 统计方式为替换全局 operator new，计数包含控制块
+ */
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/utils/KRFixedBlockPool.h"
+
+namespace {
+
+std::atomic<size_t> gAllocCount{0};
+std::atomic<size_t> gAllocBytes{0};
+
+}  // namespace
+
+void *operator new(size_t size) {
+    gAllocCount.fetch_add(1, std::memory_order_relaxed);
+    gAllocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr int kCallsPerFrame = 200 * 6;
+constexpr int kArgsPerCall = 3;
+constexpr int kRounds = 20;
+
+struct NapiLike {
+    void *env;
+    void *value;
+};
+
+struct LegacyValue : std::enable_shared_from_this<LegacyValue> {
+    using Map = std::unordered_map<std::string, std::shared_ptr<LegacyValue>>;
+    using Array = std::vector<std::shared_ptr<LegacyValue>>;
+    template <typename T> explicit LegacyValue(T v) : value(std::move(v)) {}
+    std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, Map, Array, void *,
+                 std::shared_ptr<std::vector<uint8_t>>, NapiLike>
+        value;
+    std::unique_ptr<int> cache;
+};
+
+struct CompactValue {
+    using Map = std::unordered_map<std::string, std::shared_ptr<CompactValue>>;
+    using Array = std::vector<std::shared_ptr<CompactValue>>;
+    template <typename T> explicit CompactValue(T v) : value(std::move(v)) {}
+    std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, std::unique_ptr<Map>, Array,
+                 std::shared_ptr<std::vector<uint8_t>>, NapiLike>
+        value;
+    std::unique_ptr<int> cache;
+};
+
+template <typename Value, typename MakeFn> void RunFrame(std::vector<std::shared_ptr<Value>> &args, MakeFn &&make) {
+    for (int i = 0; i < kCallsPerFrame; i++) {
+        args.push_back(make(int32_t(i)));
+        args.push_back(make(std::string("backgroundColor")));
+        args.push_back(make(double(i) * 0.5));
+    }
+    kuikly::bench::DoNotOptimize(args.data());
+    args.clear();  // 一帧结束，参数全部释放
+}
+
+template <typename Value, typename MakeFn> void Measure(const char *name, MakeFn &&make) {
+    std::vector<std::shared_ptr<Value>> args;
+    args.reserve(kCallsPerFrame * kArgsPerCall);
+    RunFrame<Value>(args, make);  // 预热，池中留下上一帧释放的内存块
+
+    auto count_before = gAllocCount.load();
+    auto bytes_before = gAllocBytes.load();
+    RunFrame<Value>(args, make);
+    double allocs = gAllocCount.load() - count_before;
+    double bytes = gAllocBytes.load() - bytes_before;
+
+    auto ns = kuikly::bench::MeasureNsPerOp(kCallsPerFrame, kRounds, [&] { RunFrame<Value>(args, make); });
+    printf("%-24s sizeof %3zu  %12.1f ns/call  %6.2f allocs/call  %8.1f heap bytes/call\n", name, sizeof(Value), ns,
+           allocs / kCallsPerFrame, bytes / kCallsPerFrame);
+}
+
+}  // namespace
+
+int main() {
+    Measure<LegacyValue>("legacy make_shared", [](auto v) { return std::make_shared<LegacyValue>(std::move(v)); });
+    Measure<CompactValue>("compact make_shared", [](auto v) { return std::make_shared<CompactValue>(std::move(v)); });
+    Measure<CompactValue>("compact pooled", [](auto v) {
+        return std::allocate_shared<CompactValue>(KRPoolAllocator<CompactValue>(), std::move(v));
+    });
+    return 0;
+}
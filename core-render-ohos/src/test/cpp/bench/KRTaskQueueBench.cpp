@@ -0,0 +1,136 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Context 任务队列的入队与批量取出吞吐对比：
+ *   legacy : 旧 KRThread 的 mutex + std::queue<std::function>，消费者加锁交换出整个队列
+ *   lockfree: KRTaskQueue，CAS 入队、节点从 KRFixedBlockPool 复用，消费者一次交换取出 FIFO 批次
+ * 任务闭包捕获 24 字节，std::function 与 KRTask 都能内联存放
+ */
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
+
+namespace {
+
+constexpr int kTasksPerRound = 2000;  // 约为一次刷新内的 UI 操作数，节点可全部由内存块池复用
+constexpr int kRounds = 200;
+
+class LegacyQueue {
+ public:
+    void Push(const std::function<void()> &task) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.emplace(task);
+    }
+
+    /** 交换出全部任务并执行，返回执行数 */
+    size_t Drain() {
+        std::queue<std::function<void()>> tasks;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            std::swap(tasks, tasks_);
+        }
+        size_t count = tasks.size();
+        while (!tasks.empty()) {
+            tasks.front()();
+            tasks.pop();
+        }
+        return count;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::queue<std::function<void()>> tasks_;
+};
+
+class LockFreeQueue {
+ public:
+    void Push(KRTask task) {
+        queue_.Push(std::move(task));
+    }
+
+    size_t Drain() {
+        auto batch = queue_.TakeAll();
+        size_t count = 0;
+        while (!batch.Empty()) {
+            batch.RunFront();
+            count++;
+        }
+        return count;
+    }
+
+ private:
+    KRTaskQueue queue_;
+};
+
+/** 单线程先入队一整帧任务再全部取出执行，对应一次刷新内的 UI 操作 */
+template <typename Queue> double EnqueueThenDrain() {
+    Queue queue;
+    uint64_t sum = 0;
+    auto ns = kuikly::bench::MeasureNsPerOp(kTasksPerRound, kRounds, [&] {
+        for (int i = 0; i < kTasksPerRound; i++) {
+            uint64_t a = i, b = i * 2;
+            queue.Push([&sum, a, b] { sum += a + b; });
+        }
+        queue.Drain();
+    });
+    kuikly::bench::DoNotOptimize(sum);
+    return ns;
+}
+
+/** producers 个线程并发入队，消费者线程同时批量取出执行 */
+template <typename Queue> double ConcurrentProducers(int producers) {
+    const int per_producer = kTasksPerRound / producers;
+    return kuikly::bench::MeasureNsPerOp(per_producer * producers, kRounds, [&] {
+        Queue queue;
+        std::atomic<uint64_t> sum{0};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&queue, &sum, per_producer] {
+                for (int i = 0; i < per_producer; i++) {
+                    uint64_t a = i, b = i * 2;
+                    queue.Push([&sum, a, b] { sum.fetch_add(a + b, std::memory_order_relaxed); });
+                }
+            });
+        }
+        size_t drained = 0;
+        while (drained < static_cast<size_t>(per_producer * producers)) {
+            drained += queue.Drain();
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    });
+}
+
+}  // namespace
+
+int main() {
+    kuikly::bench::Report("legacy   enqueue+drain, 1 thread", EnqueueThenDrain<LegacyQueue>());
+    kuikly::bench::Report("lockfree enqueue+drain, 1 thread", EnqueueThenDrain<LockFreeQueue>());
+    for (int producers : {1, 4}) {
+        char name[64];
+        snprintf(name, sizeof(name), "legacy   %d producer(s) + consumer", producers);
+        kuikly::bench::Report(name, ConcurrentProducers<LegacyQueue>(producers));
+        snprintf(name, sizeof(name), "lockfree %d producer(s) + consumer", producers);
+        kuikly::bench::Report(name, ConcurrentProducers<LockFreeQueue>(producers));
+    }
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * 主线程同步执行 Context 任务（DirectRunOnCurThread）的交接延迟：工作线程被生产者持续灌入约 2us 的任务，
+ * 主线程每 200us 发起一次同步请求，统计从发起到拿到执行权的耗时分布。
+ *   legacy spin: 复刻旧 KRThread 的标志锁协议，工作线程整批执行期间持有标志，主线程忙等最长 100ms 后退化为异步
+ *   token      : KRExecutionToken，主线程阻塞等待，工作线程在任务间隙让出
+ */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/foundation/thread/KRExecutionToken.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kSyncCalls = 2000;
+constexpr size_t kQueueDepth = 256;
+constexpr auto kTaskCost = std::chrono::microseconds(2);
+constexpr auto kCallInterval = std::chrono::microseconds(200);
+constexpr auto kLegacyTimeout = std::chrono::milliseconds(100);
+
+void BusyWork() {
+    auto end = Clock::now() + kTaskCost;
+    while (Clock::now() < end) {
+    }
+}
+
+/** 生产者与工作线程共用的任务队列 */
+class TaskSource {
+ public:
+    void Push(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+    size_t Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.size();
+    }
+
+    /** 等待并取走全部任务，stop 后返回空 */
+    std::deque<std::function<void()>> TakeAll() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+        std::deque<std::function<void()>> tasks;
+        tasks.swap(tasks_);
+        return tasks;
+    }
+
+    /** 把未执行的任务放回队首 */
+    void PushFront(std::deque<std::function<void()>> &&tasks) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.insert(tasks_.begin(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+};
+
+/** 旧 KRThread::TaskMutex 的标志锁 */
+class LegacyFlag {
+ public:
+    bool TryLock() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (locked_) {
+            return false;
+        }
+        locked_ = true;
+        return true;
+    }
+
+    void Unlock() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        locked_ = false;
+    }
+
+ private:
+    std::mutex mutex_;
+    bool locked_ = false;
+};
+
+struct HandoffResult {
+    std::vector<int64_t> samples;
+    int fallback_count = 0;  // 同步请求退化为异步的次数
+};
+
+/**
+ * 启动生产者与工作线程，在主线程发起 kSyncCalls 次同步请求
+ * @param worker_loop 工作线程主循环，source 停止后返回
+ * @param sync_call 同步请求，返回拿到执行权的耗时（纳秒），退化为异步返回 -1
+ */
+template <typename WorkerLoop, typename SyncCall>
+HandoffResult RunHandoff(TaskSource &source, WorkerLoop &&worker_loop, SyncCall &&sync_call) {
+    std::atomic<bool> stop{false};
+    std::thread worker(worker_loop);
+    std::thread producer([&] {
+        while (!stop.load()) {
+            if (source.Size() < kQueueDepth) {
+                for (int i = 0; i < 32; i++) {
+                    source.Push(BusyWork);
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    HandoffResult result;
+    result.samples.reserve(kSyncCalls);
+    for (int i = 0; i < kSyncCalls; i++) {
+        std::this_thread::sleep_for(kCallInterval);
+        int64_t ns = sync_call();
+        if (ns < 0) {
+            result.fallback_count++;
+        } else {
+            result.samples.push_back(ns);
+        }
+    }
+    stop = true;
+    producer.join();
+    source.Stop();
+    worker.join();
+    return result;
+}
+
+int64_t ElapsedNs(Clock::time_point begin) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+}
+
+HandoffResult RunLegacySpin() {
+    TaskSource source;
+    LegacyFlag flag;
+    auto worker_loop = [&] {
+        while (true) {
+            auto tasks = source.TakeAll();
+            if (tasks.empty()) {
+                return;
+            }
+            if (flag.TryLock()) {
+                for (auto &task : tasks) {
+                    task();
+                }
+                flag.Unlock();
+            } else {
+                source.PushFront(std::move(tasks));
+            }
+        }
+    };
+    auto sync_call = [&]() -> int64_t {
+        auto begin = Clock::now();
+        while (Clock::now() - begin <= kLegacyTimeout) {
+            if (flag.TryLock()) {
+                int64_t ns = ElapsedNs(begin);
+                flag.Unlock();
+                return ns;
+            }
+        }
+        return -1;
+    };
+    return RunHandoff(source, worker_loop, sync_call);
+}
+
+HandoffResult RunToken() {
+    TaskSource source;
+    KRExecutionToken token;
+    auto worker_loop = [&] {
+        while (true) {
+            auto tasks = source.TakeAll();
+            if (tasks.empty()) {
+                return;
+            }
+            token.AcquireForWorker();
+            while (!tasks.empty() && !token.HasWaiter()) {
+                tasks.front()();
+                tasks.pop_front();
+            }
+            token.Release();
+            if (!tasks.empty()) {
+                source.PushFront(std::move(tasks));
+            }
+        }
+    };
+    auto sync_call = [&]() -> int64_t {
+        auto begin = Clock::now();
+        if (!token.AcquireForCaller()) {
+            return -1;
+        }
+        int64_t ns = ElapsedNs(begin);
+        token.Release();
+        return ns;
+    };
+    return RunHandoff(source, worker_loop, sync_call);
+}
+
+void Report(const char *name, const HandoffResult &result) {
+    kuikly::bench::ReportLatency(name, kuikly::bench::ComputePercentiles(result.samples));
+    printf("%-48s %d/%d sync calls fell back to async\n", "", result.fallback_count, kSyncCalls);
+}
+
+}  // namespace
+
+int main() {
+    Report("legacy spin handoff", RunLegacySpin());
+    Report("execution token handoff", RunToken());
+    return 0;
+}
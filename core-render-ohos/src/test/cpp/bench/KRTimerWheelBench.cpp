@@ -0,0 +1,191 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * 10 万个定时器的添加、取消与触发延迟对比：
+ *   legacy heap: 复刻旧 KRDelayThread，mutex 保护的 std::priority_queue，每次添加都唤醒线程，不支持取消
+ *   timer wheel: KRTimerWheel，分层时间轮，O(1) 添加与取消
+ * 触发延迟为实际触发时刻减去应触发时刻
+ */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kTimerCount = 100000;
+
+class LegacyDelayThread {
+ public:
+    LegacyDelayThread() {
+        thread_ = std::thread([this] { Dispatcher(); });
+    }
+
+    ~LegacyDelayThread() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stop_ = true;
+            condition_.notify_one();
+        }
+        thread_.join();
+    }
+
+    void DispatchAsync(const std::function<void()> &task, int delayMilliseconds) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.emplace(Task{Clock::now() + std::chrono::milliseconds(delayMilliseconds), task});
+        condition_.notify_one();
+    }
+
+ private:
+    struct Task {
+        Clock::time_point exec_time;
+        std::function<void()> func;
+        bool operator<(const Task &other) const {
+            return exec_time > other.exec_time;
+        }
+    };
+
+    void Dispatcher() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (!stop_ && (tasks_.empty() || Clock::now() < tasks_.top().exec_time)) {
+                    if (tasks_.empty()) {
+                        condition_.wait(lock);
+                    } else {
+                        auto time = tasks_.top().exec_time;
+                        condition_.wait_until(lock, time);
+                    }
+                }
+                if (stop_) {
+                    break;
+                }
+                task = std::move(const_cast<Task &>(tasks_.top()));
+                tasks_.pop();
+            }
+            task.func();
+        }
+    }
+
+    std::priority_queue<Task> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+std::vector<int> RandomDelays(int max_delay_ms) {
+    std::mt19937 rng(14);
+    std::vector<int> delays(kTimerCount);
+    for (auto &delay : delays) {
+        delay = 1 + static_cast<int>(rng() % max_delay_ms);
+    }
+    return delays;
+}
+
+double NsPerOp(Clock::time_point begin) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / kTimerCount;
+}
+
+/** 收集触发延迟，全部触发后唤醒等待方 */
+class LatenessLog {
+ public:
+    LatenessLog() {
+        samples_.reserve(kTimerCount);
+    }
+
+    void Record(Clock::time_point due) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - due).count());
+        if (samples_.size() == kTimerCount) {
+            condition_.notify_all();
+        }
+    }
+
+    std::vector<int64_t> Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return samples_.size() == kTimerCount; });
+        return samples_;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<int64_t> samples_;
+};
+
+void BenchInsertAndCancel() {
+    // 远期定时器（最长 10 分钟）在测量期间不会触发
+    auto delays = RandomDelays(600000);
+    {
+        LegacyDelayThread heap;
+        auto begin = Clock::now();
+        for (int delay : delays) {
+            heap.DispatchAsync([] {}, delay);
+        }
+        kuikly::bench::Report("legacy heap insert 100k", NsPerOp(begin));
+    }
+    std::vector<KRTimerId> ids;
+    ids.reserve(kTimerCount);
+    auto begin = Clock::now();
+    for (int delay : delays) {
+        ids.push_back(KRTimerWheel::GetInstance().Schedule(delay, [] {}));
+    }
+    kuikly::bench::Report("timer wheel insert 100k", NsPerOp(begin));
+    begin = Clock::now();
+    for (auto id : ids) {
+        KRTimerWheel::GetInstance().Cancel(id);
+    }
+    kuikly::bench::Report("timer wheel cancel 100k", NsPerOp(begin));
+}
+
+void BenchFireLateness() {
+    auto delays = RandomDelays(500);
+    {
+        LatenessLog log;
+        LegacyDelayThread heap;
+        for (int delay : delays) {
+            auto due = Clock::now() + std::chrono::milliseconds(delay);
+            heap.DispatchAsync([&log, due] { log.Record(due); }, delay);
+        }
+        kuikly::bench::ReportLatency("legacy heap fire lateness",
+                                     kuikly::bench::ComputePercentiles(log.Wait()));
+    }
+    LatenessLog log;
+    for (int delay : delays) {
+        auto due = Clock::now() + std::chrono::milliseconds(delay);
+        KRTimerWheel::GetInstance().Schedule(delay, [&log, due] { log.Record(due); });
+    }
+    kuikly::bench::ReportLatency("timer wheel fire lateness", kuikly::bench::ComputePercentiles(log.Wait()));
+}
+
+}  // namespace
+
+int main() {
+    BenchInsertAndCancel();
+    BenchFireLateness();
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * transform 属性解析与矩阵生成耗时对比：
+ *   legacy : 旧 KRTransformParser，ConvertSplit 切分出临时字符串、std::stof 解析，矩阵由三次 4x4 矩阵相乘得到
+ *   current: KRTransformParser，在原字符串上切分并用 strtof 解析、最近解析结果走缓存，矩阵按 2D 仿射闭式展开
+ * 动画帧间 transform 字符串多为重复值（命中缓存），逐帧变化的角度等则每次都是新字符串（未命中缓存）
+ */
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "KRBenchUtil.h"
+#include "libohos_render/utils/KRTransformParser.h"
+
+namespace {
+
+constexpr int kOpsPerRound = 2000;
+constexpr int kRounds = 50;
+
+using Matrix = std::array<double, 16>;
+
+/** 旧实现的等价拷贝，仅用于对比 */
+class LegacyTransformParser {
+ public:
+    double anchor_x_ = 0.5;
+    double anchor_y_ = 0.5;
+    double translation_x_ = 0;
+    double translation_y_ = 0;
+    double rotate_angle_ = 0;
+    double rotate_x_angle_ = 0;
+    double rotate_y_angle_ = 0;
+    double scale_x_ = 1;
+    double scale_y_ = 1;
+    double skew_x_ = 0;
+    double skew_y_ = 0;
+
+    bool ParseFromCssTransform(const std::string &css_transform) {
+        auto splits = ConvertSplit(css_transform, "|");
+        if (splits.size() < 5) {
+            return false;
+        }
+        rotate_angle_ = ConvertToFloat(splits[0]);
+        auto scales = ConvertSplit(splits[1], " ");
+        if (scales.size() < 2) return false;
+        scale_x_ = ConvertToFloat(scales[0]);
+        scale_y_ = ConvertToFloat(scales[1]);
+        auto translates = ConvertSplit(splits[2], " ");
+        if (translates.size() < 2) return false;
+        translation_x_ = ConvertToFloat(translates[0]);
+        translation_y_ = ConvertToFloat(translates[1]);
+        auto anchors = ConvertSplit(splits[3], " ");
+        if (anchors.size() < 2) return false;
+        anchor_x_ = ConvertToFloat(anchors[0]);
+        anchor_y_ = ConvertToFloat(anchors[1]);
+        auto skews = ConvertSplit(splits[4], " ");
+        if (skews.size() < 2) return false;
+        skew_x_ = ConvertToFloat(skews[0]);
+        skew_y_ = ConvertToFloat(skews[1]);
+        if (splits.size() > 5) {
+            auto rotateXY = ConvertSplit(splits[5], " ");
+            if (rotateXY.size() >= 2) {
+                rotate_x_angle_ = ConvertToFloat(rotateXY[0]);
+                rotate_y_angle_ = ConvertToFloat(rotateXY[1]);
+            }
+        } else {
+            rotate_x_angle_ = 0.0;
+            rotate_y_angle_ = 0.0;
+        }
+        return true;
+    }
+
+    Matrix GetMatrixWithNoRotate() const {
+        Matrix scale_matrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+        Matrix rotation_matrix = scale_matrix;
+        Matrix skew_matrix = scale_matrix;
+        scale_matrix[12] = translation_x_;
+        scale_matrix[13] = translation_y_;
+        scale_matrix[0] *= scale_x_;
+        scale_matrix[5] *= scale_y_;
+        double radian = 0 * M_PI / 180.0;
+        rotation_matrix[0] = cos(radian);
+        rotation_matrix[1] = sin(radian);
+        rotation_matrix[4] = -sin(radian);
+        rotation_matrix[5] = cos(radian);
+        skew_matrix[4] = tan(-skew_x_ * M_PI / 180.0);
+        skew_matrix[1] = tan(-skew_y_ * M_PI / 180.0);
+        return MultiplyMatrices(MultiplyMatrices(scale_matrix, rotation_matrix), skew_matrix);
+    }
+
+ private:
+    static float ConvertToFloat(const std::string &string) {
+        if (string.length() == 1 && string == "0") {
+            return 0;
+        }
+        try {
+            return std::stof(string);
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    static std::vector<std::string> ConvertSplit(const std::string &str, const std::string &delimiters) {
+        std::vector<std::string> result;
+        std::size_t start = 0;
+        std::size_t end = str.find_first_of(delimiters);
+        while (end != std::string::npos) {
+            result.push_back(str.substr(start, end - start));
+            start = end + 1;
+            end = str.find_first_of(delimiters, start);
+        }
+        result.push_back(str.substr(start));
+        return result;
+    }
+
+    static Matrix MultiplyMatrices(const Matrix &lhs, const Matrix &rhs) {
+        Matrix result;
+        for (int row = 0; row < 4; row++) {
+            for (int col = 0; col < 4; col++) {
+                double sum = 0;
+                for (int k = 0; k < 4; k++) {
+                    sum += rhs[row * 4 + k] * lhs[k * 4 + col];
+                }
+                result[row * 4 + col] = sum;
+            }
+        }
+        return result;
+    }
+};
+
+/** 依次解析 inputs 中的字符串并生成矩阵 */
+template <typename Parser> double ParseAndBuildMatrix(const std::vector<std::string> &inputs) {
+    double sum = 0;
+    auto ns = kuikly::bench::MeasureNsPerOp(inputs.size(), kRounds, [&] {
+        for (const auto &css : inputs) {
+            Parser parser;
+            parser.ParseFromCssTransform(css);
+            sum += parser.GetMatrixWithNoRotate()[0];
+        }
+    });
+    kuikly::bench::DoNotOptimize(sum);
+    return ns;
+}
+
+}  // namespace
+
+int main() {
+    std::vector<std::string> repeated;
+    std::vector<std::string> unique;
+    char css[64];
+    for (int i = 0; i < kOpsPerRound; i++) {
+        repeated.push_back((i & 1) ? "13|1.21 0.81|0.11 0.21|0.5 0.5|3 4" : "12.5|1.2 0.8|0.1 0.2|0.5 0.5|3 4");
+        snprintf(css, sizeof(css), "%d.25|1.2 0.8|0.1 0.2|0.5 0.5|3 4", i);
+        unique.push_back(css);
+    }
+    kuikly::bench::Report("legacy  parse+matrix, repeated strings", ParseAndBuildMatrix<LegacyTransformParser>(repeated));
+    kuikly::bench::Report("current parse+matrix, repeated strings",
+                          ParseAndBuildMatrix<kuikly::util::KRTransformParser>(repeated));
+    kuikly::bench::Report("legacy  parse+matrix, unique strings", ParseAndBuildMatrix<LegacyTransformParser>(unique));
+    kuikly::bench::Report("current parse+matrix, unique strings",
+                          ParseAndBuildMatrix<kuikly::util::KRTransformParser>(unique));
+    return 0;
+}
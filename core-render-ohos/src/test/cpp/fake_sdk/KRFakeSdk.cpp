@@ -0,0 +1,50 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fake_sdk/KRFakeSdk.h"
+
+#include "deviceinfo.h"
+#include "libohos_render/foundation/thread/KRFrameClock.h"
+#include "native_drawing/drawing_path_effect.h"
+#include "native_drawing/drawing_shader_effect.h"
+
+KRFakeSdk &KRFakeSdk::GetInstance() {
+    static KRFakeSdk *instance = new KRFakeSdk();  // 进程级单例，不析构
+    return *instance;
+}
+
+int OH_GetSdkApiVersion(void) {
+    return KRFakeSdk::GetInstance().api_version;
+}
+
+void OH_Drawing_PathEffectDestroy(OH_Drawing_PathEffect *path_effect) {
+    KRFakeSdk::GetInstance().destroyed_path_effects.push_back(path_effect);
+}
+
+void OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *shader_effect) {
+    KRFakeSdk::GetInstance().destroyed_shader_effects.push_back(shader_effect);
+}
+
+/**
+ * 主机上没有系统 Vsync，单测需通过 KRFrameClock::SetFrameSource 注入手动驱动的信号源
+ */
+class KRFakeSystemFrameSource : public IKRFrameSource {
+ public:
+    void RequestFrame() override {}
+};
+
+std::shared_ptr<IKRFrameSource> IKRFrameSource::CreateSystemSource() {
+    return std::make_shared<KRFakeSystemFrameSource>();
+}
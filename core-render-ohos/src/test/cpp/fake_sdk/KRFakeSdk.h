@@ -0,0 +1,39 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFAKESDK_H
+#define CORE_RENDER_OHOS_KRFAKESDK_H
+
+#include <vector>
+
+struct OH_Drawing_PathEffect;
+struct OH_Drawing_ShaderEffect;
+
+/**
+ * 主机测试用的 SDK 替身状态：记录被释放的对象，可设置模拟的 API 版本
+ */
+struct KRFakeSdk {
+    int api_version = 20;
+    std::vector<OH_Drawing_PathEffect *> destroyed_path_effects;
+    std::vector<OH_Drawing_ShaderEffect *> destroyed_shader_effects;
+
+    static KRFakeSdk &GetInstance();
+
+    void Reset() {
+        *this = KRFakeSdk();
+    }
+};
+
+#endif  // CORE_RENDER_OHOS_KRFAKESDK_H
@@ -13,4 +13,16 @@
  * limitations under the License.
  */
 
-#include "libohos_render/foundation/thread/KRDelayThread.h"
+// 主机测试用的 OHOS SDK 替身，只声明被测源码用到的接口，实现见 KRFakeSdk.cpp
+#ifndef CORE_RENDER_OHOS_FAKE_SDK_DEVICEINFO_H
+#define CORE_RENDER_OHOS_FAKE_SDK_DEVICEINFO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int OH_GetSdkApiVersion(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CORE_RENDER_OHOS_FAKE_SDK_DEVICEINFO_H
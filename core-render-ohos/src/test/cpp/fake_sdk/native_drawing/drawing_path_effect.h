@@ -0,0 +1,29 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// 主机测试用的 OHOS SDK 替身，只声明被测源码用到的接口，实现见 KRFakeSdk.cpp
+#ifndef CORE_RENDER_OHOS_FAKE_SDK_DRAWING_PATH_EFFECT_H
+#define CORE_RENDER_OHOS_FAKE_SDK_DRAWING_PATH_EFFECT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef struct OH_Drawing_PathEffect OH_Drawing_PathEffect;
+void OH_Drawing_PathEffectDestroy(OH_Drawing_PathEffect *path_effect);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CORE_RENDER_OHOS_FAKE_SDK_DRAWING_PATH_EFFECT_H
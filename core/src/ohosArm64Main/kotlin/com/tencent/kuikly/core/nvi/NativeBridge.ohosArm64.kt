@@ -15,6 +15,8 @@
 
 package com.tencent.kuikly.core.nvi
 
+import kotlin.native.concurrent.ThreadLocal
+
 typealias CallNativeCallback = (
     methodId: Int,
     arg0: Any?,
@@ -25,10 +27,15 @@ typealias CallNativeCallback = (
     arg5: Any?
 ) -> Any?
 
+typealias CallNativeBatchCallback = (pagerId: String, buffer: ByteArray, length: Int) -> Unit
+
 actual open class NativeBridge actual constructor() {
 
     var callNativeCallback: CallNativeCallback? = null
+    /** 批量下发二进制指令，未设置时所有调用逐条下发 */
+    var callNativeBatchCallback: CallNativeBatchCallback? = null
     private var pagerId = ""
+    private var commandEncoder: NativeCommandEncoder? = null
 
     actual fun toNative(
         methodId: Int,
@@ -42,10 +49,76 @@ actual open class NativeBridge actual constructor() {
         if (pagerId.isEmpty()) {
             pagerId = arg0 as String
         }
+        if (NativeCommandBatch.isBatching() && callNativeBatchCallback != null) {
+            val encoder = commandEncoder ?: NativeCommandEncoder().also { commandEncoder = it }
+            val wasEmpty = encoder.isEmpty()
+            if (encoder.encode(methodId, arg1, arg2, arg3, arg4, arg5)) {
+                if (wasEmpty) {
+                    NativeCommandBatch.addPending(this)
+                }
+                return null
+            }
+        }
+        // 不可批量的调用需在已缓存的指令之后执行，先行下发以保证顺序
+        flushCommands()
         return callNativeCallback?.invoke(methodId, arg0, arg1, arg2, arg3, arg4, arg5)
     }
 
+    internal fun flushCommands() {
+        val encoder = commandEncoder ?: return
+        if (encoder.isEmpty()) {
+            return
+        }
+        callNativeBatchCallback?.invoke(pagerId, encoder.bytes, encoder.size)
+        encoder.reset()
+    }
+
     actual fun destroy() {
+        flushCommands()
+        commandEncoder = null
     }
 
+}
+
+/**
+ * Kotlin 侧一次调用（如 callKotlinMethod）内产生的 createRenderView/setViewProp 等调用合并为一次
+ * com_tencent_kuikly_CallNativeBatch 下发，作用域结束时统一 flush。
+ * 每个 context 线程独立计数，支持嵌套。
+ */
+@ThreadLocal
+object NativeCommandBatch {
+
+    private var depth = 0
+    private val pendingBridges = ArrayList<NativeBridge>()
+
+    fun isBatching(): Boolean = depth > 0
+
+    internal fun addPending(bridge: NativeBridge) {
+        pendingBridges.add(bridge)
+    }
+
+    inline fun <T> batch(block: () -> T): T {
+        begin()
+        try {
+            return block()
+        } finally {
+            end()
+        }
+    }
+
+    @PublishedApi
+    internal fun begin() {
+        depth++
+    }
+
+    @PublishedApi
+    internal fun end() {
+        if (--depth > 0) {
+            return
+        }
+        for (i in pendingBridges.indices) {
+            pendingBridges[i].flushCommands()
+        }
+        pendingBridges.clear()
+    }
 }
\ No newline at end of file
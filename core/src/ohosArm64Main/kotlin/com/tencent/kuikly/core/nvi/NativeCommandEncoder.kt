@@ -0,0 +1,216 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.nvi
+
+import com.tencent.kuikly.core.manager.NativeMethod
+
+/**
+ * 把可批量下发的 Native 调用编码为二进制指令，格式与 Native 侧 KRRenderCommandBuffer.h 保持一致：
+ *   | uint16 opcode | uint16 flags | uint32 payload_length | payload... |（小端序）
+ * 属性名首次出现时先写入一条 DEFINE_PROP_KEY 指令，后续只写 uint16 的 prop_id。
+ * 每个页面持有一个编码器，prop_id 在页面生命周期内有效。
+ */
+internal class NativeCommandEncoder {
+
+    private var buffer = ByteArray(INITIAL_CAPACITY)
+    private val propKeyIds = HashMap<String, Int>()
+
+    /** 当前已编码的字节数 */
+    var size = 0
+        private set
+
+    val bytes: ByteArray
+        get() = buffer
+
+    fun isEmpty(): Boolean = size == 0
+
+    fun reset() {
+        size = 0
+    }
+
+    /**
+     * 尝试编码一次 Native 调用
+     * @return 不支持批量下发时返回 false，调用方需走逐条调用
+     */
+    fun encode(methodId: Int, arg1: Any?, arg2: Any?, arg3: Any?, arg4: Any?, arg5: Any?): Boolean {
+        return when (methodId) {
+            NativeMethod.CREATE_RENDER_VIEW -> {
+                val tag = arg1 as? Int ?: return false
+                val viewName = (arg2 as? String ?: return false).encodeToByteArray()
+                beginCommand(methodId, 4 + 4 + viewName.size)
+                writeInt(tag)
+                writeBytes(viewName)
+                true
+            }
+            NativeMethod.REMOVE_RENDER_VIEW -> {
+                val tag = arg1 as? Int ?: return false
+                beginCommand(methodId, 4)
+                writeInt(tag)
+                true
+            }
+            NativeMethod.INSERT_SUB_RENDER_VIEW -> {
+                val parentTag = arg1 as? Int ?: return false
+                val childTag = arg2 as? Int ?: return false
+                val index = arg3 as? Int ?: return false
+                beginCommand(methodId, 12)
+                writeInt(parentTag)
+                writeInt(childTag)
+                writeInt(index)
+                true
+            }
+            NativeMethod.SET_VIEW_PROP -> encodeSetViewProp(arg1, arg2, arg3, arg4, arg5)
+            NativeMethod.SET_RENDER_VIEW_FRAME -> {
+                val tag = arg1 as? Int ?: return false
+                val x = arg2 as? Float ?: return false
+                val y = arg3 as? Float ?: return false
+                val width = arg4 as? Float ?: return false
+                val height = arg5 as? Float ?: return false
+                beginCommand(methodId, 20)
+                writeInt(tag)
+                writeInt(x.toRawBits())
+                writeInt(y.toRawBits())
+                writeInt(width.toRawBits())
+                writeInt(height.toRawBits())
+                true
+            }
+            else -> false
+        }
+    }
+
+    private fun encodeSetViewProp(arg1: Any?, arg2: Any?, arg3: Any?, arg4: Any?, arg5: Any?): Boolean {
+        // 事件注册与同步设置属性依赖逐条调用的语义，不参与批量
+        if (arg4 != 0 || (arg5 != null && arg5 != 0)) {
+            return false
+        }
+        val tag = arg1 as? Int ?: return false
+        val propKey = arg2 as? String ?: return false
+        val stringBytes = (arg3 as? String)?.encodeToByteArray()
+        val valueSize = when (arg3) {
+            null -> 0
+            is Int, is Float -> 4
+            is Long, is Double -> 8
+            is Boolean -> 1
+            is String -> 4 + stringBytes!!.size
+            else -> return false
+        }
+        val propId = propKeyId(propKey) ?: return false
+        beginCommand(NativeMethod.SET_VIEW_PROP, 4 + 2 + 1 + valueSize)
+        writeInt(tag)
+        writeShort(propId)
+        when (arg3) {
+            null -> writeByte(TYPE_NULL)
+            is Int -> {
+                writeByte(TYPE_INT)
+                writeInt(arg3)
+            }
+            is Long -> {
+                writeByte(TYPE_LONG)
+                writeLong(arg3)
+            }
+            is Float -> {
+                writeByte(TYPE_FLOAT)
+                writeInt(arg3.toRawBits())
+            }
+            is Double -> {
+                writeByte(TYPE_DOUBLE)
+                writeLong(arg3.toRawBits())
+            }
+            is Boolean -> {
+                writeByte(TYPE_BOOL)
+                writeByte(if (arg3) 1 else 0)
+            }
+            else -> {
+                writeByte(TYPE_STRING)
+                writeBytes(stringBytes!!)
+            }
+        }
+        return true
+    }
+
+    private fun propKeyId(propKey: String): Int? {
+        propKeyIds[propKey]?.also { return it }
+        val id = propKeyIds.size
+        if (id > MAX_PROP_ID) {
+            return null
+        }
+        propKeyIds[propKey] = id
+        val keyBytes = propKey.encodeToByteArray()
+        beginCommand(OPCODE_DEFINE_PROP_KEY, 2 + 4 + keyBytes.size)
+        writeShort(id)
+        writeBytes(keyBytes)
+        return id
+    }
+
+    private fun beginCommand(opcode: Int, payloadLength: Int) {
+        ensureCapacity(8 + payloadLength)
+        writeShort(opcode)
+        writeShort(0)
+        writeInt(payloadLength)
+    }
+
+    private fun ensureCapacity(extra: Int) {
+        if (size + extra <= buffer.size) {
+            return
+        }
+        var capacity = buffer.size * 2
+        while (capacity < size + extra) {
+            capacity *= 2
+        }
+        buffer = buffer.copyOf(capacity)
+    }
+
+    private fun writeByte(value: Int) {
+        buffer[size++] = value.toByte()
+    }
+
+    private fun writeShort(value: Int) {
+        buffer[size++] = value.toByte()
+        buffer[size++] = (value shr 8).toByte()
+    }
+
+    private fun writeInt(value: Int) {
+        buffer[size++] = value.toByte()
+        buffer[size++] = (value shr 8).toByte()
+        buffer[size++] = (value shr 16).toByte()
+        buffer[size++] = (value shr 24).toByte()
+    }
+
+    private fun writeLong(value: Long) {
+        writeInt(value.toInt())
+        writeInt((value shr 32).toInt())
+    }
+
+    private fun writeBytes(bytes: ByteArray) {
+        writeInt(bytes.size)
+        bytes.copyInto(buffer, size)
+        size += bytes.size
+    }
+
+    companion object {
+        private const val INITIAL_CAPACITY = 4 * 1024
+        private const val OPCODE_DEFINE_PROP_KEY = 0xF0
+        private const val MAX_PROP_ID = 0xFFFF
+
+        // 与 KRRenderCValue::Type 取值一致
+        private const val TYPE_NULL = 0
+        private const val TYPE_INT = 1
+        private const val TYPE_LONG = 2
+        private const val TYPE_FLOAT = 3
+        private const val TYPE_DOUBLE = 4
+        private const val TYPE_BOOL = 5
+        private const val TYPE_STRING = 6
+    }
+}